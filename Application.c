@@ -21,20 +21,40 @@
         6. Delete a node from the linked list at a specific position.
         7. Delete a node from the beginning of the linked list.
         8. Quit the application.
-   - It uses various linked list manipulation functions such as Insert_Node_At_Beginning, Insert_Node_At_End, Insert_Node_After,
-     Display_All_Nodes, Get_Length, Delete_Node, and Delete_Node_At_Beginning based on the user's choice.
+   - It uses various linked list manipulation functions such as Insert_Node_At_Beginning, Insert_Node_At_End, Insert_Node_After_Wide,
+     Display_All_Nodes, Get_Length_Wide, Delete_Node_Wide, and Delete_Node_At_Beginning based on the user's choice.
    - The instructions() function displays the menu of available options to the user.
 
+   Command line (the menu runs when there is no argument):
+   - Application --record FILE [--text]: runs the menu and records every operation (choices 1 to 7) to a trace file,
+     binary by default or text with --text (see ListTrace.h).
+   - Application --replay FILE [--backend NAME|all]: replays a trace at full speed, without the menu or the startup
+     delay, against one list implementation (default raw) or all of them, and prints the total time, the throughput
+     and the latency of every operation.
+   - Application --generate FILE COUNT [--text]: writes a synthetic trace of COUNT mixed operations with valid positions,
+     for load tests.
+
 */
 #include "Application.h"
 
 void instructions( void );  // Function to Displays a menu of available options to the user
+static int Run_Command(int argc, char *argv[]);  // Function to run the non-interactive modes
+static int Replay_Trace(const char *Path, const char *BackendName);
+static int Generate_Trace(const char *Path, size_t Count, TraceFormat_t Format);
+static void Print_Report(const TraceBackend_t *Backend, const TraceReport_t *Report);
+
+int main(int argc, char *argv[]){
+    if(1 < argc){
+        int Result = Run_Command(argc, argv);
 
-int main(){
+        if((0 != Result) || (0U == TraceRecording)){
+            return Result;  // Non-interactive mode done, or bad command line
+        }
+    }
     printf("please wait");
     while(displaycount < 5){
         printf(".");
-        Sleep(250);  // Delay for 250 milliseconds (for Windows)
+        Sleep(250);  // Delay for 250 milliseconds (usleep outside Windows, see Application.h)
         displaycount++;
     }
     puts("\nHello to Single Linked List \n");
@@ -42,7 +62,7 @@ int main(){
     while (1)
     {  // Infinite loop for menu-driven operations
         instructions();  // Display menu of options
-        scanf("%i", &UserChoice); // Get user choice
+        scanf("%hhu", &UserChoice); // Get user choice
         printf("\n");
 
         switch(UserChoice){  // Perform operations based on user choice
@@ -64,29 +84,32 @@ int main(){
                 printf("\n");
                 puts("Note : The first postion = 1 \n"
                      "please enter postion of the node :  ");
-                scanf("%i", &NodePos);
+                scanf("%zu", &NodePos);
                 printf("\n");
-                Insert_Node_After(&NodeHead_1, NodePos, &data1);
+                Insert_Node_After_Wide(&NodeHead_1, NodePos, &data1);
                 break;
             case 4:
                 Display_All_Nodes(NodeHead_1);
                 printf("\n");
                 break;
             case 5:
-                Get_Length(&NodeHead_1, &LengthNode_1);
-                printf("List Length : << %i >> Nodes\n\n", LengthNode_1);
+                Get_Length_Wide(&NodeHead_1, &LengthNode_1);
+                printf("List Length : << %zu >> Nodes\n\n", LengthNode_1);
                 break;
             case 6:
                 puts("Note : The first postion = 1 \n"
                      "please enter postion of the node :  ");
-                scanf("%i", &NodePos);
+                scanf("%zu", &NodePos);
                 printf("\n");
-                Delete_Node(&NodeHead_1, NodePos);
+                Delete_Node_Wide(&NodeHead_1, NodePos);
                 break;
             case 7:
                 Delete_Node_At_Beginning(&NodeHead_1);
                 break;
             case 8:
+                if(0U != TraceRecording){
+                    Trace_Writer_Close(&TraceWriter);  // Complete the trace before leaving
+                }
                 printf("Quit from application \n\n");
                 exit(1); // Exit the application
                 break;
@@ -94,6 +117,9 @@ int main(){
                 printf("User Choice out of range !!\n\n");
                 break;
         }
+        if((0U != TraceRecording) && (UserChoice >= TRACE_OP_INSERT_AT_BEGINNING) && (UserChoice < TRACE_OP_COUNT)){
+            Trace_Writer_Append(&TraceWriter, (TraceOp_t)UserChoice, NodePos, data1);
+        }
     }
     return 0;
 }
@@ -111,4 +137,155 @@ void instructions( void )
           " 7 to delete node from the beginning.\n"
           " 8 to end." );
     printf("UserChoice : ");
-} 
\ No newline at end of file
+} 
+
+/* Function to run the command line modes: returns the exit code, with TraceRecording set when the menu must run */
+static int Run_Command(int argc, char *argv[]){
+    int Result = 1;
+    TraceFormat_t Format = ((4 <= argc) && (0 == strcmp(argv[argc - 1], "--text"))) ? TRACE_FORMAT_TEXT : TRACE_FORMAT_BINARY;
+
+    if((3 <= argc) && (0 == strcmp(argv[1], "--record"))){
+        if(NODE_OK == Trace_Writer_Open(&TraceWriter, argv[2], Format)){
+            TraceRecording = 1U;
+            Result = 0;
+        }
+        else{
+            printf("Cannot create the trace %s\n", argv[2]);
+        }
+    }
+    else if((3 <= argc) && (0 == strcmp(argv[1], "--replay"))){
+        const char *BackendName = ((5 <= argc) && (0 == strcmp(argv[3], "--backend"))) ? argv[4] : "raw";
+
+        Result = Replay_Trace(argv[2], BackendName);
+    }
+    else if((4 <= argc) && (0 == strcmp(argv[1], "--generate"))){
+        Result = Generate_Trace(argv[2], (size_t)strtoull(argv[3], NULL, 10), Format);
+    }
+    else{
+        puts("Usage:\n"
+             "  Application                                     interactive menu\n"
+             "  Application --record FILE [--text]              menu, recording every operation to FILE\n"
+             "  Application --replay FILE [--backend NAME|all]  replay FILE and report times\n"
+             "  Application --generate FILE COUNT [--text]      write a synthetic trace of COUNT operations\n"
+             "Backends: raw (default), handle, pooled, unrolled, indexed, compact.");
+    }
+    return Result;
+}
+
+/* Function to load a trace and replay it against one backend or all of them */
+static int Replay_Trace(const char *Path, const char *BackendName){
+    int Result = 1;
+    TraceRecord_t *Records = NULL;
+    size_t Count = 0;
+
+    if(NODE_OK != Trace_Load(Path, &Records, &Count)){
+        printf("Cannot load the trace %s (missing, malformed or empty)\n", Path);
+    }
+    else{
+        TraceReport_t Report;
+        const TraceBackend_t *Backend = NULL;
+        size_t Index = 0;
+
+        printf("Trace %s : %zu operations\n", Path, Count);
+        if(0 == strcmp(BackendName, "all")){
+            for(Backend = Trace_Get_Backend(0); NULL != Backend; Backend = Trace_Get_Backend(++Index)){
+                if(NODE_OK == Trace_Replay(Backend, Records, Count, &Report)){
+                    Print_Report(Backend, &Report);
+                    Result = 0;
+                }
+            }
+        }
+        else if(NULL == (Backend = Trace_Find_Backend(BackendName))){
+            printf("Unknown backend %s\n", BackendName);
+        }
+        else if(NODE_OK == Trace_Replay(Backend, Records, Count, &Report)){
+            Print_Report(Backend, &Report);
+            Result = 0;
+        }
+        else{
+            puts("Out of memory");
+        }
+        free(Records);
+    }
+    return Result;
+}
+
+/* Function to print the result of one replay */
+static void Print_Report(const TraceBackend_t *Backend, const TraceReport_t *Report){
+    uint32_t Op = 0;
+
+    printf("\n%s : %.3f ms, %.0f ops/s, final length %zu\n", Backend->BackendName,
+           (double)Report->ReportTotalNs / 1e6, Report->ReportOpsPerSec, Report->ReportFinalLength);
+    printf("  %-20s %10s %8s %10s %10s %10s %10s %10s\n", "operation", "count", "not ok", "mean ns", "p50 ns", "p90 ns",
+           "p99 ns", "max ns");
+    for(Op = 0; Op < TRACE_OP_COUNT; Op++){
+        const TraceOpReport_t *OpReport = &Report->ReportOps[Op];
+
+        if(0U != OpReport->OpCount){
+            printf("  %-20s %10llu %8llu %10.1f %10.0f %10.0f %10.0f %10.0f\n", Trace_Op_Name((TraceOp_t)Op),
+                   OpReport->OpCount, OpReport->OpNotOk, OpReport->MeanNs, OpReport->P50Ns, OpReport->P90Ns,
+                   OpReport->P99Ns, OpReport->MaxNs);
+        }
+    }
+}
+
+/*
+   Function to write a synthetic trace: 30 % insertions at the end, 15 % at the beginning, 15 % after a random position,
+   15 % deletions at a random position, 15 % at the beginning and 10 % length queries. Positions are always valid.
+*/
+static int Generate_Trace(const char *Path, size_t Count, TraceFormat_t Format){
+    int Result = 1;
+    uint64_t Random = 88172645463325252ULL;
+    size_t Length = 0;
+    size_t counter = 0;
+
+    if(NODE_OK != Trace_Writer_Open(&TraceWriter, Path, Format)){
+        printf("Cannot create the trace %s\n", Path);
+    }
+    else{
+        for(counter = 0; counter < Count; counter++){
+            uint32_t Choice = 0;
+            TraceOp_t Op = TRACE_OP_INSERT_AT_END;
+            size_t Position = 0;
+
+            Random ^= Random << 13;
+            Random ^= Random >> 7;
+            Random ^= Random << 17;
+            Choice = (uint32_t)(Random % 100U);
+            if(0U == Length){
+                Op = TRACE_OP_INSERT_AT_END;  // Nothing to delete yet
+            }
+            else if(Choice < 30U){
+                Op = TRACE_OP_INSERT_AT_END;
+            }
+            else if(Choice < 45U){
+                Op = TRACE_OP_INSERT_AT_BEGINNING;
+            }
+            else if(Choice < 60U){
+                Op = TRACE_OP_INSERT_AFTER;
+                Position = 1U + (size_t)((Random >> 32) % Length);
+            }
+            else if(Choice < 75U){
+                Op = TRACE_OP_DELETE_NODE;
+                Position = 1U + (size_t)((Random >> 32) % Length);
+            }
+            else if(Choice < 90U){
+                Op = TRACE_OP_DELETE_AT_BEGINNING;
+            }
+            else{
+                Op = TRACE_OP_GET_LENGTH;
+            }
+            Length += ((TRACE_OP_INSERT_AT_END == Op) || (TRACE_OP_INSERT_AT_BEGINNING == Op) || (TRACE_OP_INSERT_AFTER == Op)) ? 1U : 0U;
+            Length -= ((TRACE_OP_DELETE_NODE == Op) || (TRACE_OP_DELETE_AT_BEGINNING == Op)) ? 1U : 0U;
+            Trace_Writer_Append(&TraceWriter, Op, Position, (uint32_t)(Random >> 40));
+        }
+        if(NODE_OK == Trace_Writer_Close(&TraceWriter)){
+            printf("Wrote %zu operations to %s\n", Count, Path);
+            Result = 0;
+        }
+        else{
+            printf("Write error on %s\n", Path);
+        }
+    }
+    return Result;
+}
\ No newline at end of file
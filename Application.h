@@ -8,23 +8,34 @@
 #define _APPLICATION_H
 
 /* Section : Includes */
+#if defined(_WIN32)
 #include <windows.h>
+#else
+#include <unistd.h>
+#endif
+#include <string.h>
 #include "SingleLinkedList.h"
+#include "ListTrace.h"
 
 /* Section : Macro Declarations */
 
 
 /* Section : Macro Functions Declarations */
 
+#if !defined(_WIN32)
+#define Sleep(Milliseconds) usleep((Milliseconds) * 1000U)  /* Windows Sleep on POSIX systems */
+#endif
 
 /* Section : Data type Declarations */
 
 Node_t *NodeHead_1 = NULL;   /* initially there are no nodes */
-uint16_t LengthNode_1 ;      /* Variable for user input for length of the linked list*/
+size_t LengthNode_1 ;        /* Variable for user input for length of the linked list*/
 uint8_t UserChoice ;         /* Variable for user choices */
 uint8_t displaycount;        /* Variable to count the display of dots while waiting */
-uint16_t NodePos;            /* Variable for user input for position of the linked list*/
+size_t NodePos;              /* Variable for user input for position of the linked list*/
 uint32_t data1 ;             /* Variable for user input for data of the linked list */
+TraceWriter_t TraceWriter;   /* Trace of the menu operations, when started with --record */
+boolean TraceRecording;      /* 1 while the menu operations are recorded */
 
 /* Section : Functions Declaration */
 
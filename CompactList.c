@@ -0,0 +1,417 @@
+/* 
+ * File:   CompactList.c
+ * Author: Mohammed Khairallah
+ * linkedin : linkedin.com/in/mohammed-khairallah
+ * Created on October 19, 2026, 10:00 AM
+ */
+#include "CompactList.h"
+
+/*
+   This function Compact_Allocate_Node is responsible for taking one free slot from the node store.
+
+   Parameters:
+   - List: A pointer to the compact list handle.
+   - Index: A pointer that receives the index of the slot.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, or NODE_NOK if the store is full and cannot grow.
+
+   Algorithm:
+   - A slot freed by a deletion is reused first, then a never used slot.
+   - When the store is full its capacity is doubled with one realloc (at least COMPACT_DEFAULT_CAPACITY slots).
+*/
+static NodeStatus_t Compact_Allocate_Node(CompactList_t *List, uint32_t *Index){
+    NodeStatus_t status = NODE_OK;
+
+    if(COMPACT_NULL_INDEX != List->ListFree){
+        *Index = List->ListFree;
+        List->ListFree = List->ListNodes[*Index].NodeLink;  // Unchain the slot from the free list
+    }
+    else{
+        if(List->ListUsed == List->ListCapacity){
+            size_t Capacity = (0U == List->ListCapacity) ? COMPACT_DEFAULT_CAPACITY : ((size_t)List->ListCapacity * 2U);
+
+            if(Capacity > COMPACT_MAX_NODES){
+                Capacity = COMPACT_MAX_NODES;
+            }
+            status = (Capacity > List->ListCapacity) ? Compact_Reserve(List, Capacity) : NODE_NOK;
+        }
+        if(NODE_OK == status){
+            *Index = List->ListUsed;
+            List->ListUsed++;
+        }
+    }
+    return status;
+}
+
+/* Function to give one slot back to the free list of the node store */
+static void Compact_Release_Node(CompactList_t *List, uint32_t Index){
+    List->ListNodes[Index].NodeLink = List->ListFree;
+    List->ListFree = Index;
+}
+
+/*
+   This function Compact_Locate_Node is responsible for finding the index of the node at a position.
+   The caller must have already checked that 1 <= NodePosition <= ListLength.
+   The last position is answered from ListTail without walking.
+*/
+static uint32_t Compact_Locate_Node(CompactList_t *List, size_t NodePosition){
+    uint32_t Index = List->ListTail;
+
+    if(NodePosition != List->ListLength){
+        size_t counter = 0;
+
+        Index = List->ListHead;
+        for(counter = 1; counter < NodePosition; counter++){
+            Index = List->ListNodes[Index].NodeLink;  // Move to the next node
+        }
+    }
+    return Index;
+}
+
+/*
+   This function Compact_Init is responsible for initializing a compact list handle to the empty list.
+   No memory is allocated until the first insertion (or Compact_Reserve).
+
+   Parameters:
+   - List: A pointer to the compact list handle to be initialized.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success or NODE_NULL_POINTER if List is NULL.
+*/
+NodeStatus_t Compact_Init(CompactList_t *List){
+    NodeStatus_t status = NODE_NOK;
+
+    /* Check for NULL pointers in the input parameters */
+    if(NULL == List){
+        status = NODE_NULL_POINTER;
+    }
+    else{
+        List->ListNodes = NULL;
+        List->ListHead = COMPACT_NULL_INDEX;
+        List->ListTail = COMPACT_NULL_INDEX;
+        List->ListFree = COMPACT_NULL_INDEX;
+        List->ListUsed = 0;
+        List->ListCapacity = 0;
+        List->ListLength = 0;
+        status = NODE_OK;
+    }
+    return status;
+}
+
+/*
+   This function Compact_Reserve is responsible for growing the node store to hold at least Capacity nodes.
+   Reserving the final size up front turns a long run of insertions into a single allocation.
+
+   Parameters:
+   - List: A pointer to the compact list handle.
+   - Capacity: The number of nodes the store must be able to hold (at most COMPACT_MAX_NODES).
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success (also when the store is already large enough), NODE_NULL_POINTER if List is NULL,
+                   or NODE_NOK if Capacity is too large or memory allocation failed (the list is then unchanged).
+*/
+NodeStatus_t Compact_Reserve(CompactList_t *List, size_t Capacity){
+    NodeStatus_t status = NODE_NOK;
+
+    /* Check for NULL pointers in the input parameters */
+    if(NULL == List){
+        status = NODE_NULL_POINTER;
+    }
+    else if((Capacity > COMPACT_MAX_NODES)||(Capacity > ((size_t)-1 / sizeof(CompactNode_t)))){
+        status = NODE_NOK;  // The second bound matters on 32-bit targets, where the byte count could wrap
+    }
+    else if(Capacity <= List->ListCapacity){
+        status = NODE_OK;
+    }
+    else{
+        CompactNode_t *NewNodes = (CompactNode_t *)realloc(List->ListNodes, Capacity * sizeof(CompactNode_t));
+
+        if(NULL == NewNodes){  // Check if memory allocation failed
+            status = NODE_NOK;
+        }
+        else{
+            List->ListNodes = NewNodes;
+            List->ListCapacity = (uint32_t)Capacity;
+            status = NODE_OK;
+        }
+    }
+    return status;
+}
+
+/*
+   This function Compact_Insert_Node_At_Beginning is the compact version of Insert_Node_At_Beginning.
+
+   Parameters:
+   - List: A pointer to the compact list handle.
+   - Data: A void pointer to the uint32_t value to be stored.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if a pointer is NULL, or NODE_NOK if the store cannot grow.
+*/
+NodeStatus_t Compact_Insert_Node_At_Beginning(CompactList_t *List, void *Data){
+    NodeStatus_t status = NODE_NOK;
+    uint32_t *_Data = Data;  // Cast the void pointer Data to uint32_t pointer
+    uint32_t Index = 0;
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == List)||(NULL == Data)){
+        status = NODE_NULL_POINTER;
+    }
+    else if(NODE_OK == (status = Compact_Allocate_Node(List, &Index))){
+        List->ListNodes[Index].NodeData = *_Data;
+        List->ListNodes[Index].NodeLink = List->ListHead;
+        List->ListHead = Index;
+        if(COMPACT_NULL_INDEX == List->ListTail){
+            List->ListTail = Index;
+        }
+        List->ListLength++;
+    }
+    else{
+        /* Nothing, status holds the error */
+    }
+    return status;
+}
+
+/*
+   This function Compact_Insert_Node_At_End is the compact version of Insert_Node_At_End.
+   The tail index is kept in the handle, so no traversal is needed.
+
+   Parameters:
+   - List: A pointer to the compact list handle.
+   - Data: A void pointer to the uint32_t value to be stored.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if a pointer is NULL, or NODE_NOK if the store cannot grow.
+*/
+NodeStatus_t Compact_Insert_Node_At_End(CompactList_t *List, void *Data){
+    NodeStatus_t status = NODE_NOK;
+    uint32_t *_Data = Data;  // Cast the void pointer Data to uint32_t pointer
+    uint32_t Index = 0;
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == List)||(NULL == Data)){
+        status = NODE_NULL_POINTER;
+    }
+    else if(NODE_OK == (status = Compact_Allocate_Node(List, &Index))){
+        List->ListNodes[Index].NodeData = *_Data;
+        List->ListNodes[Index].NodeLink = COMPACT_NULL_INDEX;
+        if(COMPACT_NULL_INDEX == List->ListTail){
+            List->ListHead = Index;
+        }
+        else{
+            List->ListNodes[List->ListTail].NodeLink = Index;
+        }
+        List->ListTail = Index;
+        List->ListLength++;
+    }
+    else{
+        /* Nothing, status holds the error */
+    }
+    return status;
+}
+
+/*
+   This function Compact_Insert_Node_After is the compact version of Insert_Node_After.
+
+   Parameters:
+   - List: A pointer to the compact list handle.
+   - NodePosition: The position after which the node is inserted (the first position = 1).
+   - Data: A void pointer to the uint32_t value to be stored.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if a pointer is NULL,
+                   or NODE_NOK if the position is out of range or the store cannot grow.
+
+   Algorithm:
+   - Inserting into an empty list stores the value whatever the position, as Insert_Node_After does.
+   - Otherwise the node at NodePosition is located (the tail directly for the last position) and the new node is linked after it.
+*/
+NodeStatus_t Compact_Insert_Node_After(CompactList_t *List, size_t NodePosition, void *Data){
+    NodeStatus_t status = NODE_NOK;
+    uint32_t *_Data = Data;  // Cast the void pointer Data to uint32_t pointer
+    uint32_t Index = 0;
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == List)||(NULL == Data)){
+        status = NODE_NULL_POINTER;
+    }
+    else if(0 == List->ListLength){
+        status = Compact_Insert_Node_At_Beginning(List, Data);
+    }
+    else if((0 == NodePosition)||(NodePosition > List->ListLength)){
+        status = NODE_NOK;  // Position out of range or zero
+    }
+    else if(NODE_OK == (status = Compact_Allocate_Node(List, &Index))){
+        uint32_t PrevIndex = Compact_Locate_Node(List, NodePosition);
+
+        List->ListNodes[Index].NodeData = *_Data;
+        List->ListNodes[Index].NodeLink = List->ListNodes[PrevIndex].NodeLink;
+        List->ListNodes[PrevIndex].NodeLink = Index;
+        if(List->ListTail == PrevIndex){
+            List->ListTail = Index;
+        }
+        List->ListLength++;
+    }
+    else{
+        /* Nothing, status holds the error */
+    }
+    return status;
+}
+
+/*
+   This function Compact_Delete_Node_At_Beginning is the compact version of Delete_Node_At_Beginning.
+
+   Parameters:
+   - List: A pointer to the compact list handle.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if List is NULL, or NODE_EMPTY if the list is empty.
+*/
+NodeStatus_t Compact_Delete_Node_At_Beginning(CompactList_t *List){
+    NodeStatus_t status = NODE_NOK;
+
+    /* Check for NULL pointers in the input parameters */
+    if(NULL == List){
+        status = NODE_NULL_POINTER;
+    }
+    else if(COMPACT_NULL_INDEX == List->ListHead){  /* if the list is empty */
+        status = NODE_EMPTY;
+    }
+    else{
+        uint32_t Index = List->ListHead;
+
+        List->ListHead = List->ListNodes[Index].NodeLink;
+        if(COMPACT_NULL_INDEX == List->ListHead){
+            List->ListTail = COMPACT_NULL_INDEX;
+        }
+        Compact_Release_Node(List, Index);
+        List->ListLength--;
+        status = NODE_OK;
+    }
+    return status;
+}
+
+/*
+   This function Compact_Delete_Node is the compact version of Delete_Node.
+
+   Parameters:
+   - List: A pointer to the compact list handle.
+   - NodePosition: The position of the node to be deleted (the first position = 1).
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if List is NULL,
+                   NODE_EMPTY if position 1 is requested on an empty list, or NODE_NOK if the position is out of range.
+
+   Algorithm:
+   - The predecessor of the node is located, the node is unlinked and its slot goes back to the free list.
+     The store itself never shrinks; Compact_Clear releases it.
+*/
+NodeStatus_t Compact_Delete_Node(CompactList_t *List, size_t NodePosition){
+    NodeStatus_t status = NODE_NOK;
+
+    /* Check for NULL pointers in the input parameters */
+    if(NULL == List){
+        status = NODE_NULL_POINTER;
+    }
+    else if(1U == NodePosition){
+        status = Compact_Delete_Node_At_Beginning(List);
+    }
+    else if((0 == NodePosition)||(NodePosition > List->ListLength)){
+        status = NODE_NOK;  // Position out of range or zero
+    }
+    else{
+        uint32_t PrevIndex = Compact_Locate_Node(List, NodePosition - 1U);
+        uint32_t Index = List->ListNodes[PrevIndex].NodeLink;
+
+        List->ListNodes[PrevIndex].NodeLink = List->ListNodes[Index].NodeLink;
+        if(List->ListTail == Index){
+            List->ListTail = PrevIndex;
+        }
+        Compact_Release_Node(List, Index);
+        List->ListLength--;
+        status = NODE_OK;
+    }
+    return status;
+}
+
+/*
+   This function Compact_Display_All_Nodes is the compact version of Display_All_Nodes and prints the values in the same format.
+
+   Parameters:
+   - List: A pointer to the compact list handle.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if List is NULL, or NODE_EMPTY if the list is empty.
+*/
+NodeStatus_t Compact_Display_All_Nodes(CompactList_t *List){
+    NodeStatus_t status = NODE_NOK;
+
+    /* Check for NULL pointers in the input parameters */
+    if(NULL == List){
+        status = NODE_NULL_POINTER;
+    }
+    else if(COMPACT_NULL_INDEX == List->ListHead){  /* if the list is empty */
+        status = NODE_EMPTY;
+    }
+    else{
+        uint32_t Index = List->ListHead;
+
+        while (COMPACT_NULL_INDEX != Index)
+        {
+            printf("%i -> ", List->ListNodes[Index].NodeData);  // Display the value
+            Index = List->ListNodes[Index].NodeLink;  // Move to the next node
+        }
+        printf("NULL \n");  // Print "NULL" to indicate the end of the list
+        status = NODE_OK;
+    }
+    return status;
+}
+
+/*
+   This function Compact_Get_Length is the compact version of Get_Length.
+
+   Parameters:
+   - List: A pointer to the compact list handle.
+   - Length: A pointer to a size_t where the number of nodes is stored.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success or NODE_NULL_POINTER if a pointer is NULL.
+*/
+NodeStatus_t Compact_Get_Length(CompactList_t *List, size_t *Length){
+    NodeStatus_t status = NODE_NOK;
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == List)||(NULL == Length)){
+        status = NODE_NULL_POINTER;
+    }
+    else{
+        *Length = List->ListLength;
+        status = NODE_OK;
+    }
+    return status;
+}
+
+/*
+   This function Compact_Clear is responsible for releasing the node store of a compact list and leaving it empty.
+   The whole list is one allocation, so this is a single free whatever the length.
+
+   Parameters:
+   - List: A pointer to the compact list handle.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success or NODE_NULL_POINTER if List is NULL.
+*/
+NodeStatus_t Compact_Clear(CompactList_t *List){
+    NodeStatus_t status = NODE_NOK;
+
+    /* Check for NULL pointers in the input parameters */
+    if(NULL == List){
+        status = NODE_NULL_POINTER;
+    }
+    else{
+        free(List->ListNodes);
+        status = Compact_Init(List);
+    }
+    return status;
+}
\ No newline at end of file
@@ -0,0 +1,75 @@
+/* 
+ * File:   CompactList.h
+ * Author: Mohammed Khairallah
+ * linkedin : linkedin.com/in/mohammed-khairallah
+ * Created on October 19, 2026, 10:00 AM
+ */
+#ifndef _COMPACTLIST_H
+#define _COMPACTLIST_H
+
+/* Section : Includes */
+#include "SingleLinkedList.h"
+
+/* Section : Macro Declarations */
+
+#define COMPACT_NULL_INDEX (0xFFFFFFFFU)          /* Index used as the NULL link */
+#define COMPACT_MAX_NODES (0xFFFFFFFEU)           /* Highest number of nodes one compact list can hold */
+#define COMPACT_DEFAULT_CAPACITY (16U)            /* Nodes reserved by the first insertion */
+
+/* Section : Macro Functions Declarations */
+
+
+/* Section : Data type Declarations */
+
+/* 
+   This typedef struct represents a node of a compact linked list.
+   The link is a uint32_t index into the node store of the list instead of a pointer,
+   so a node is 8 bytes without padding on 32-bit and 64-bit builds (Node_t is 16 bytes on CPU_TYPE_64).
+
+   Explanation of members:
+   - NodeData: Holds the data of the node.
+   - NodeLink: Holds the index of the next node in the store, or COMPACT_NULL_INDEX for the last node.
+               Free slots of the store are chained through the same member.
+*/
+typedef struct{
+    uint32_t NodeData;  /* data stored in node */
+    uint32_t NodeLink;  /* index of next node */
+}CompactNode_t;
+
+/* 
+   This typedef struct represents a handle to a whole compact linked list.
+   All nodes live in one contiguous array (ListNodes) that grows with a single realloc, and indices stay valid when it moves,
+   so the whole list can be copied or written out as one block.
+
+   Explanation of members:
+   - ListNodes: Holds the node store, or NULL before the first insertion.
+   - ListHead / ListTail: Holds the index of the first and last node, or COMPACT_NULL_INDEX when the list is empty.
+   - ListFree: Holds the index of the first free slot below ListUsed, or COMPACT_NULL_INDEX.
+   - ListUsed: Holds the number of slots handed out so far; slots from ListUsed to ListCapacity have never been used.
+   - ListCapacity: Holds the number of slots allocated in ListNodes.
+   - ListLength: Holds the number of nodes in the list.
+*/
+typedef struct{
+    CompactNode_t *ListNodes;  /* node store */
+    uint32_t ListHead;         /* index of the first node */
+    uint32_t ListTail;         /* index of the last node */
+    uint32_t ListFree;         /* first free slot */
+    uint32_t ListUsed;         /* slots handed out */
+    uint32_t ListCapacity;     /* slots allocated */
+    size_t ListLength;         /* number of nodes in the list */
+}CompactList_t;
+
+/* Section : Functions Declaration */
+
+NodeStatus_t Compact_Init(CompactList_t *List);
+NodeStatus_t Compact_Reserve(CompactList_t *List, size_t Capacity);
+NodeStatus_t Compact_Insert_Node_At_Beginning(CompactList_t *List, void *Data);
+NodeStatus_t Compact_Insert_Node_At_End(CompactList_t *List, void *Data);
+NodeStatus_t Compact_Insert_Node_After(CompactList_t *List, size_t NodePosition, void *Data);
+NodeStatus_t Compact_Delete_Node_At_Beginning(CompactList_t *List);
+NodeStatus_t Compact_Delete_Node(CompactList_t *List, size_t NodePosition);
+NodeStatus_t Compact_Display_All_Nodes(CompactList_t *List);
+NodeStatus_t Compact_Get_Length(CompactList_t *List, size_t *Length);
+NodeStatus_t Compact_Clear(CompactList_t *List);
+
+#endif  //_COMPACTLIST_H
\ No newline at end of file
@@ -0,0 +1,291 @@
+/* 
+ * File:   ConcurrentList.c
+ * Author: Mohammed Khairallah
+ * linkedin : linkedin.com/in/mohammed-khairallah
+ * Created on October 24, 2026, 2:00 PM
+ */
+#include <sched.h>
+#include "ConcurrentList.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#define CONCURRENT_LIST_RELAX() __builtin_ia32_pause()  /* Tell the core we are spinning */
+#else
+#define CONCURRENT_LIST_RELAX() ((void)0)
+#endif
+
+/*
+   This function Concurrent_List_Lock is responsible for taking the lock of one node.
+
+   Algorithm:
+   - Test-and-test-and-set: the lock word is only written when it was seen free, so waiting threads spin on their
+     own cached copy instead of bouncing the cache line.
+   - After CONCURRENT_LIST_SPINS_BEFORE_YIELD busy waits the thread yields, so a holder that was preempted
+     (more threads than cores) can run and release the lock.
+*/
+static void Concurrent_List_Lock(ConcurrentListNode_t *Node){
+    uint32_t Spins = 0;
+
+    while (0U != __atomic_exchange_n(&Node->NodeLock, 1U, __ATOMIC_ACQUIRE))
+    {
+        while (0U != __atomic_load_n(&Node->NodeLock, __ATOMIC_RELAXED))
+        {
+            Spins++;
+            if(0U == (Spins % CONCURRENT_LIST_SPINS_BEFORE_YIELD)){
+                sched_yield();
+            }
+            else{
+                CONCURRENT_LIST_RELAX();
+            }
+        }
+    }
+}
+
+/* Function to release the lock of one node */
+static void Concurrent_List_Unlock(ConcurrentListNode_t *Node){
+    __atomic_store_n(&Node->NodeLock, 0U, __ATOMIC_RELEASE);
+}
+
+/*
+   This function Concurrent_List_Walk is responsible for reaching the node at a position with lock coupling.
+
+   Parameters:
+   - List: A pointer to the concurrent list.
+   - NodePosition: The position to reach; 0 is the sentinel.
+
+   Return value:
+   - ConcurrentListNode_t *: The node at NodePosition, locked by the caller, or NULL (and nothing locked)
+                             if the list is shorter than NodePosition.
+
+   Algorithm:
+   - The sentinel is locked first. At every step the successor is locked before the current node is released,
+     so the link being followed cannot change and the successor cannot be freed under the walking thread.
+*/
+static ConcurrentListNode_t *Concurrent_List_Walk(ConcurrentList_t *List, size_t NodePosition){
+    ConcurrentListNode_t *NodeCopy = &List->ListSentinel;
+    size_t counter = 0;
+
+    Concurrent_List_Lock(NodeCopy);
+    while ((NULL != NodeCopy) && (counter < NodePosition))
+    {
+        ConcurrentListNode_t *NextNode = NodeCopy->NodeLink;
+
+        if(NULL != NextNode){
+            Concurrent_List_Lock(NextNode);  // Take the next lock before letting go of the current one
+        }
+        Concurrent_List_Unlock(NodeCopy);
+        NodeCopy = NextNode;
+        counter++;
+    }
+    return NodeCopy;
+}
+
+/*
+   This function Concurrent_List_Init is responsible for initializing a concurrent list to the empty list.
+   It must be called before the list is shared with other threads.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success or NODE_NULL_POINTER if List is NULL.
+*/
+NodeStatus_t Concurrent_List_Init(ConcurrentList_t *List){
+    NodeStatus_t status = NODE_NOK;
+
+    /* Check for NULL pointers in the input parameters */
+    if(NULL == List){
+        status = NODE_NULL_POINTER;
+    }
+    else{
+        List->ListSentinel.NodeData = 0;
+        List->ListSentinel.NodeLink = NULL;
+        __atomic_store_n(&List->ListSentinel.NodeLock, 0U, __ATOMIC_RELAXED);
+        __atomic_store_n(&List->ListLength, 0U, __ATOMIC_RELEASE);
+        status = NODE_OK;
+    }
+    return status;
+}
+
+/*
+   This function Concurrent_List_Insert_After is the thread-safe version of Insert_Node_After_Wide.
+   It takes a pointer to the list (List), a position (NodePosition) and a pointer to generic data (Data) as input.
+
+   Parameters:
+   - List: A pointer to the concurrent list.
+   - NodePosition: The position after which the new node is inserted; 0 inserts it at the beginning.
+   - Data: A void pointer to the uint32_t value to be stored in the new node.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if a pointer is NULL,
+                   or NODE_NOK if the list is shorter than NodePosition or memory allocation failed.
+
+   Algorithm:
+   - The node is allocated and filled before any lock is taken, so malloc is never called inside the list.
+   - Concurrent_List_Walk locks the node at NodePosition; the new node is linked after it and the lock is released.
+     Only that one node is locked while the list changes.
+*/
+NodeStatus_t Concurrent_List_Insert_After(ConcurrentList_t *List, size_t NodePosition, void *Data){
+    NodeStatus_t status = NODE_NOK;
+    uint32_t *_Data = Data;  // Cast the void pointer Data to uint32_t pointer
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == List)||(NULL == Data)){
+        status = NODE_NULL_POINTER;
+    }
+    else{
+        ConcurrentListNode_t *NewNode = (ConcurrentListNode_t *)malloc(sizeof(ConcurrentListNode_t));
+        ConcurrentListNode_t *PrevNode = NULL;
+
+        if(NULL == NewNode){  // Check if memory allocation failed
+            status = NODE_NOK;
+        }
+        else{
+            NewNode->NodeData = *_Data;
+            NewNode->NodeLock = 0U;
+            PrevNode = Concurrent_List_Walk(List, NodePosition);
+            if(NULL == PrevNode){
+                free(NewNode);
+                status = NODE_NOK;  // Position out of range
+            }
+            else{
+                NewNode->NodeLink = PrevNode->NodeLink;  // Connect the right side connection
+                PrevNode->NodeLink = NewNode;            // Connect the left side connection
+                __atomic_add_fetch(&List->ListLength, 1U, __ATOMIC_RELAXED);  // Counted before anyone can delete it
+                Concurrent_List_Unlock(PrevNode);
+                status = NODE_OK;
+            }
+        }
+    }
+    return status;
+}
+
+/*
+   This function Concurrent_List_Delete_Node is the thread-safe version of Delete_Node_Wide.
+   It takes a pointer to the list (List) and the 1-based position of the node to delete (NodePosition).
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if List is NULL, NODE_EMPTY if the list is empty,
+                   or NODE_NOK if the position is 0 or beyond the last node.
+
+   Algorithm:
+   - The predecessor is reached and locked with Concurrent_List_Walk, then the node itself is locked too.
+     Taking its lock waits for a thread that is still standing on it to move on; no other thread can reach it
+     afterwards, because that would need the predecessor's lock.
+   - The node is bypassed, the predecessor is released and the node is freed at once: unlike the lock-free stack,
+     no deferred reclamation is needed.
+*/
+NodeStatus_t Concurrent_List_Delete_Node(ConcurrentList_t *List, size_t NodePosition){
+    NodeStatus_t status = NODE_NOK;
+
+    /* Check for NULL pointers in the input parameters */
+    if(NULL == List){
+        status = NODE_NULL_POINTER;
+    }
+    else if(0U == NodePosition){
+        status = NODE_NOK;
+    }
+    else{
+        ConcurrentListNode_t *PrevNode = Concurrent_List_Walk(List, NodePosition - 1U);
+        ConcurrentListNode_t *RemovedNode = NULL;
+
+        if(NULL == PrevNode){
+            status = NODE_NOK;  // Position out of range
+        }
+        else{
+            RemovedNode = PrevNode->NodeLink;
+            if(NULL == RemovedNode){
+                status = (&List->ListSentinel == PrevNode) ? NODE_EMPTY : NODE_NOK;
+            }
+            else{
+                Concurrent_List_Lock(RemovedNode);
+                PrevNode->NodeLink = RemovedNode->NodeLink;  // Bypass the removed node
+                __atomic_sub_fetch(&List->ListLength, 1U, __ATOMIC_RELAXED);
+                status = NODE_OK;
+            }
+            Concurrent_List_Unlock(PrevNode);
+            free(RemovedNode);  // Nobody can reach it any more (free(NULL) does nothing)
+        }
+    }
+    return status;
+}
+
+/*
+   This function Concurrent_List_Get is responsible for reading the value at a 1-based position of a concurrent list.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if a pointer is NULL,
+                   or NODE_NOK if the position is 0 or beyond the last node.
+
+   Algorithm:
+   - Readers walk with the same lock coupling as writers, so they never see a node that is being unlinked.
+*/
+NodeStatus_t Concurrent_List_Get(ConcurrentList_t *List, size_t NodePosition, uint32_t *Data){
+    NodeStatus_t status = NODE_NOK;
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == List)||(NULL == Data)){
+        status = NODE_NULL_POINTER;
+    }
+    else if(0U == NodePosition){
+        status = NODE_NOK;
+    }
+    else{
+        ConcurrentListNode_t *NodeCopy = Concurrent_List_Walk(List, NodePosition);
+
+        if(NULL == NodeCopy){
+            status = NODE_NOK;  // Position out of range
+        }
+        else{
+            *Data = NodeCopy->NodeData;
+            Concurrent_List_Unlock(NodeCopy);
+            status = NODE_OK;
+        }
+    }
+    return status;
+}
+
+/*
+   This function Concurrent_List_Get_Length is responsible for reading the number of nodes of a concurrent list.
+   It is O(1) and takes no lock; while other threads insert or delete, the value may already be out of date.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success or NODE_NULL_POINTER if a pointer is NULL.
+*/
+NodeStatus_t Concurrent_List_Get_Length(ConcurrentList_t *List, size_t *Length){
+    NodeStatus_t status = NODE_NOK;
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == List)||(NULL == Length)){
+        status = NODE_NULL_POINTER;
+    }
+    else{
+        *Length = __atomic_load_n(&List->ListLength, __ATOMIC_RELAXED);
+        status = NODE_OK;
+    }
+    return status;
+}
+
+/*
+   This function Concurrent_List_Destroy is responsible for freeing every node of a concurrent list.
+   It may only be called when no other thread uses the list any more; the list is left empty.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success or NODE_NULL_POINTER if List is NULL.
+*/
+NodeStatus_t Concurrent_List_Destroy(ConcurrentList_t *List){
+    NodeStatus_t status = NODE_NOK;
+
+    /* Check for NULL pointers in the input parameters */
+    if(NULL == List){
+        status = NODE_NULL_POINTER;
+    }
+    else{
+        ConcurrentListNode_t *NodeCopy = List->ListSentinel.NodeLink;
+
+        while (NULL != NodeCopy)
+        {
+            ConcurrentListNode_t *NextNode = NodeCopy->NodeLink;  // Keep the successor before the node is freed
+            free(NodeCopy);
+            NodeCopy = NextNode;
+        }
+        status = Concurrent_List_Init(List);
+    }
+    return status;
+}
\ No newline at end of file
@@ -0,0 +1,67 @@
+/* 
+ * File:   ConcurrentList.h
+ * Author: Mohammed Khairallah
+ * linkedin : linkedin.com/in/mohammed-khairallah
+ * Created on October 24, 2026, 2:00 PM
+ */
+#ifndef _CONCURRENTLIST_H
+#define _CONCURRENTLIST_H
+
+/* Section : Includes */
+#include "SingleLinkedList.h"
+
+/* Section : Macro Declarations */
+
+#define CONCURRENT_LIST_SPINS_BEFORE_YIELD (64U)  /* Busy waits on a node lock before the thread gives up its time slice */
+
+/* Section : Macro Functions Declarations */
+
+
+/* Section : Data type Declarations */
+
+/* 
+   This typedef struct represents a node of a concurrent list.
+   It has the layout of Node_t, with the 4 bytes of padding after NodeData used as the node's lock, so a node is
+   still 16 bytes on 64-bit targets.
+
+   Explanation of members:
+   - NodeData: Holds the data value within the node, represented as an unsigned 32-bit integer.
+   - NodeLock: 0 when the node is free, 1 while a thread holds it. Only accessed with atomic operations.
+   - NodeLink: Holds a pointer to the next node. It is only read or written by a thread that holds NodeLock.
+*/
+typedef struct ConcurrentListNode{
+    uint32_t NodeData;                      /* Stores an unsigned 32-bit integer data in the node */
+    uint32_t NodeLock;                      /* spinlock, 0 free, 1 held */
+    struct ConcurrentListNode *NodeLink;    /* pointer to next node */
+}ConcurrentListNode_t; /* end structure ConcurrentListNode */
+
+/* 
+   This typedef struct represents a thread-safe list for positional operations with one lock per node (lock coupling).
+   It is the concurrent counterpart of Insert_Node_After_Wide, Delete_Node_Wide and reading a node at a position,
+   for many threads working on one shared list.
+
+   Explanation of members:
+   - ListSentinel: A node without data in front of the first node (position 0). Its lock guards the head pointer.
+   - ListLength: The number of nodes, only accessed with atomic operations. It is exact whenever no operation is running.
+
+   A thread walking to a position holds at most two node locks at a time: it locks the next node before it releases
+   the current one (hand-over-hand locking). Operations on different parts of the list therefore run in parallel,
+   while two threads can never overtake each other on the way, so a node is only unlinked once nobody stands on it.
+   Positions are not stable under concurrent updates: an operation acts on the node found at that position
+   while it walked there.
+*/
+typedef struct{
+    ConcurrentListNode_t ListSentinel;  /* node in front of the first one, guards the head */
+    size_t ListLength;                  /* number of nodes, accessed atomically */
+}ConcurrentList_t;
+
+/* Section : Functions Declaration */
+
+NodeStatus_t Concurrent_List_Init(ConcurrentList_t *List);
+NodeStatus_t Concurrent_List_Insert_After(ConcurrentList_t *List, size_t NodePosition, void *Data);
+NodeStatus_t Concurrent_List_Delete_Node(ConcurrentList_t *List, size_t NodePosition);
+NodeStatus_t Concurrent_List_Get(ConcurrentList_t *List, size_t NodePosition, uint32_t *Data);
+NodeStatus_t Concurrent_List_Get_Length(ConcurrentList_t *List, size_t *Length);
+NodeStatus_t Concurrent_List_Destroy(ConcurrentList_t *List);
+
+#endif  //_CONCURRENTLIST_H
\ No newline at end of file
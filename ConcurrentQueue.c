@@ -0,0 +1,206 @@
+/* 
+ * File:   ConcurrentQueue.c
+ * Author: Mohammed Khairallah
+ * linkedin : linkedin.com/in/mohammed-khairallah
+ * Created on October 18, 2026, 6:00 PM
+ */
+#include "ConcurrentQueue.h"
+
+#define QUEUE_HAZARD_FIRST (0U)   /* Hazard slot protecting the head (dequeue) or the tail (enqueue) */
+#define QUEUE_HAZARD_NEXT (1U)    /* Hazard slot protecting the successor of the head */
+
+/* Function used by the hazard pointer domain to free a dequeued node */
+static void Concurrent_Queue_Reclaim(void *Pointer){
+    free(Pointer);
+}
+
+/*
+   This function Concurrent_Queue_Init is responsible for initializing a concurrent queue to the empty queue.
+   It allocates the dummy node that QueueHead and QueueTail point to, and must be called before the queue is shared.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if Queue is NULL, or NODE_NOK if memory allocation failed.
+*/
+NodeStatus_t Concurrent_Queue_Init(ConcurrentQueue_t *Queue){
+    NodeStatus_t status = NODE_NOK;
+
+    /* Check for NULL pointers in the input parameters */
+    if(NULL == Queue){
+        status = NODE_NULL_POINTER;
+    }
+    else{
+        Node_t *DummyNode = (Node_t *)malloc(sizeof(Node_t));
+
+        if(NULL == DummyNode){  // Check if memory allocation failed
+            status = NODE_NOK;
+        }
+        else{
+            DummyNode->NodeData = 0;
+            DummyNode->NodeLink = NULL;
+            __atomic_store_n(&Queue->QueueHead, DummyNode, __ATOMIC_RELEASE);
+            __atomic_store_n(&Queue->QueueTail, DummyNode, __ATOMIC_RELEASE);
+            status = NODE_OK;
+        }
+    }
+    return status;
+}
+
+/*
+   This function Concurrent_Queue_Enqueue is the lock-free version of Insert_Node_At_End.
+   It takes a pointer to the queue (Queue) and a pointer to generic data (Data) as input.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if a pointer is NULL, or NODE_NOK if memory allocation failed
+                   (for the node or for the hazard pointer record of the calling thread).
+
+   Algorithm:
+   - A new node is allocated and filled with the data.
+   - The tail is read through a hazard pointer and its NodeLink is checked:
+     - If it is NULL, the new node is linked there with compare-and-swap. This is the point where the value joins the queue.
+     - Otherwise another enqueue has linked a node but not moved the tail yet; the tail is moved forward for it and the step is retried.
+   - Finally the tail is swung to the new node. If that CAS fails another thread has already done it.
+*/
+NodeStatus_t Concurrent_Queue_Enqueue(ConcurrentQueue_t *Queue, void *Data){
+    NodeStatus_t status = NODE_NOK;
+    uint32_t *_Data = Data;  // Cast the void pointer Data to uint32_t pointer
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == Queue)||(NULL == Data)){
+        status = NODE_NULL_POINTER;
+    }
+    else if(NODE_OK != Hazard_Thread_Init()){
+        status = NODE_NOK;  // Reading the tail unprotected could touch a freed node
+    }
+    else{
+        Node_t *NodeList = (Node_t *)malloc(sizeof(Node_t));
+
+        if(NULL == NodeList){  // Check if memory allocation failed
+            status = NODE_NOK;
+        }
+        else{
+            Node_t *TailNode = NULL;
+            Node_t *NextNode = NULL;
+
+            NodeList->NodeData = *_Data;
+            NodeList->NodeLink = NULL;
+            while (NODE_NOK == status)
+            {
+                TailNode = (Node_t *)Hazard_Protect(QUEUE_HAZARD_FIRST, (void **)&Queue->QueueTail);
+                NextNode = __atomic_load_n(&TailNode->NodeLink, __ATOMIC_ACQUIRE);
+                if(NULL != NextNode){
+                    /* The tail is lagging behind, help the other enqueue finish */
+                    __atomic_compare_exchange_n(&Queue->QueueTail, &TailNode, NextNode, 0,
+                                                __ATOMIC_RELEASE, __ATOMIC_RELAXED);
+                }
+                else if(__atomic_compare_exchange_n(&TailNode->NodeLink, &NextNode, NodeList, 0,
+                                                     __ATOMIC_RELEASE, __ATOMIC_RELAXED)){
+                    status = NODE_OK;
+                }
+                else{
+                    /* Another enqueue linked its node first, try again */
+                }
+            }
+            __atomic_compare_exchange_n(&Queue->QueueTail, &TailNode, NodeList, 0, __ATOMIC_RELEASE, __ATOMIC_RELAXED);
+            Hazard_Clear(QUEUE_HAZARD_FIRST);
+        }
+    }
+    return status;
+}
+
+/*
+   This function Concurrent_Queue_Dequeue is the lock-free version of Delete_Node_At_Beginning that also returns the data.
+   It takes a pointer to the queue (Queue) and a pointer where the dequeued data is stored (Data).
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if a pointer is NULL, NODE_EMPTY if the queue is empty,
+                   or NODE_NOK if the hazard pointer record of the calling thread could not be allocated.
+
+   Algorithm:
+   - The head (dummy node) and its successor are read through two hazard pointers. The successor is only trusted
+     if the head has not changed meanwhile, because a node that left the queue may point to a node that is already freed.
+   - If the successor is NULL the queue is empty.
+   - If the head is also the tail, the tail is lagging behind a completed link; it is moved forward first so that it
+     never points to a reclaimed node.
+   - The data is read from the successor and the head is swung to it with compare-and-swap, so the successor becomes
+     the new dummy node. The old dummy node is retired to the hazard pointer domain.
+*/
+NodeStatus_t Concurrent_Queue_Dequeue(ConcurrentQueue_t *Queue, uint32_t *Data){
+    NodeStatus_t status = NODE_NOK;
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == Queue)||(NULL == Data)){
+        status = NODE_NULL_POINTER;
+    }
+    else if(NODE_OK != Hazard_Thread_Init()){
+        status = NODE_NOK;  // Reading the head unprotected could touch a freed node
+    }
+    else{
+        Node_t *HeadNode = NULL;
+        Node_t *NextNode = NULL;
+        Node_t *TailNode = NULL;
+
+        while (NODE_NOK == status)
+        {
+            HeadNode = (Node_t *)Hazard_Protect(QUEUE_HAZARD_FIRST, (void **)&Queue->QueueHead);
+            NextNode = (Node_t *)Hazard_Protect(QUEUE_HAZARD_NEXT, (void **)&HeadNode->NodeLink);
+            if(HeadNode != __atomic_load_n(&Queue->QueueHead, __ATOMIC_ACQUIRE)){
+                /* The head moved while its successor was read, try again */
+            }
+            else if(NULL == NextNode){
+                status = NODE_EMPTY;
+            }
+            else{
+                TailNode = __atomic_load_n(&Queue->QueueTail, __ATOMIC_ACQUIRE);
+                if(HeadNode == TailNode){
+                    /* The tail is lagging behind, help the enqueue finish before the head passes it */
+                    __atomic_compare_exchange_n(&Queue->QueueTail, &TailNode, NextNode, 0,
+                                                __ATOMIC_RELEASE, __ATOMIC_RELAXED);
+                }
+                else{
+                    *Data = NextNode->NodeData;
+                    if(__atomic_compare_exchange_n(&Queue->QueueHead, &HeadNode, NextNode, 0,
+                                                   __ATOMIC_ACQ_REL, __ATOMIC_RELAXED)){
+                        status = NODE_OK;
+                    }
+                }
+            }
+        }
+        Hazard_Clear(QUEUE_HAZARD_NEXT);
+        Hazard_Clear(QUEUE_HAZARD_FIRST);
+        if(NODE_OK == status){
+            /* The dequeue has taken effect either way; if the retired list cannot grow the old dummy node is leaked,
+               since freeing it while another thread may still read it is not safe */
+            (void)Hazard_Retire(HeadNode, Concurrent_Queue_Reclaim);
+        }
+    }
+    return status;
+}
+
+/*
+   This function Concurrent_Queue_Destroy is responsible for freeing every node of the queue, including the dummy node.
+   It may only be called when no other thread uses the queue any more; Concurrent_Queue_Init must be called before reuse.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success or NODE_NULL_POINTER if Queue is NULL.
+*/
+NodeStatus_t Concurrent_Queue_Destroy(ConcurrentQueue_t *Queue){
+    NodeStatus_t status = NODE_NOK;
+
+    /* Check for NULL pointers in the input parameters */
+    if(NULL == Queue){
+        status = NODE_NULL_POINTER;
+    }
+    else{
+        Node_t *NodeCopy = __atomic_exchange_n(&Queue->QueueHead, NULL, __ATOMIC_ACQ_REL);
+
+        __atomic_store_n(&Queue->QueueTail, NULL, __ATOMIC_RELEASE);
+        while (NULL != NodeCopy)
+        {
+            Node_t *NextNode = NodeCopy->NodeLink;  // Keep the successor before the node is freed
+            free(NodeCopy);
+            NodeCopy = NextNode;
+        }
+        status = NODE_OK;
+    }
+    return status;
+}
\ No newline at end of file
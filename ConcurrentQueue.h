@@ -0,0 +1,49 @@
+/* 
+ * File:   ConcurrentQueue.h
+ * Author: Mohammed Khairallah
+ * linkedin : linkedin.com/in/mohammed-khairallah
+ * Created on October 18, 2026, 6:00 PM
+ */
+#ifndef _CONCURRENTQUEUE_H
+#define _CONCURRENTQUEUE_H
+
+/* Section : Includes */
+#include "SingleLinkedList.h"
+#include "HazardPointer.h"
+
+/* Section : Macro Declarations */
+
+#define QUEUE_CACHE_LINE_BYTES (64U)  /* QueueHead and QueueTail are kept this far apart */
+
+/* Section : Macro Functions Declarations */
+
+
+/* Section : Data type Declarations */
+
+/* 
+   This typedef struct represents a lock-free multi-producer multi-consumer FIFO queue (Michael-Scott queue) of Node_t nodes.
+   It is the concurrent counterpart of using a list only through Insert_Node_At_End and Delete_Node_At_Beginning:
+   producers enqueue at the tail and consumers dequeue at the head without a lock and without a tail walk.
+
+   Explanation of members:
+   - QueueHead: Holds a pointer to the dummy node; the first queued value is in the node after it.
+   - QueueTail: Holds a pointer to the last node, or to the node before it while an enqueue is completing.
+   - QueuePadding: Keeps QueueHead and QueueTail on different cache lines, so producers and consumers do not slow each other down.
+
+   Both pointers are only read and written with atomic operations. Dequeued nodes are reclaimed through hazard pointers
+   (HazardPointer.h), so every thread that uses the queue must call Hazard_Thread_Exit before it ends.
+*/
+typedef struct{
+    Node_t *QueueHead;                                               /* dummy node, accessed atomically */
+    char QueuePadding[QUEUE_CACHE_LINE_BYTES - sizeof(Node_t *)];    /* keeps QueueTail on its own cache line */
+    Node_t *QueueTail;                                               /* last node, accessed atomically */
+}ConcurrentQueue_t;
+
+/* Section : Functions Declaration */
+
+NodeStatus_t Concurrent_Queue_Init(ConcurrentQueue_t *Queue);
+NodeStatus_t Concurrent_Queue_Enqueue(ConcurrentQueue_t *Queue, void *Data);
+NodeStatus_t Concurrent_Queue_Dequeue(ConcurrentQueue_t *Queue, uint32_t *Data);
+NodeStatus_t Concurrent_Queue_Destroy(ConcurrentQueue_t *Queue);
+
+#endif  //_CONCURRENTQUEUE_H
\ No newline at end of file
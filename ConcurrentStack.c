@@ -0,0 +1,206 @@
+/* 
+ * File:   ConcurrentStack.c
+ * Author: Mohammed Khairallah
+ * linkedin : linkedin.com/in/mohammed-khairallah
+ * Created on October 18, 2026, 3:00 PM
+ */
+#include "ConcurrentStack.h"
+
+#define STACK_HAZARD_SLOT (0U)  /* Hazard slot protecting the node being popped */
+
+/* Function used by the hazard pointer domain to free a popped node */
+static void Concurrent_Stack_Reclaim(void *Pointer){
+    free(Pointer);
+}
+
+/*
+   This function Concurrent_Stack_Init is responsible for initializing a concurrent stack to the empty stack.
+   It must be called before the stack is shared with other threads.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success or NODE_NULL_POINTER if Stack is NULL.
+*/
+NodeStatus_t Concurrent_Stack_Init(ConcurrentStack_t *Stack){
+    NodeStatus_t status = NODE_NOK;
+
+    /* Check for NULL pointers in the input parameters */
+    if(NULL == Stack){
+        status = NODE_NULL_POINTER;
+    }
+    else{
+        __atomic_store_n(&Stack->StackTop, NULL, __ATOMIC_RELEASE);
+        status = NODE_OK;
+    }
+    return status;
+}
+
+/*
+   This function Concurrent_Stack_Push is the lock-free version of Insert_Node_At_Beginning.
+   It takes a pointer to the stack (Stack) and a pointer to generic data (Data) as input.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if a pointer is NULL, or NODE_NOK if memory allocation failed.
+
+   Algorithm:
+   - A new node is allocated and filled with the data.
+   - The current top is read, stored in the node's NodeLink, and the top is swapped to the new node with compare-and-swap.
+     If another thread changed the top in between, the CAS fails, returns the new top, and the step is retried.
+   - Push never dereferences shared nodes, so it needs no hazard pointer.
+*/
+NodeStatus_t Concurrent_Stack_Push(ConcurrentStack_t *Stack, void *Data){
+    NodeStatus_t status = NODE_NOK;
+    uint32_t *_Data = Data;  // Cast the void pointer Data to uint32_t pointer
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == Stack)||(NULL == Data)){
+        status = NODE_NULL_POINTER;
+    }
+    else{
+        Node_t *NodeList = (Node_t *)malloc(sizeof(Node_t));
+
+        if(NULL == NodeList){  // Check if memory allocation failed
+            status = NODE_NOK;
+        }
+        else{
+            NodeList->NodeData = *_Data;
+            NodeList->NodeLink = __atomic_load_n(&Stack->StackTop, __ATOMIC_RELAXED);
+            while (!__atomic_compare_exchange_n(&Stack->StackTop, &NodeList->NodeLink, NodeList, 1,
+                                                __ATOMIC_RELEASE, __ATOMIC_RELAXED))
+            {
+                /* NodeLink was refreshed with the current top, try again */
+            }
+            status = NODE_OK;
+        }
+    }
+    return status;
+}
+
+/*
+   This function Concurrent_Stack_Pop is the lock-free version of Delete_Node_At_Beginning that also returns the data.
+   It takes a pointer to the stack (Stack) and a pointer where the popped data is stored (Data).
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if a pointer is NULL, NODE_EMPTY if the stack is empty,
+                   or NODE_NOK if the hazard pointer record of the calling thread could not be allocated.
+
+   Algorithm:
+   - The top is read through a hazard pointer, so it cannot be freed while its NodeLink is read.
+   - The top is swapped to its successor with compare-and-swap; on failure the step is retried with the new top.
+   - Because a protected node can never be freed and reused, the top cannot go away and come back at the same
+     address between the read and the CAS (the ABA problem).
+   - The popped node is retired to the hazard pointer domain, which frees it once no other thread reads it.
+*/
+NodeStatus_t Concurrent_Stack_Pop(ConcurrentStack_t *Stack, uint32_t *Data){
+    NodeStatus_t status = NODE_NOK;
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == Stack)||(NULL == Data)){
+        status = NODE_NULL_POINTER;
+    }
+    else if(NODE_OK != Hazard_Thread_Init()){
+        status = NODE_NOK;  // Reading the top unprotected could touch a freed node
+    }
+    else{
+        Node_t *TopNode = NULL;
+
+        while (NODE_NOK == status)
+        {
+            TopNode = (Node_t *)Hazard_Protect(STACK_HAZARD_SLOT, (void **)&Stack->StackTop);
+            if(NULL == TopNode){
+                status = NODE_EMPTY;
+            }
+            else if(__atomic_compare_exchange_n(&Stack->StackTop, &TopNode, TopNode->NodeLink, 0,
+                                                __ATOMIC_ACQ_REL, __ATOMIC_RELAXED)){
+                status = NODE_OK;
+            }
+            else{
+                /* Another thread changed the top, try again */
+            }
+        }
+        Hazard_Clear(STACK_HAZARD_SLOT);
+        if(NODE_OK == status){
+            *Data = TopNode->NodeData;
+            /* The pop has taken effect either way; if the retired list cannot grow the node is leaked,
+               since freeing it while another thread may still read it is not safe */
+            (void)Hazard_Retire(TopNode, Concurrent_Stack_Reclaim);
+        }
+    }
+    return status;
+}
+
+/*
+   This function Concurrent_Stack_Pop_All is responsible for taking every node off the stack in a single atomic step.
+   It takes a pointer to the stack (Stack) and a double pointer that receives the removed chain (Chain).
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if a pointer is NULL, or NODE_EMPTY if the stack was empty.
+
+   Algorithm:
+   - The top is exchanged with NULL, so the whole chain is detached with one atomic instruction whatever its length.
+   - The chain is in pop order (most recent push first) and linked through NodeLink, like a Node_t list.
+   - Other threads may still be reading its first node, so the caller must give it back with
+     Concurrent_Stack_Release_Chain instead of freeing it directly.
+*/
+NodeStatus_t Concurrent_Stack_Pop_All(ConcurrentStack_t *Stack, Node_t **Chain){
+    NodeStatus_t status = NODE_NOK;
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == Stack)||(NULL == Chain)){
+        status = NODE_NULL_POINTER;
+    }
+    else{
+        *Chain = __atomic_exchange_n(&Stack->StackTop, NULL, __ATOMIC_ACQ_REL);
+        status = (NULL == *Chain) ? NODE_EMPTY : NODE_OK;
+    }
+    return status;
+}
+
+/*
+   This function Concurrent_Stack_Release_Chain is responsible for reclaiming a chain returned by Concurrent_Stack_Pop_All.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success (also for an empty chain), or NODE_NOK if some nodes could not be retired
+                   (they are leaked; every other node of the chain is still retired).
+*/
+NodeStatus_t Concurrent_Stack_Release_Chain(Node_t *Chain){
+    NodeStatus_t status = NODE_OK;
+
+    while (NULL != Chain)
+    {
+        Node_t *NextNode = Chain->NodeLink;  // Keep the successor before the node is retired
+
+        if(NODE_OK != Hazard_Retire(Chain, Concurrent_Stack_Reclaim)){
+            status = NODE_NOK;  // Keep going, the rest of the chain is only reachable from here
+        }
+        Chain = NextNode;
+    }
+    return status;
+}
+
+/*
+   This function Concurrent_Stack_Destroy is responsible for freeing every node still on the stack.
+   It may only be called when no other thread uses the stack any more.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success or NODE_NULL_POINTER if Stack is NULL.
+*/
+NodeStatus_t Concurrent_Stack_Destroy(ConcurrentStack_t *Stack){
+    NodeStatus_t status = NODE_NOK;
+
+    /* Check for NULL pointers in the input parameters */
+    if(NULL == Stack){
+        status = NODE_NULL_POINTER;
+    }
+    else{
+        Node_t *NodeCopy = __atomic_exchange_n(&Stack->StackTop, NULL, __ATOMIC_ACQ_REL);
+
+        while (NULL != NodeCopy)
+        {
+            Node_t *NextNode = NodeCopy->NodeLink;  // Keep the successor before the node is freed
+            free(NodeCopy);
+            NodeCopy = NextNode;
+        }
+        status = NODE_OK;
+    }
+    return status;
+}
\ No newline at end of file
@@ -0,0 +1,46 @@
+/* 
+ * File:   ConcurrentStack.h
+ * Author: Mohammed Khairallah
+ * linkedin : linkedin.com/in/mohammed-khairallah
+ * Created on October 18, 2026, 3:00 PM
+ */
+#ifndef _CONCURRENTSTACK_H
+#define _CONCURRENTSTACK_H
+
+/* Section : Includes */
+#include "SingleLinkedList.h"
+#include "HazardPointer.h"
+
+/* Section : Macro Declarations */
+
+
+/* Section : Macro Functions Declarations */
+
+
+/* Section : Data type Declarations */
+
+/* 
+   This typedef struct represents a lock-free LIFO stack (Treiber stack) of Node_t nodes.
+   It is the concurrent counterpart of using a list only through Insert_Node_At_Beginning and Delete_Node_At_Beginning:
+   any number of threads may push and pop at the same time without a lock.
+
+   Explanation of members:
+   - StackTop: Holds a pointer to the top node. It is only read and written with atomic operations.
+
+   Popped nodes are reclaimed through hazard pointers (HazardPointer.h), so every thread that pops
+   must call Hazard_Thread_Exit before it ends.
+*/
+typedef struct{
+    Node_t *StackTop;   /* top of the stack, accessed atomically */
+}ConcurrentStack_t;
+
+/* Section : Functions Declaration */
+
+NodeStatus_t Concurrent_Stack_Init(ConcurrentStack_t *Stack);
+NodeStatus_t Concurrent_Stack_Push(ConcurrentStack_t *Stack, void *Data);
+NodeStatus_t Concurrent_Stack_Pop(ConcurrentStack_t *Stack, uint32_t *Data);
+NodeStatus_t Concurrent_Stack_Pop_All(ConcurrentStack_t *Stack, Node_t **Chain);
+NodeStatus_t Concurrent_Stack_Release_Chain(Node_t *Chain);
+NodeStatus_t Concurrent_Stack_Destroy(ConcurrentStack_t *Stack);
+
+#endif  //_CONCURRENTSTACK_H
\ No newline at end of file
@@ -0,0 +1,505 @@
+/* 
+ * File:   GenericList.c
+ * Author: Mohammed Khairallah
+ * linkedin : linkedin.com/in/mohammed-khairallah
+ * Created on October 25, 2026, 10:00 AM
+ */
+#include <string.h>
+#include "GenericList.h"
+
+/* One case of the copy and compare switches: the length is a constant inside the case */
+#define GENERIC_COPY_CASE(Size) case (Size): memcpy(Dest, Source, (Size)); break;
+#define GENERIC_EQUAL_CASE(Size) case (Size): Equal = (0 == memcmp(Left, Right, (Size))) ? 1U : 0U; break;
+
+/*
+   This function Generic_Copy is responsible for copying one element.
+   The sizes in GENERIC_FAST_SIZES are copied with constant-length code; all others with memcpy.
+*/
+static inline void Generic_Copy(void *Dest, const void *Source, size_t ElementSize){
+    switch(ElementSize){
+        GENERIC_FAST_SIZES(GENERIC_COPY_CASE)
+        default:
+            memcpy(Dest, Source, ElementSize);
+            break;
+    }
+}
+
+/*
+   This function Generic_Equal is responsible for comparing two elements byte by byte.
+   The sizes in GENERIC_FAST_SIZES are compared with constant-length code; all others with memcmp.
+*/
+static inline boolean Generic_Equal(const void *Left, const void *Right, size_t ElementSize){
+    boolean Equal = 0U;
+
+    switch(ElementSize){
+        GENERIC_FAST_SIZES(GENERIC_EQUAL_CASE)
+        default:
+            Equal = (0 == memcmp(Left, Right, ElementSize)) ? 1U : 0U;
+            break;
+    }
+    return Equal;
+}
+
+/*
+   This function Generic_Allocate_Node is responsible for allocating one node with its payload and copying the element in.
+
+   Parameters:
+   - List: A pointer to the list handle, for the element size.
+   - Data: A pointer to the element to copy.
+
+   Return value:
+   - GenericNode_t *: A pointer to the new node (NodeLink is not set), or NULL if the allocation failed.
+*/
+static GenericNode_t *Generic_Allocate_Node(GenericList_t *List, const void *Data){
+    GenericNode_t *NewNode = (GenericNode_t *)malloc(sizeof(GenericNode_t) + List->ListElementSize);
+
+    if(NULL != NewNode){
+        Generic_Copy(NewNode->NodePayload, Data, List->ListElementSize);
+    }
+    return NewNode;
+}
+
+/*
+   This function Generic_Locate is responsible for finding the node at a 1-based position.
+   The caller must have already checked that 1 <= NodePosition <= ListLength.
+
+   Algorithm:
+   - The last position is answered from the tail pointer; any other position walks (NodePosition - 1) links from the head.
+*/
+static GenericNode_t *Generic_Locate(GenericList_t *List, size_t NodePosition){
+    GenericNode_t *NodeCopy = NULL;
+    size_t counter = 1;  // Initialize counter for iteration
+
+    if(NodePosition == List->ListLength){
+        NodeCopy = List->ListTail;  // The last node is known without walking
+    }
+    else{
+        NodeCopy = List->ListHead;
+        while (counter < NodePosition)
+        {
+            NodeCopy = NodeCopy->NodeLink;  // Move to the next node
+            counter++;
+        }
+    }
+    return NodeCopy;
+}
+
+/*
+   This function Generic_Init is responsible for initializing a generic list handle to the empty list.
+
+   Parameters:
+   - List: A pointer to the list handle to be initialized.
+   - ElementSize: The size in bytes of every element stored in the list (at least 1).
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if List is NULL, or NODE_NOK if ElementSize is 0.
+
+   Any nodes previously referenced by the handle are not freed; use Generic_Clear for that.
+*/
+NodeStatus_t Generic_Init(GenericList_t *List, size_t ElementSize){
+    NodeStatus_t status = NODE_NOK;
+
+    /* Check for NULL pointers in the input parameters */
+    if(NULL == List){
+        status = NODE_NULL_POINTER;
+    }
+    else if(0U == ElementSize){
+        status = NODE_NOK;
+    }
+    else{
+        List->ListHead = NULL;
+        List->ListTail = NULL;
+        List->ListLength = 0;
+        List->ListElementSize = ElementSize;
+        status = NODE_OK;
+    }
+    return status;
+}
+
+/*
+   This function Generic_Insert_Node_At_Beginning is the generic version of List_Insert_Node_At_Beginning.
+
+   Parameters:
+   - List: A pointer to the list handle.
+   - Data: A void pointer to the element (ListElementSize bytes) to be copied into the new node.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if a pointer is NULL, or NODE_NOK if memory allocation failed.
+*/
+NodeStatus_t Generic_Insert_Node_At_Beginning(GenericList_t *List, void *Data){
+    NodeStatus_t status = NODE_NOK;
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == List)||(NULL == Data)){
+        status = NODE_NULL_POINTER;
+    }
+    else{
+        GenericNode_t *NewNode = Generic_Allocate_Node(List, Data);
+
+        if(NULL == NewNode){  // Check if memory allocation failed
+            status = NODE_NOK;
+        }
+        else{
+            NewNode->NodeLink = List->ListHead;
+            List->ListHead = NewNode;
+            if(NULL == List->ListTail){
+                List->ListTail = NewNode;  // The list was empty, the new node is also the last one
+            }
+            List->ListLength++;
+            status = NODE_OK;
+        }
+    }
+    return status;
+}
+
+/*
+   This function Generic_Insert_Node_At_End is the generic version of List_Insert_Node_At_End.
+
+   Parameters:
+   - List: A pointer to the list handle.
+   - Data: A void pointer to the element (ListElementSize bytes) to be copied into the new node.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if a pointer is NULL, or NODE_NOK if memory allocation failed.
+
+   Algorithm:
+   - The node is linked after the tail pointer, so appending is O(1).
+*/
+NodeStatus_t Generic_Insert_Node_At_End(GenericList_t *List, void *Data){
+    NodeStatus_t status = NODE_NOK;
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == List)||(NULL == Data)){
+        status = NODE_NULL_POINTER;
+    }
+    else{
+        GenericNode_t *NewNode = Generic_Allocate_Node(List, Data);
+
+        if(NULL == NewNode){  // Check if memory allocation failed
+            status = NODE_NOK;
+        }
+        else{
+            NewNode->NodeLink = NULL;
+            if(NULL == List->ListTail){
+                List->ListHead = NewNode;  // The list was empty
+            }
+            else{
+                List->ListTail->NodeLink = NewNode;
+            }
+            List->ListTail = NewNode;
+            List->ListLength++;
+            status = NODE_OK;
+        }
+    }
+    return status;
+}
+
+/*
+   This function Generic_Insert_Node_After is the generic version of List_Insert_Node_After.
+
+   Parameters:
+   - List: A pointer to the list handle.
+   - NodePosition: The position after which the new node is inserted (the first position = 1).
+   - Data: A void pointer to the element (ListElementSize bytes) to be copied into the new node.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if a pointer is NULL,
+                   or NODE_NOK if the position is out of range or memory allocation failed.
+
+   Algorithm:
+   - As with List_Insert_Node_After, inserting into an empty list makes the new node the head whatever the position.
+   - Otherwise the position is checked against the cached length before anything is allocated.
+*/
+NodeStatus_t Generic_Insert_Node_After(GenericList_t *List, size_t NodePosition, void *Data){
+    NodeStatus_t status = NODE_NOK;
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == List)||(NULL == Data)){
+        status = NODE_NULL_POINTER;
+    }
+    else if(NULL == List->ListHead){  /* if the list is empty */
+        status = Generic_Insert_Node_At_Beginning(List, Data);
+    }
+    else if((0U == NodePosition)||(NodePosition > List->ListLength)){
+        status = NODE_NOK;
+    }
+    else{
+        GenericNode_t *PrevNode = Generic_Locate(List, NodePosition);
+        GenericNode_t *NewNode = Generic_Allocate_Node(List, Data);
+
+        if(NULL == NewNode){  // Check if memory allocation failed
+            status = NODE_NOK;
+        }
+        else{
+            NewNode->NodeLink = PrevNode->NodeLink;  // Connect the right side connection
+            PrevNode->NodeLink = NewNode;            // Connect the left side connection
+            if(List->ListTail == PrevNode){
+                List->ListTail = NewNode;  // The new node is the last one
+            }
+            List->ListLength++;
+            status = NODE_OK;
+        }
+    }
+    return status;
+}
+
+/*
+   This function Generic_Delete_Node_At_Beginning is the generic version of List_Delete_Node_At_Beginning.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if List is NULL, or NODE_EMPTY if the list is empty.
+*/
+NodeStatus_t Generic_Delete_Node_At_Beginning(GenericList_t *List){
+    NodeStatus_t status = NODE_NOK;
+
+    /* Check for NULL pointers in the input parameters */
+    if(NULL == List){
+        status = NODE_NULL_POINTER;
+    }
+    else if(NULL == List->ListHead){  /* if the list is empty */
+        status = NODE_EMPTY;
+    }
+    else{
+        GenericNode_t *RemovedNode = List->ListHead;
+
+        List->ListHead = RemovedNode->NodeLink;  // Update the head pointer to the next node
+        if(NULL == List->ListHead){
+            List->ListTail = NULL;  // The list is now empty
+        }
+        List->ListLength--;
+        free(RemovedNode);
+        status = NODE_OK;
+    }
+    return status;
+}
+
+/*
+   This function Generic_Delete_Node is the generic version of List_Delete_Node.
+
+   Parameters:
+   - List: A pointer to the list handle.
+   - NodePosition: The 1-based position of the node to delete.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if List is NULL, NODE_EMPTY if the list is empty,
+                   or NODE_NOK if the position is out of range.
+*/
+NodeStatus_t Generic_Delete_Node(GenericList_t *List, size_t NodePosition){
+    NodeStatus_t status = NODE_NOK;
+
+    /* Check for NULL pointers in the input parameters */
+    if(NULL == List){
+        status = NODE_NULL_POINTER;
+    }
+    else if(NULL == List->ListHead){  /* if the list is empty */
+        status = NODE_EMPTY;
+    }
+    else if((0U == NodePosition)||(NodePosition > List->ListLength)){
+        status = NODE_NOK;
+    }
+    else if(1U == NodePosition){
+        status = Generic_Delete_Node_At_Beginning(List);
+    }
+    else{
+        GenericNode_t *PrevNode = Generic_Locate(List, NodePosition - 1U);
+        GenericNode_t *RemovedNode = PrevNode->NodeLink;
+
+        PrevNode->NodeLink = RemovedNode->NodeLink;  // Bypass the removed node
+        if(List->ListTail == RemovedNode){
+            List->ListTail = PrevNode;  // The previous node becomes the last one
+        }
+        List->ListLength--;
+        free(RemovedNode);
+        status = NODE_OK;
+    }
+    return status;
+}
+
+/*
+   This function Generic_Get_Element is responsible for copying the element at a 1-based position out of the list.
+
+   Parameters:
+   - List: A pointer to the list handle.
+   - NodePosition: The 1-based position of the element.
+   - Data: A pointer to ListElementSize bytes that receive the element.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if a pointer is NULL, NODE_EMPTY if the list is empty,
+                   or NODE_NOK if the position is out of range.
+*/
+NodeStatus_t Generic_Get_Element(GenericList_t *List, size_t NodePosition, void *Data){
+    NodeStatus_t status = NODE_NOK;
+    void *Payload = NULL;
+
+    /* Check for NULL pointers in the input parameters */
+    if(NULL == Data){
+        status = NODE_NULL_POINTER;
+    }
+    else{
+        status = Generic_Get_Payload(List, NodePosition, &Payload);
+        if(NODE_OK == status){
+            Generic_Copy(Data, Payload, List->ListElementSize);
+        }
+    }
+    return status;
+}
+
+/*
+   This function Generic_Get_Payload is responsible for giving access to the element at a 1-based position in place.
+   Large records can be read or updated through the pointer without copying them.
+
+   Parameters:
+   - List: A pointer to the list handle.
+   - NodePosition: The 1-based position of the element.
+   - Payload: A double pointer that receives the address of the element inside its node.
+              It stays valid until that node is deleted.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if a pointer is NULL, NODE_EMPTY if the list is empty,
+                   or NODE_NOK if the position is out of range.
+*/
+NodeStatus_t Generic_Get_Payload(GenericList_t *List, size_t NodePosition, void **Payload){
+    NodeStatus_t status = NODE_NOK;
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == List)||(NULL == Payload)){
+        status = NODE_NULL_POINTER;
+    }
+    else if(NULL == List->ListHead){  /* if the list is empty */
+        status = NODE_EMPTY;
+    }
+    else if((0U == NodePosition)||(NodePosition > List->ListLength)){
+        status = NODE_NOK;
+    }
+    else{
+        *Payload = GENERIC_NODE_PAYLOAD(Generic_Locate(List, NodePosition));
+        status = NODE_OK;
+    }
+    return status;
+}
+
+/*
+   This function Generic_Find_Element is the generic version of Find_By_Value.
+   Elements are compared byte by byte, so records with padding bytes must be stored with the padding zeroed.
+
+   Parameters:
+   - List: A pointer to the list handle.
+   - Data: A pointer to the element to look for (ListElementSize bytes).
+   - NodePosition: A pointer that receives the 1-based position of the first equal element.
+
+   Return value:
+   - NodeStatus_t: NODE_OK if the element was found, NODE_NULL_POINTER if a pointer is NULL,
+                   NODE_EMPTY if the list is empty, or NODE_NOK if no element is equal.
+*/
+NodeStatus_t Generic_Find_Element(GenericList_t *List, void *Data, size_t *NodePosition){
+    NodeStatus_t status = NODE_NOK;
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == List)||(NULL == Data)||(NULL == NodePosition)){
+        status = NODE_NULL_POINTER;
+    }
+    else if(NULL == List->ListHead){  /* if the list is empty */
+        status = NODE_EMPTY;
+    }
+    else{
+        GenericNode_t *NodeCopy = List->ListHead;
+        size_t counter = 1;
+
+        while ((NULL != NodeCopy) && (0U == Generic_Equal(NodeCopy->NodePayload, Data, List->ListElementSize)))
+        {
+            NodeCopy = NodeCopy->NodeLink;  // Move to the next node
+            counter++;
+        }
+        if(NULL == NodeCopy){
+            status = NODE_NOK;  // Element not in the list
+        }
+        else{
+            *NodePosition = counter;
+            status = NODE_OK;
+        }
+    }
+    return status;
+}
+
+/*
+   This function Generic_For_Each is responsible for calling a function on every element, in list order.
+
+   Parameters:
+   - List: A pointer to the list handle.
+   - Visit: The function called with the address of each element and Context. It may modify the element in place
+            but must not insert or delete nodes.
+   - Context: A pointer passed unchanged to every call (may be NULL).
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if List or Visit is NULL, or NODE_EMPTY if the list is empty.
+*/
+NodeStatus_t Generic_For_Each(GenericList_t *List, GenericVisit_t Visit, void *Context){
+    NodeStatus_t status = NODE_NOK;
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == List)||(NULL == Visit)){
+        status = NODE_NULL_POINTER;
+    }
+    else if(NULL == List->ListHead){  /* if the list is empty */
+        status = NODE_EMPTY;
+    }
+    else{
+        GenericNode_t *NodeCopy = List->ListHead;
+
+        while (NULL != NodeCopy)
+        {
+            Visit(NodeCopy->NodePayload, Context);
+            NodeCopy = NodeCopy->NodeLink;  // Move to the next node
+        }
+        status = NODE_OK;
+    }
+    return status;
+}
+
+/*
+   This function Generic_Get_Length is the generic version of List_Get_Length.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success or NODE_NULL_POINTER if a pointer is NULL.
+*/
+NodeStatus_t Generic_Get_Length(GenericList_t *List, size_t *Length){
+    NodeStatus_t status = NODE_NOK;
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == List)||(NULL == Length)){
+        status = NODE_NULL_POINTER;
+    }
+    else{
+        *Length = List->ListLength;
+        status = NODE_OK;
+    }
+    return status;
+}
+
+/*
+   This function Generic_Clear is responsible for freeing every node of a generic list and leaving it empty.
+   The element size is kept.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success or NODE_NULL_POINTER if List is NULL.
+*/
+NodeStatus_t Generic_Clear(GenericList_t *List){
+    NodeStatus_t status = NODE_NOK;
+
+    /* Check for NULL pointers in the input parameters */
+    if(NULL == List){
+        status = NODE_NULL_POINTER;
+    }
+    else{
+        GenericNode_t *NodeCopy = List->ListHead;
+
+        while (NULL != NodeCopy)
+        {
+            GenericNode_t *NextNode = NodeCopy->NodeLink;  // Keep the successor before the node is freed
+            free(NodeCopy);
+            NodeCopy = NextNode;
+        }
+        status = Generic_Init(List, List->ListElementSize);
+    }
+    return status;
+}
\ No newline at end of file
@@ -0,0 +1,79 @@
+/* 
+ * File:   GenericList.h
+ * Author: Mohammed Khairallah
+ * linkedin : linkedin.com/in/mohammed-khairallah
+ * Created on October 25, 2026, 10:00 AM
+ */
+#ifndef _GENERICLIST_H
+#define _GENERICLIST_H
+
+/* Section : Includes */
+#include "SingleLinkedList.h"
+
+/* Section : Macro Declarations */
+
+/* 
+   Element sizes that get their own copy and compare code. For each size X expands to one switch case in which
+   memcpy/memcmp see a constant length, so the compiler emits plain loads and stores instead of a library call.
+   The 4-byte case is the uint32_t of Node_t; other sizes fall back to memcpy/memcmp with a run-time length.
+*/
+#define GENERIC_FAST_SIZES(X) X(1U) X(2U) X(4U) X(8U) X(16U) X(32U)
+
+/* Section : Macro Functions Declarations */
+
+/* Pointer to the payload of a node, GenericList_t.ListElementSize bytes long */
+#define GENERIC_NODE_PAYLOAD(Node) ((void *)(Node)->NodePayload)
+
+/* Section : Data type Declarations */
+
+/* 
+   This typedef struct represents a node of a generic list: a link followed by the element itself.
+   The node and its payload are one allocation of sizeof(GenericNode_t) + ElementSize bytes, so storing a record
+   costs one malloc and a traversal touches one block per element, as with Node_t.
+
+   Explanation of members:
+   - NodeLink: Holds a pointer to the next node in the list.
+   - NodePayload: Holds the element, ListElementSize bytes. It follows the pointer, so it is aligned for any type
+                  whose alignment is at most that of a pointer.
+*/
+typedef struct GenericNode{
+    struct GenericNode *NodeLink;  /* pointer to next node */
+    unsigned char NodePayload[];   /* element stored inline */
+}GenericNode_t; /* end structure GenericNode */
+
+/* 
+   This typedef struct represents a handle to a list of fixed-size elements of any type.
+   It is the counterpart of List_t with the element size chosen per list instead of uint32_t.
+
+   Explanation of members:
+   - ListHead: Holds a pointer to the first node, or NULL when the list is empty.
+   - ListTail: Holds a pointer to the last node, or NULL when the list is empty.
+   - ListLength: Holds the number of elements.
+   - ListElementSize: Holds the size in bytes of every element, set once by Generic_Init.
+*/
+typedef struct{
+    GenericNode_t *ListHead;  /* pointer to the first node */
+    GenericNode_t *ListTail;  /* pointer to the last node */
+    size_t ListLength;        /* number of elements in the list */
+    size_t ListElementSize;   /* bytes per element */
+}GenericList_t;
+
+/* Function applied to every element by Generic_For_Each */
+typedef void (*GenericVisit_t)(void *Payload, void *Context);
+
+/* Section : Functions Declaration */
+
+NodeStatus_t Generic_Init(GenericList_t *List, size_t ElementSize);
+NodeStatus_t Generic_Insert_Node_At_Beginning(GenericList_t *List, void *Data);
+NodeStatus_t Generic_Insert_Node_At_End(GenericList_t *List, void *Data);
+NodeStatus_t Generic_Insert_Node_After(GenericList_t *List, size_t NodePosition, void *Data);
+NodeStatus_t Generic_Delete_Node_At_Beginning(GenericList_t *List);
+NodeStatus_t Generic_Delete_Node(GenericList_t *List, size_t NodePosition);
+NodeStatus_t Generic_Get_Element(GenericList_t *List, size_t NodePosition, void *Data);
+NodeStatus_t Generic_Get_Payload(GenericList_t *List, size_t NodePosition, void **Payload);
+NodeStatus_t Generic_Find_Element(GenericList_t *List, void *Data, size_t *NodePosition);
+NodeStatus_t Generic_For_Each(GenericList_t *List, GenericVisit_t Visit, void *Context);
+NodeStatus_t Generic_Get_Length(GenericList_t *List, size_t *Length);
+NodeStatus_t Generic_Clear(GenericList_t *List);
+
+#endif  //_GENERICLIST_H
\ No newline at end of file
@@ -0,0 +1,295 @@
+/* 
+ * File:   HazardPointer.c
+ * Author: Mohammed Khairallah
+ * linkedin : linkedin.com/in/mohammed-khairallah
+ * Created on October 18, 2026, 3:00 PM
+ */
+
+/*
+   Hazard pointers let lock-free structures free nodes that other threads may still be reading.
+   A reader publishes the pointer it is about to dereference in one of its slots and re-checks that it is still reachable;
+   a writer that unlinks a node retires it instead of freeing it, and a retired node is only reclaimed once no slot
+   of any thread holds it. Because a protected node cannot be freed and reallocated, this also rules out the ABA problem
+   of compare-and-swap loops.
+*/
+#include "HazardPointer.h"
+
+static HazardRecord_t *HazardRecords = NULL;        /* Global list of all records, only ever grows */
+static size_t HazardRecordCount = 0;                 /* Number of records in HazardRecords */
+static _Thread_local HazardRecord_t *HazardOwnRecord = NULL;  /* Record owned by the calling thread */
+
+/*
+   This function Hazard_Own_Record is responsible for returning the record of the calling thread,
+   taking over a released record or allocating a new one on the first call.
+
+   Return value:
+   - HazardRecord_t *: The record of the calling thread, or NULL if a new record could not be allocated.
+*/
+static HazardRecord_t *Hazard_Own_Record(void){
+    HazardRecord_t *RecordCopy = HazardOwnRecord;
+
+    if(NULL == RecordCopy){
+        /* Try to take over a record released by an exited thread */
+        for(RecordCopy = __atomic_load_n(&HazardRecords, __ATOMIC_ACQUIRE); NULL != RecordCopy; RecordCopy = RecordCopy->RecordLink){
+            int Expected = 0;
+
+            if(__atomic_compare_exchange_n(&RecordCopy->RecordActive, &Expected, 1, 0, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED)){
+                break;
+            }
+        }
+        if(NULL == RecordCopy){  /* None free, publish a new one */
+            RecordCopy = (HazardRecord_t *)calloc(1U, sizeof(HazardRecord_t));
+            if(NULL != RecordCopy){
+                RecordCopy->RecordActive = 1;
+                RecordCopy->RecordLink = __atomic_load_n(&HazardRecords, __ATOMIC_RELAXED);
+                while (!__atomic_compare_exchange_n(&HazardRecords, &RecordCopy->RecordLink, RecordCopy, 1,
+                                                    __ATOMIC_RELEASE, __ATOMIC_RELAXED))
+                {
+                    /* RecordLink was refreshed with the current list head, try again */
+                }
+                __atomic_fetch_add(&HazardRecordCount, 1U, __ATOMIC_RELAXED);
+            }
+        }
+        HazardOwnRecord = RecordCopy;
+    }
+    return RecordCopy;
+}
+
+/* Function to compare two pointers for qsort and bsearch */
+static int Hazard_Compare(const void *Left, const void *Right){
+    const char *l_Left = *(const char * const *)Left;
+    const char *l_Right = *(const char * const *)Right;
+
+    return (l_Left > l_Right) - (l_Left < l_Right);
+}
+
+/*
+   This function Hazard_Thread_Init is responsible for giving the calling thread its hazard pointer record.
+   Lock-free structures call it at the start of every operation that protects or retires pointers, so a failed
+   allocation is reported to their caller instead of leaving the thread unprotected. Calling it again is cheap.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, or NODE_NOK if a new record could not be allocated.
+*/
+NodeStatus_t Hazard_Thread_Init(void){
+    NodeStatus_t status = NODE_NOK;
+
+    if(NULL != Hazard_Own_Record()){
+        status = NODE_OK;
+    }
+    return status;
+}
+
+/*
+   This function Hazard_Protect is responsible for safely reading a shared pointer that is about to be dereferenced.
+   It takes the slot to use (Slot) and the address of the shared pointer (Source).
+
+   Return value:
+   - void *: The protected value of *Source (possibly NULL). It stays valid until the slot is cleared or reused.
+             NULL is also returned, without reading *Source, if the calling thread has no record; callers that
+             checked Hazard_Thread_Init first never see that case.
+
+   Algorithm:
+   - The pointer is loaded, published in the slot, and loaded again. If both loads agree, the pointer was still
+     reachable after it became visible as hazardous, so no thread can reclaim it from now on. Otherwise it is retried.
+*/
+void *Hazard_Protect(size_t Slot, void **Source){
+    HazardRecord_t *Record = Hazard_Own_Record();
+    void *Pointer = NULL;
+    void *Check = NULL;
+
+    if(NULL != Record){
+        Pointer = __atomic_load_n(Source, __ATOMIC_ACQUIRE);
+        do{
+            Check = Pointer;
+            __atomic_store_n(&Record->RecordSlots[Slot], Check, __ATOMIC_SEQ_CST);
+            Pointer = __atomic_load_n(Source, __ATOMIC_SEQ_CST);
+        }while (Pointer != Check);
+    }
+    return Pointer;
+}
+
+/* Function to clear one slot of the calling thread */
+void Hazard_Clear(size_t Slot){
+    HazardRecord_t *Record = HazardOwnRecord;
+
+    if(NULL != Record){
+        __atomic_store_n(&Record->RecordSlots[Slot], NULL, __ATOMIC_RELEASE);
+    }
+}
+
+/*
+   This function Hazard_Retire is responsible for handing over a pointer that was unlinked from a shared structure.
+   The pointer is reclaimed with Reclaim as soon as no thread protects it.
+
+   Return value:
+   - NodeStatus_t: NODE_OK once the pointer is in the retired list, NODE_NULL_POINTER if a pointer is NULL,
+                   or NODE_NOK if the record or the retired list could not be allocated (the pointer is then leaked
+                   rather than freed unsafely). A failed Hazard_Scan does not change the result.
+
+   Algorithm:
+   - The pointer is appended to the retired list of the calling thread.
+   - When the list reaches the larger of HAZARD_RETIRE_THRESHOLD and twice the number of slots in use, Hazard_Scan runs.
+     Scanning that rarely keeps the amortized cost per retired pointer constant.
+*/
+NodeStatus_t Hazard_Retire(void *Pointer, HazardReclaim_t Reclaim){
+    NodeStatus_t status = NODE_NOK;
+    HazardRecord_t *Record = Hazard_Own_Record();
+
+    if((NULL == Pointer)||(NULL == Reclaim)){
+        status = NODE_NULL_POINTER;
+    }
+    else if(NULL == Record){
+        status = NODE_NOK;
+    }
+    else{
+        size_t Threshold = 2U * HAZARD_SLOTS_PER_THREAD * __atomic_load_n(&HazardRecordCount, __ATOMIC_RELAXED);
+
+        status = NODE_OK;
+        if(Record->RetiredCount == Record->RetiredCapacity){  /* Grow the retired list */
+            size_t NewCapacity = (0U == Record->RetiredCapacity) ? HAZARD_RETIRE_THRESHOLD : (2U * Record->RetiredCapacity);
+            HazardRetired_t *NewList = (HazardRetired_t *)realloc(Record->RetiredList, NewCapacity * sizeof(HazardRetired_t));
+
+            if(NULL == NewList){
+                status = NODE_NOK;
+            }
+            else{
+                Record->RetiredList = NewList;
+                Record->RetiredCapacity = NewCapacity;
+            }
+        }
+        if(NODE_OK == status){
+            Record->RetiredList[Record->RetiredCount].RetiredPointer = Pointer;
+            Record->RetiredList[Record->RetiredCount].Reclaim = Reclaim;
+            Record->RetiredCount++;
+            if(Threshold < HAZARD_RETIRE_THRESHOLD){
+                Threshold = HAZARD_RETIRE_THRESHOLD;
+            }
+            if(Record->RetiredCount >= Threshold){
+                /* The pointer is retired either way; if the scan cannot run it is tried again by the next retire
+                   or by Hazard_Thread_Exit */
+                (void)Hazard_Scan();
+            }
+        }
+    }
+    return status;
+}
+
+/*
+   This function Hazard_Scan is responsible for reclaiming every pointer retired by the calling thread that no thread protects.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, or NODE_NOK if the snapshot of hazards could not be allocated (nothing is reclaimed).
+
+   Algorithm:
+   - The slots of all records are copied into a sorted array. Records that appear after the scan started cannot hold
+     a valid protection of an already unlinked pointer, because Hazard_Protect re-checks reachability.
+   - Each retired pointer is looked up in it with a binary search; pointers not found are reclaimed,
+     the others stay in the retired list for a later scan.
+*/
+NodeStatus_t Hazard_Scan(void){
+    NodeStatus_t status = NODE_NOK;
+    HazardRecord_t *Record = Hazard_Own_Record();
+    HazardRecord_t *FirstRecord = NULL;
+    HazardRecord_t *RecordCopy = NULL;
+    size_t Capacity = 0;
+    void **Hazards = NULL;
+    size_t HazardCount = 0;
+    size_t counter = 0;
+    size_t Kept = 0;
+
+    if(NULL == Record){
+        status = NODE_NOK;
+    }
+    else{
+        /* Records are only ever prepended, so the list reachable from one snapshot of its head never changes */
+        __atomic_thread_fence(__ATOMIC_SEQ_CST);  // Pairs with the store in Hazard_Protect
+        FirstRecord = __atomic_load_n(&HazardRecords, __ATOMIC_ACQUIRE);
+        for(RecordCopy = FirstRecord; NULL != RecordCopy; RecordCopy = RecordCopy->RecordLink){
+            Capacity += HAZARD_SLOTS_PER_THREAD;
+        }
+        Hazards = (void **)malloc(Capacity * sizeof(void *));
+        if(NULL == Hazards){
+            status = NODE_NOK;
+        }
+        else{
+            for(RecordCopy = FirstRecord; NULL != RecordCopy; RecordCopy = RecordCopy->RecordLink){
+                for(counter = 0; counter < HAZARD_SLOTS_PER_THREAD; counter++){
+                    void *Pointer = __atomic_load_n(&RecordCopy->RecordSlots[counter], __ATOMIC_ACQUIRE);
+
+                    if(NULL != Pointer){
+                        Hazards[HazardCount] = Pointer;
+                        HazardCount++;
+                    }
+                }
+            }
+            qsort(Hazards, HazardCount, sizeof(void *), Hazard_Compare);
+
+            for(counter = 0; counter < Record->RetiredCount; counter++){
+                HazardRetired_t Retired = Record->RetiredList[counter];
+
+                if(NULL == bsearch(&Retired.RetiredPointer, Hazards, HazardCount, sizeof(void *), Hazard_Compare)){
+                    Retired.Reclaim(Retired.RetiredPointer);  // Nobody reads it any more
+                }
+                else{
+                    Record->RetiredList[Kept] = Retired;  // Still protected, try again later
+                    Kept++;
+                }
+            }
+            Record->RetiredCount = Kept;
+            free(Hazards);
+            status = NODE_OK;
+        }
+    }
+    return status;
+}
+
+/*
+   This function Hazard_Thread_Exit is responsible for releasing the record of a thread that stops using lock-free structures.
+   It must be called by every thread that used them before the thread ends.
+   Pointers still protected by other threads stay in the record and are reclaimed by the next thread that takes it over.
+
+   Return value:
+   - NodeStatus_t: NODE_OK (also when the thread never used hazard pointers).
+*/
+NodeStatus_t Hazard_Thread_Exit(void){
+    HazardRecord_t *Record = HazardOwnRecord;
+    size_t counter = 0;
+
+    if(NULL != Record){
+        for(counter = 0; counter < HAZARD_SLOTS_PER_THREAD; counter++){
+            Hazard_Clear(counter);
+        }
+        (void)Hazard_Scan();
+        HazardOwnRecord = NULL;
+        __atomic_store_n(&Record->RecordActive, 0, __ATOMIC_RELEASE);
+    }
+    return NODE_OK;
+}
+
+/*
+   This function Hazard_Shutdown is responsible for reclaiming every retired pointer and freeing all records.
+   It may only be called when no other thread uses hazard pointers any more (e.g. after joining all workers).
+
+   Return value:
+   - NodeStatus_t: NODE_OK.
+*/
+NodeStatus_t Hazard_Shutdown(void){
+    HazardRecord_t *RecordCopy = __atomic_exchange_n(&HazardRecords, NULL, __ATOMIC_ACQ_REL);
+    size_t counter = 0;
+
+    while (NULL != RecordCopy)
+    {
+        HazardRecord_t *NextRecord = RecordCopy->RecordLink;
+
+        for(counter = 0; counter < RecordCopy->RetiredCount; counter++){
+            RecordCopy->RetiredList[counter].Reclaim(RecordCopy->RetiredList[counter].RetiredPointer);
+        }
+        free(RecordCopy->RetiredList);
+        free(RecordCopy);
+        RecordCopy = NextRecord;
+    }
+    __atomic_store_n(&HazardRecordCount, 0U, __ATOMIC_RELAXED);
+    HazardOwnRecord = NULL;
+    return NODE_OK;
+}
\ No newline at end of file
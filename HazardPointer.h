@@ -0,0 +1,63 @@
+/* 
+ * File:   HazardPointer.h
+ * Author: Mohammed Khairallah
+ * linkedin : linkedin.com/in/mohammed-khairallah
+ * Created on October 18, 2026, 3:00 PM
+ */
+#ifndef _HAZARDPOINTER_H
+#define _HAZARDPOINTER_H
+
+/* Section : Includes */
+#include "SingleLinkedList.h"
+
+/* Section : Macro Declarations */
+
+#define HAZARD_SLOTS_PER_THREAD (2U)     /* Pointers one thread can protect at the same time */
+#define HAZARD_RETIRE_THRESHOLD (64U)    /* Retired pointers a thread collects before it scans for reclaimable ones */
+
+/* Section : Macro Functions Declarations */
+
+
+/* Section : Data type Declarations */
+
+/* Function that frees (or recycles) a retired pointer once no thread protects it any more */
+typedef void (*HazardReclaim_t)(void *Pointer);
+
+/* 
+   This typedef struct represents one pointer waiting to be reclaimed.
+*/
+typedef struct{
+    void *RetiredPointer;       /* pointer removed from a shared structure */
+    HazardReclaim_t Reclaim;    /* function that frees it */
+}HazardRetired_t;
+
+/* 
+   This typedef struct represents the hazard pointer record of one thread.
+   Records are never freed while threads run; a record released by an exiting thread is reused by the next new thread.
+
+   Explanation of members:
+   - RecordLink: Holds a pointer to the next record of the global record list.
+   - RecordActive: Holds 1 while a thread owns the record, 0 when it can be taken over.
+   - RecordSlots: Holds the pointers the owner is currently reading; they must not be reclaimed.
+   - RetiredList / RetiredCount / RetiredCapacity: Holds the pointers the owner removed and wants to reclaim.
+*/
+typedef struct HazardRecord{
+    struct HazardRecord *RecordLink;              /* next record */
+    int RecordActive;                             /* owned by a thread */
+    void *RecordSlots[HAZARD_SLOTS_PER_THREAD];   /* protected pointers */
+    HazardRetired_t *RetiredList;                 /* pointers waiting to be reclaimed */
+    size_t RetiredCount;                          /* used entries in RetiredList */
+    size_t RetiredCapacity;                       /* allocated entries in RetiredList */
+}HazardRecord_t; /* end structure HazardRecord */
+
+/* Section : Functions Declaration */
+
+NodeStatus_t Hazard_Thread_Init(void);
+void *Hazard_Protect(size_t Slot, void **Source);
+void Hazard_Clear(size_t Slot);
+NodeStatus_t Hazard_Retire(void *Pointer, HazardReclaim_t Reclaim);
+NodeStatus_t Hazard_Scan(void);
+NodeStatus_t Hazard_Thread_Exit(void);
+NodeStatus_t Hazard_Shutdown(void);
+
+#endif  //_HAZARDPOINTER_H
\ No newline at end of file
@@ -0,0 +1,444 @@
+/* 
+ * File:   IndexedList.c
+ * Author: Mohammed Khairallah
+ * linkedin : linkedin.com/in/mohammed-khairallah
+ * Created on October 18, 2026, 12:00 PM
+ */
+#include <stddef.h>
+#include "IndexedList.h"
+
+/*
+   This function Indexed_Random_Level is responsible for choosing the tower height of a new node.
+   Each extra level is added with probability 1/4, using a xorshift generator stored in the list handle.
+
+   Return value:
+   - uint32_t: A height between 1 and INDEXED_MAX_LEVEL.
+*/
+static uint32_t Indexed_Random_Level(IndexedList_t *List){
+    uint32_t Level = 1U;
+    uint32_t Seed = List->ListSeed;
+
+    Seed ^= Seed << 13;
+    Seed ^= Seed >> 17;
+    Seed ^= Seed << 5;
+    List->ListSeed = Seed;
+
+    while ((Level < INDEXED_MAX_LEVEL) && (0U == (Seed & INDEXED_LEVEL_MASK)))
+    {
+        Level++;
+        Seed >>= 2;  // Use the next two bits for the next level
+    }
+    return Level;
+}
+
+/*
+   This function Indexed_Links is responsible for returning the forward links of a position in the list:
+   the links of the handle for position 0 (Node = NULL), otherwise the links of the node.
+*/
+static IndexedLink_t *Indexed_Links(IndexedList_t *List, IndexedNode_t *Node){
+    return (NULL == Node) ? List->ListHead : Node->NodeLinks;
+}
+
+/*
+   This function Indexed_Insert_At is responsible for inserting a value so that it ends up right after position NodePosition
+   (0 inserts at the beginning). The caller has already checked that NodePosition <= ListLength.
+
+   Algorithm:
+   - Starting from the highest level, each level is followed while the accumulated rank plus the link span stays within
+     NodePosition. The last node reached on every level (Update) and its rank (Rank) are recorded.
+   - A tower height is drawn for the new node. Levels above the current list height start at position 0.
+   - On every level of the new tower, the new node takes over the link of Update[i] and the span is split in two.
+   - On the levels above the new tower, the links passing over the new node get one more position of span.
+   - The whole operation visits O(log n) nodes on average.
+*/
+static NodeStatus_t Indexed_Insert_At(IndexedList_t *List, size_t NodePosition, uint32_t Value){
+    NodeStatus_t status = NODE_NOK;
+    IndexedNode_t *Update[INDEXED_MAX_LEVEL] = {NULL};
+    size_t Rank[INDEXED_MAX_LEVEL];
+    IndexedNode_t *NodeCopy = NULL;  // NULL stands for position 0
+    uint32_t Level = 0;
+    uint32_t counter = 0;
+    IndexedNode_t *NewNode = NULL;
+
+    for(counter = List->ListLevel; counter > 0U; counter--){
+        uint32_t i = counter - 1U;
+        IndexedLink_t *Links = Indexed_Links(List, NodeCopy);
+
+        Rank[i] = (i == (List->ListLevel - 1U)) ? 0U : Rank[i + 1U];
+        while ((NULL != Links[i].LinkNode) && ((Rank[i] + Links[i].LinkSpan) <= NodePosition))
+        {
+            Rank[i] += Links[i].LinkSpan;
+            NodeCopy = Links[i].LinkNode;  // Move forward on this level
+            Links = NodeCopy->NodeLinks;
+        }
+        Update[i] = NodeCopy;
+    }
+
+    Level = Indexed_Random_Level(List);
+    NewNode = (IndexedNode_t *)malloc(offsetof(IndexedNode_t, NodeLinks) + (Level * sizeof(IndexedLink_t)));
+
+    if(NULL == NewNode){  // Check if memory allocation failed
+        status = NODE_NOK;
+    }
+    else{
+        if(Level > List->ListLevel){  /* The new tower is the tallest, new levels start at position 0 */
+            for(counter = List->ListLevel; counter < Level; counter++){
+                Rank[counter] = 0U;
+                Update[counter] = NULL;
+                List->ListHead[counter].LinkNode = NULL;
+                List->ListHead[counter].LinkSpan = List->ListLength;
+            }
+            List->ListLevel = Level;
+        }
+
+        NewNode->NodeData = Value;
+        NewNode->NodeLevel = Level;
+        for(counter = 0; counter < Level; counter++){
+            IndexedLink_t *Links = Indexed_Links(List, Update[counter]);
+            size_t Skipped = NodePosition - Rank[counter];  // positions between Update[counter] and the new node
+
+            NewNode->NodeLinks[counter].LinkNode = Links[counter].LinkNode;  // Connect the right side connection
+            NewNode->NodeLinks[counter].LinkSpan = Links[counter].LinkSpan - Skipped;
+            Links[counter].LinkNode = NewNode;  // Connect the left side connection
+            Links[counter].LinkSpan = Skipped + 1U;
+        }
+        for(counter = Level; counter < List->ListLevel; counter++){
+            Indexed_Links(List, Update[counter])[counter].LinkSpan++;  // This link now passes over one more node
+        }
+        List->ListLength++;
+        status = NODE_OK;
+    }
+    return status;
+}
+
+/*
+   This function Indexed_Init is responsible for initializing an indexed list handle to the empty list.
+
+   Parameters:
+   - List: A pointer to the indexed list handle to be initialized.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success or NODE_NULL_POINTER if List is NULL.
+*/
+NodeStatus_t Indexed_Init(IndexedList_t *List){
+    NodeStatus_t status = NODE_NOK;
+    uint32_t counter = 0;
+
+    /* Check for NULL pointers in the input parameters */
+    if(NULL == List){
+        status = NODE_NULL_POINTER;
+    }
+    else{
+        for(counter = 0; counter < INDEXED_MAX_LEVEL; counter++){
+            List->ListHead[counter].LinkNode = NULL;
+            List->ListHead[counter].LinkSpan = 0U;
+        }
+        List->ListLength = 0U;
+        List->ListLevel = 1U;
+        List->ListSeed = INDEXED_DEFAULT_SEED;
+        status = NODE_OK;
+    }
+    return status;
+}
+
+/*
+   This function Indexed_Insert_Node_At_Beginning is the indexed version of Insert_Node_At_Beginning.
+
+   Parameters:
+   - List: A pointer to the indexed list handle.
+   - Data: A void pointer to the uint32_t value to be stored.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if a pointer is NULL, or NODE_NOK if memory allocation failed.
+*/
+NodeStatus_t Indexed_Insert_Node_At_Beginning(IndexedList_t *List, void *Data){
+    NodeStatus_t status = NODE_NOK;
+    uint32_t *_Data = Data;  // Cast the void pointer Data to uint32_t pointer
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == List)||(NULL == Data)){
+        status = NODE_NULL_POINTER;
+    }
+    else{
+        status = Indexed_Insert_At(List, 0U, *_Data);
+    }
+    return status;
+}
+
+/*
+   This function Indexed_Insert_Node_At_End is the indexed version of Insert_Node_At_End. It is O(log n).
+
+   Parameters:
+   - List: A pointer to the indexed list handle.
+   - Data: A void pointer to the uint32_t value to be stored.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if a pointer is NULL, or NODE_NOK if memory allocation failed.
+*/
+NodeStatus_t Indexed_Insert_Node_At_End(IndexedList_t *List, void *Data){
+    NodeStatus_t status = NODE_NOK;
+    uint32_t *_Data = Data;  // Cast the void pointer Data to uint32_t pointer
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == List)||(NULL == Data)){
+        status = NODE_NULL_POINTER;
+    }
+    else{
+        status = Indexed_Insert_At(List, List->ListLength, *_Data);
+    }
+    return status;
+}
+
+/*
+   This function Indexed_Insert_Node_After is the indexed version of Insert_Node_After, with the same position semantics.
+
+   Parameters:
+   - List: A pointer to the indexed list handle.
+   - NodePosition: The position after which the new node is inserted (the first position = 1).
+   - Data: A void pointer to the uint32_t value to be stored.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if a pointer is NULL,
+                   or NODE_NOK if the position is out of range or memory allocation failed.
+
+   Algorithm:
+   - Inserting into an empty list stores the value whatever the position, as Insert_Node_After does.
+   - Otherwise NodePosition must be between 1 and the length, and the node is inserted in O(log n) using the link spans.
+*/
+NodeStatus_t Indexed_Insert_Node_After(IndexedList_t *List, size_t NodePosition, void *Data){
+    NodeStatus_t status = NODE_NOK;
+    uint32_t *_Data = Data;  // Cast the void pointer Data to uint32_t pointer
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == List)||(NULL == Data)){
+        status = NODE_NULL_POINTER;
+    }
+    else if(0U == List->ListLength){
+        status = Indexed_Insert_At(List, 0U, *_Data);
+    }
+    else if((0U == NodePosition)||(NodePosition > List->ListLength)){
+        status = NODE_NOK;  // Position out of range
+    }
+    else{
+        status = Indexed_Insert_At(List, NodePosition, *_Data);
+    }
+    return status;
+}
+
+/*
+   This function Indexed_Delete_Node_At_Beginning is the indexed version of Delete_Node_At_Beginning.
+
+   Parameters:
+   - List: A pointer to the indexed list handle.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if List is NULL, or NODE_EMPTY if the list is empty.
+*/
+NodeStatus_t Indexed_Delete_Node_At_Beginning(IndexedList_t *List){
+    return Indexed_Delete_Node(List, 1U);
+}
+
+/*
+   This function Indexed_Delete_Node is the indexed version of Delete_Node, with the same position semantics.
+
+   Parameters:
+   - List: A pointer to the indexed list handle.
+   - NodePosition: The position of the node to be deleted (the first position = 1).
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if List is NULL,
+                   NODE_EMPTY if position 1 is requested on an empty list, or NODE_NOK if the position is out of range.
+
+   Algorithm:
+   - On every level the last node strictly before NodePosition is found using the link spans (O(log n) on average).
+   - Links pointing at the removed node are redirected to its successors and absorb its span;
+     links passing over it lose one position of span.
+   - Empty top levels are dropped and the node is freed.
+*/
+NodeStatus_t Indexed_Delete_Node(IndexedList_t *List, size_t NodePosition){
+    NodeStatus_t status = NODE_NOK;
+
+    /* Check for NULL pointers in the input parameters */
+    if(NULL == List){
+        status = NODE_NULL_POINTER;
+    }
+    else if((1U == NodePosition) && (0U == List->ListLength)){
+        status = NODE_EMPTY;
+    }
+    else if((0U == NodePosition)||(NodePosition > List->ListLength)){
+        status = NODE_NOK;  // Position out of range or zero
+    }
+    else{
+        IndexedNode_t *Update[INDEXED_MAX_LEVEL] = {NULL};
+        IndexedNode_t *NodeCopy = NULL;  // NULL stands for position 0
+        IndexedNode_t *RemovedNode = NULL;
+        size_t Rank = 0U;
+        uint32_t counter = 0;
+
+        for(counter = List->ListLevel; counter > 0U; counter--){
+            uint32_t i = counter - 1U;
+            IndexedLink_t *Links = Indexed_Links(List, NodeCopy);
+
+            while ((NULL != Links[i].LinkNode) && ((Rank + Links[i].LinkSpan) < NodePosition))
+            {
+                Rank += Links[i].LinkSpan;
+                NodeCopy = Links[i].LinkNode;  // Move forward on this level
+                Links = NodeCopy->NodeLinks;
+            }
+            Update[i] = NodeCopy;
+        }
+
+        RemovedNode = Indexed_Links(List, Update[0])[0].LinkNode;
+        for(counter = 0; counter < List->ListLevel; counter++){
+            IndexedLink_t *Links = Indexed_Links(List, Update[counter]);
+
+            if(Links[counter].LinkNode == RemovedNode){
+                Links[counter].LinkSpan += RemovedNode->NodeLinks[counter].LinkSpan - 1U;
+                Links[counter].LinkNode = RemovedNode->NodeLinks[counter].LinkNode;  // Bypass the removed node
+            }
+            else{
+                Links[counter].LinkSpan--;  // This link passed over the removed node
+            }
+        }
+        while ((List->ListLevel > 1U) && (NULL == List->ListHead[List->ListLevel - 1U].LinkNode))
+        {
+            List->ListLevel--;  // Drop empty top levels
+        }
+        free(RemovedNode);  // Free the memory allocated for the removed node
+        List->ListLength--;
+        status = NODE_OK;
+    }
+    return status;
+}
+
+/*
+   This function Indexed_Get_Node_Data is responsible for reading the value stored at a position in O(log n).
+
+   Parameters:
+   - List: A pointer to the indexed list handle.
+   - NodePosition: The position of the node to read (the first position = 1).
+   - Data: A pointer where the value is stored.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if a pointer is NULL, or NODE_NOK if the position is out of range.
+*/
+NodeStatus_t Indexed_Get_Node_Data(IndexedList_t *List, size_t NodePosition, uint32_t *Data){
+    NodeStatus_t status = NODE_NOK;
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == List)||(NULL == Data)){
+        status = NODE_NULL_POINTER;
+    }
+    else if((0U == NodePosition)||(NodePosition > List->ListLength)){
+        status = NODE_NOK;  // Position out of range or zero
+    }
+    else{
+        IndexedNode_t *NodeCopy = NULL;  // NULL stands for position 0
+        size_t Rank = 0U;
+        uint32_t counter = 0;
+
+        for(counter = List->ListLevel; (counter > 0U) && (Rank != NodePosition); counter--){
+            uint32_t i = counter - 1U;
+            IndexedLink_t *Links = Indexed_Links(List, NodeCopy);
+
+            while ((NULL != Links[i].LinkNode) && ((Rank + Links[i].LinkSpan) <= NodePosition))
+            {
+                Rank += Links[i].LinkSpan;
+                NodeCopy = Links[i].LinkNode;  // Move forward on this level
+                Links = NodeCopy->NodeLinks;
+            }
+        }
+        *Data = NodeCopy->NodeData;
+        status = NODE_OK;
+    }
+    return status;
+}
+
+/*
+   This function Indexed_Display_All_Nodes is the indexed version of Display_All_Nodes and prints the nodes in the same format.
+
+   Parameters:
+   - List: A pointer to the indexed list handle.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if List is NULL, or NODE_EMPTY if the list has no nodes.
+*/
+NodeStatus_t Indexed_Display_All_Nodes(IndexedList_t *List){
+    NodeStatus_t status = NODE_NOK;
+
+    /* Check for NULL pointers in the input parameters */
+    if(NULL == List){
+        status = NODE_NULL_POINTER;
+    }
+    else if(0U == List->ListLength){  /* if the list is empty */
+        status = NODE_EMPTY;
+    }
+    else{
+        IndexedNode_t *NodeCopy = List->ListHead[0].LinkNode;
+
+        while (NULL != NodeCopy)
+        {
+            printf("%i -> ", NodeCopy->NodeData);  // Display the node data
+            NodeCopy = NodeCopy->NodeLinks[0].LinkNode;  // Move to the next node
+        }
+        printf("NULL \n");  // Print "NULL" to indicate the end of the list
+        status = NODE_OK;
+    }
+    return status;
+}
+
+/*
+   This function Indexed_Get_Length is the indexed version of Get_Length.
+
+   Parameters:
+   - List: A pointer to the indexed list handle.
+   - Length: A pointer to a size_t where the number of nodes is stored.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success or NODE_NULL_POINTER if a pointer is NULL.
+*/
+NodeStatus_t Indexed_Get_Length(IndexedList_t *List, size_t *Length){
+    NodeStatus_t status = NODE_NOK;
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == List)||(NULL == Length)){
+        status = NODE_NULL_POINTER;
+    }
+    else{
+        *Length = List->ListLength;
+        status = NODE_OK;
+    }
+    return status;
+}
+
+/*
+   This function Indexed_Clear is responsible for freeing every node of an indexed list and leaving it empty.
+
+   Parameters:
+   - List: A pointer to the indexed list handle.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success or NODE_NULL_POINTER if List is NULL.
+*/
+NodeStatus_t Indexed_Clear(IndexedList_t *List){
+    NodeStatus_t status = NODE_NOK;
+
+    /* Check for NULL pointers in the input parameters */
+    if(NULL == List){
+        status = NODE_NULL_POINTER;
+    }
+    else{
+        IndexedNode_t *NodeCopy = List->ListHead[0].LinkNode;
+        uint32_t Seed = List->ListSeed;
+
+        while (NULL != NodeCopy)
+        {
+            IndexedNode_t *NextNode = NodeCopy->NodeLinks[0].LinkNode;  // Keep the successor before the node is freed
+            free(NodeCopy);
+            NodeCopy = NextNode;
+        }
+        status = Indexed_Init(List);
+        List->ListSeed = Seed;  // Keep the generator running instead of replaying the same heights
+    }
+    return status;
+}
\ No newline at end of file
@@ -0,0 +1,81 @@
+/* 
+ * File:   IndexedList.h
+ * Author: Mohammed Khairallah
+ * linkedin : linkedin.com/in/mohammed-khairallah
+ * Created on October 18, 2026, 12:00 PM
+ */
+#ifndef _INDEXEDLIST_H
+#define _INDEXEDLIST_H
+
+/* Section : Includes */
+#include "SingleLinkedList.h"
+
+/* Section : Macro Declarations */
+
+#define INDEXED_MAX_LEVEL (16U)     /* Highest tower height, enough for 4^16 nodes */
+#define INDEXED_LEVEL_MASK (3U)     /* A tower grows one more level with probability 1/4 */
+#define INDEXED_DEFAULT_SEED (0x2545F491U)  /* Seed of the level generator used by Indexed_Init */
+
+/* Section : Macro Functions Declarations */
+
+
+/* Section : Data type Declarations */
+
+struct IndexedNode;
+
+/* 
+   This typedef struct represents one forward link of an indexed (skip list) node.
+
+   Explanation of members:
+   - LinkNode: Holds a pointer to the next node that has a tower at least this high, or NULL.
+   - LinkSpan: Holds the number of positions this link jumps over, which is what makes positional search O(log n).
+*/
+typedef struct IndexedLink{
+    struct IndexedNode *LinkNode;  /* next node at this level */
+    size_t LinkSpan;               /* positions skipped by this link */
+}IndexedLink_t; /* end structure IndexedLink */
+
+/* 
+   This typedef struct represents a node of an indexed list (an indexable skip list).
+
+   Explanation of members:
+   - NodeData: Holds the data value, an unsigned 32-bit integer as in Node_t.
+   - NodeLevel: Holds the height of the node's tower (the number of entries in NodeLinks).
+   - NodeLinks: Holds the forward links; NodeLinks[0] is the plain successor, as NodeLink in Node_t.
+*/
+typedef struct IndexedNode{
+    uint32_t NodeData;          /* Stores an unsigned 32-bit integer data in the node */
+    uint32_t NodeLevel;         /* number of forward links */
+    IndexedLink_t NodeLinks[];  /* forward links, level 0 first */
+}IndexedNode_t; /* end structure IndexedNode */
+
+/* 
+   This typedef struct represents a handle to a whole indexed list.
+
+   Explanation of members:
+   - ListHead: Holds the forward links of position 0 (the head of every level), one per possible level.
+   - ListLength: Holds the number of nodes in the list.
+   - ListLevel: Holds the height of the tallest tower currently in the list.
+   - ListSeed: Holds the state of the pseudo-random generator that chooses tower heights.
+*/
+typedef struct{
+    IndexedLink_t ListHead[INDEXED_MAX_LEVEL];  /* links leaving position 0 */
+    size_t ListLength;          /* number of nodes in the list */
+    uint32_t ListLevel;         /* levels currently in use */
+    uint32_t ListSeed;          /* tower height generator state */
+}IndexedList_t;
+
+/* Section : Functions Declaration */
+
+NodeStatus_t Indexed_Init(IndexedList_t *List);
+NodeStatus_t Indexed_Insert_Node_At_Beginning(IndexedList_t *List, void *Data);
+NodeStatus_t Indexed_Insert_Node_At_End(IndexedList_t *List, void *Data);
+NodeStatus_t Indexed_Insert_Node_After(IndexedList_t *List, size_t NodePosition, void *Data);
+NodeStatus_t Indexed_Delete_Node_At_Beginning(IndexedList_t *List);
+NodeStatus_t Indexed_Delete_Node(IndexedList_t *List, size_t NodePosition);
+NodeStatus_t Indexed_Get_Node_Data(IndexedList_t *List, size_t NodePosition, uint32_t *Data);
+NodeStatus_t Indexed_Display_All_Nodes(IndexedList_t *List);
+NodeStatus_t Indexed_Get_Length(IndexedList_t *List, size_t *Length);
+NodeStatus_t Indexed_Clear(IndexedList_t *List);
+
+#endif  //_INDEXEDLIST_H
\ No newline at end of file
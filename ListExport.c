@@ -0,0 +1,312 @@
+/* 
+ * File:   ListExport.c
+ * Author: Mohammed Khairallah
+ * linkedin : linkedin.com/in/mohammed-khairallah
+ * Created on October 19, 2026, 5:00 PM
+ */
+#include <string.h>
+#include <errno.h>
+#if defined(_WIN32)
+#include <io.h>
+#define Export_Write(Fd, Buffer, Bytes) _write((Fd), (Buffer), (unsigned int)(Bytes))
+#else
+#include <unistd.h>
+#define Export_Write(Fd, Buffer, Bytes) write((Fd), (Buffer), (Bytes))
+#endif
+#include "ListExport.h"
+
+const ExportFormat_t Export_Arrow_Format = {" -> ", " -> NULL \n", 1U};
+const ExportFormat_t Export_Csv_Format = {",", "\n", 0U};
+const ExportFormat_t Export_Lines_Format = {"\n", "\n", 0U};
+
+/* Two ASCII digits for every value from 00 to 99, so the conversion needs one division by 100 per two digits */
+static const char ExportDigitPairs[201] =
+    "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+    "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+
+/*
+   This function Export_Format_Value is responsible for converting one value to decimal ASCII.
+   It does the job of printf("%i") or printf("%u") for a single value without any stdio formatting.
+
+   Parameters:
+   - Buffer: A pointer to at least EXPORT_MAX_DIGITS bytes. No terminating '\0' is written.
+   - Value: The value to convert.
+   - Signed: 1 to read Value as a signed 32-bit integer (as "%i" does), 0 to read it as unsigned.
+
+   Return value:
+   - size_t: The number of characters written.
+
+   Algorithm:
+   - The digits are produced from the right, two at a time from ExportDigitPairs, into a small local array,
+     and copied to Buffer with one memcpy.
+*/
+size_t Export_Format_Value(char *Buffer, uint32_t Value, boolean Signed){
+    char Digits[EXPORT_MAX_DIGITS];
+    size_t Position = EXPORT_MAX_DIGITS;
+    size_t Length = 0;
+    boolean Negative = (Signed && (0U != (Value & 0x80000000U))) ? 1U : 0U;
+
+    if(Negative){
+        Value = 0U - Value;  // Magnitude of the negative value, also correct for -2147483648
+    }
+    while (Value >= 100U)
+    {
+        uint32_t Pair = (Value % 100U) * 2U;
+
+        Value /= 100U;
+        Position -= 2U;
+        Digits[Position] = ExportDigitPairs[Pair];
+        Digits[Position + 1U] = ExportDigitPairs[Pair + 1U];
+    }
+    if(Value >= 10U){
+        Position -= 2U;
+        Digits[Position] = ExportDigitPairs[Value * 2U];
+        Digits[Position + 1U] = ExportDigitPairs[(Value * 2U) + 1U];
+    }
+    else{
+        Position--;
+        Digits[Position] = (char)('0' + Value);
+    }
+    if(Negative){
+        Position--;
+        Digits[Position] = '-';
+    }
+    Length = EXPORT_MAX_DIGITS - Position;
+    memcpy(Buffer, &Digits[Position], Length);
+    return Length;
+}
+
+/* Function to prepare an exporter for a new output */
+static NodeStatus_t Export_Init(ListExporter_t *Exporter, int Fd, FILE *File, const ExportFormat_t *Format){
+    NodeStatus_t status = NODE_NOK;
+
+    if((NULL == Format->FormatSeparator)||(NULL == Format->FormatTerminator)){
+        status = NODE_NULL_POINTER;
+    }
+    else{
+        Exporter->ExportFd = Fd;
+        Exporter->ExportFile = File;
+        Exporter->ExportFormat = *Format;
+        Exporter->ExportSeparatorLength = strlen(Format->FormatSeparator);
+        Exporter->ExportTerminatorLength = strlen(Format->FormatTerminator);
+        Exporter->ExportCount = 0;
+        Exporter->ExportUsed = 0;
+        Exporter->ExportError = 0U;
+        /* Export_Value needs room for a separator and a value after a flush, Export_End_List for the terminator */
+        status = ((Exporter->ExportSeparatorLength <= (EXPORT_BUFFER_BYTES - EXPORT_MAX_DIGITS)) &&
+                  (Exporter->ExportTerminatorLength <= EXPORT_BUFFER_BYTES)) ? NODE_OK : NODE_NOK;
+    }
+    return status;
+}
+
+/*
+   This function Export_Init_Fd is responsible for preparing an exporter that writes to a file descriptor
+   (for example 1 for standard output, or a file or socket opened by the caller).
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if a pointer is NULL,
+                   or NODE_NOK if Fd is negative or the separator or terminator does not fit in the buffer
+                   (the separator must leave room for EXPORT_MAX_DIGITS).
+*/
+NodeStatus_t Export_Init_Fd(ListExporter_t *Exporter, int Fd, const ExportFormat_t *Format){
+    NodeStatus_t status = NODE_NOK;
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == Exporter)||(NULL == Format)){
+        status = NODE_NULL_POINTER;
+    }
+    else if(Fd < 0){
+        status = NODE_NOK;
+    }
+    else{
+        status = Export_Init(Exporter, Fd, NULL, Format);
+    }
+    return status;
+}
+
+/*
+   This function Export_Init_File is responsible for preparing an exporter that writes to a stdio stream.
+   The exporter hands whole chunks to fwrite; text already buffered in the stream by other calls stays in front of it.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if a pointer is NULL,
+                   or NODE_NOK if the separator or terminator does not fit in the buffer
+                   (the separator must leave room for EXPORT_MAX_DIGITS).
+*/
+NodeStatus_t Export_Init_File(ListExporter_t *Exporter, FILE *File, const ExportFormat_t *Format){
+    NodeStatus_t status = NODE_NOK;
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == Exporter)||(NULL == File)||(NULL == Format)){
+        status = NODE_NULL_POINTER;
+    }
+    else{
+        status = Export_Init(Exporter, -1, File, Format);
+    }
+    return status;
+}
+
+/*
+   This function Export_Flush is responsible for writing the text waiting in the buffer to the output.
+   For a file descriptor, short writes and interrupted writes are retried until everything is written.
+   For a FILE *, the stream itself is not flushed.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if Exporter is NULL, or NODE_NOK if a write failed now or earlier.
+*/
+NodeStatus_t Export_Flush(ListExporter_t *Exporter){
+    NodeStatus_t status = NODE_NOK;
+
+    /* Check for NULL pointers in the input parameters */
+    if(NULL == Exporter){
+        status = NODE_NULL_POINTER;
+    }
+    else{
+        size_t Written = 0;
+
+        if(0U == Exporter->ExportError){
+            if(NULL != Exporter->ExportFile){
+                Written = fwrite(Exporter->ExportBuffer, 1U, Exporter->ExportUsed, Exporter->ExportFile);
+            }
+            else{
+                while (Written < Exporter->ExportUsed)
+                {
+                    long Result = (long)Export_Write(Exporter->ExportFd, &Exporter->ExportBuffer[Written],
+                                                     Exporter->ExportUsed - Written);
+
+                    if(Result > 0){
+                        Written += (size_t)Result;
+                    }
+                    else if((Result < 0) && (EINTR == errno)){
+                        /* Interrupted before anything was written, try again */
+                    }
+                    else{
+                        break;
+                    }
+                }
+            }
+            if(Written != Exporter->ExportUsed){
+                Exporter->ExportError = 1U;
+            }
+        }
+        Exporter->ExportUsed = 0;
+        status = Exporter->ExportError ? NODE_NOK : NODE_OK;
+    }
+    return status;
+}
+
+/*
+   This function Export_Value is responsible for appending one value of the current list to the export.
+   The separator is written in front of every value except the first one of a list.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if Exporter is NULL, or NODE_NOK if a write failed.
+*/
+NodeStatus_t Export_Value(ListExporter_t *Exporter, uint32_t Value){
+    NodeStatus_t status = NODE_OK;
+
+    /* Check for NULL pointers in the input parameters */
+    if(NULL == Exporter){
+        status = NODE_NULL_POINTER;
+    }
+    else{
+        if((Exporter->ExportUsed + Exporter->ExportSeparatorLength + EXPORT_MAX_DIGITS) > EXPORT_BUFFER_BYTES){
+            status = Export_Flush(Exporter);
+        }
+        if(0U != Exporter->ExportCount){
+            memcpy(&Exporter->ExportBuffer[Exporter->ExportUsed], Exporter->ExportFormat.FormatSeparator,
+                   Exporter->ExportSeparatorLength);
+            Exporter->ExportUsed += Exporter->ExportSeparatorLength;
+        }
+        Exporter->ExportUsed += Export_Format_Value(&Exporter->ExportBuffer[Exporter->ExportUsed], Value,
+                                                    Exporter->ExportFormat.FormatSigned);
+        Exporter->ExportCount++;
+    }
+    return status;
+}
+
+/*
+   This function Export_End_List is responsible for finishing the current list: the terminator is written (unless the list
+   was empty) and the buffer is flushed, so the output is complete when it returns. The next Export_Value starts a new list.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if Exporter is NULL, or NODE_NOK if a write failed.
+*/
+NodeStatus_t Export_End_List(ListExporter_t *Exporter){
+    NodeStatus_t status = NODE_OK;
+
+    /* Check for NULL pointers in the input parameters */
+    if(NULL == Exporter){
+        status = NODE_NULL_POINTER;
+    }
+    else{
+        if(0U != Exporter->ExportCount){
+            if((Exporter->ExportUsed + Exporter->ExportTerminatorLength) > EXPORT_BUFFER_BYTES){
+                status = Export_Flush(Exporter);
+            }
+            memcpy(&Exporter->ExportBuffer[Exporter->ExportUsed], Exporter->ExportFormat.FormatTerminator,
+                   Exporter->ExportTerminatorLength);
+            Exporter->ExportUsed += Exporter->ExportTerminatorLength;
+        }
+        Exporter->ExportCount = 0;
+        if(NODE_OK != Export_Flush(Exporter)){
+            status = NODE_NOK;
+        }
+    }
+    return status;
+}
+
+/*
+   This function Export_Nodes is the buffered counterpart of Display_All_Nodes for a raw list.
+   It takes a pointer to the exporter (Exporter) and a pointer to the head of the linked list (NodeHead).
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if Exporter or NodeHead is NULL (an empty raw list, as for
+                   Display_All_Nodes), or NODE_NOK if a write failed.
+*/
+NodeStatus_t Export_Nodes(ListExporter_t *Exporter, Node_t *NodeHead){
+    NodeStatus_t status = NODE_NOK;
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == Exporter)||(NULL == NodeHead)){
+        status = NODE_NULL_POINTER;
+    }
+    else{
+        Node_t *NodeCopy = NodeHead;
+
+        status = NODE_OK;
+        while ((NULL != NodeCopy) && (NODE_OK == status))
+        {
+            status = Export_Value(Exporter, NodeCopy->NodeData);
+            NodeCopy = NodeCopy->NodeLink;  // Move to the next node
+        }
+        if((NODE_OK != Export_End_List(Exporter)) && (NODE_OK == status)){
+            status = NODE_NOK;
+        }
+    }
+    return status;
+}
+
+/*
+   This function Export_List is the buffered counterpart of List_Display_All_Nodes.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if a pointer is NULL, NODE_EMPTY if the list is empty
+                   (nothing is written), or NODE_NOK if a write failed.
+*/
+NodeStatus_t Export_List(ListExporter_t *Exporter, List_t *List){
+    NodeStatus_t status = NODE_NOK;
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == Exporter)||(NULL == List)){
+        status = NODE_NULL_POINTER;
+    }
+    else if(NULL == List->ListHead){  /* if the list is empty */
+        status = NODE_EMPTY;
+    }
+    else{
+        status = Export_Nodes(Exporter, List->ListHead);
+    }
+    return status;
+}
\ No newline at end of file
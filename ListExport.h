@@ -0,0 +1,81 @@
+/* 
+ * File:   ListExport.h
+ * Author: Mohammed Khairallah
+ * linkedin : linkedin.com/in/mohammed-khairallah
+ * Created on October 19, 2026, 5:00 PM
+ */
+#ifndef _LISTEXPORT_H
+#define _LISTEXPORT_H
+
+/* Section : Includes */
+#include "SingleLinkedList.h"
+
+/* Section : Macro Declarations */
+
+#define EXPORT_BUFFER_BYTES (64U * 1024U)  /* Text collected before one write to the output */
+#define EXPORT_MAX_DIGITS (11U)            /* Longest formatted value: "-2147483648" */
+
+/* Section : Macro Functions Declarations */
+
+
+/* Section : Data type Declarations */
+
+/* 
+   This typedef struct describes the text layout of an export.
+
+   Explanation of members:
+   - FormatSeparator: Holds the text written between two values.
+   - FormatTerminator: Holds the text written after the last value (nothing is written for an empty list).
+   - FormatSigned: Holds 1 to print values as signed integers like printf("%i"), 0 to print them as unsigned.
+
+   Export_Arrow_Format reproduces Display_All_Nodes byte for byte ("1 -> 2 -> NULL \n").
+*/
+typedef struct{
+    const char *FormatSeparator;   /* text between values */
+    const char *FormatTerminator;  /* text after the last value */
+    boolean FormatSigned;          /* signed (%i) or unsigned values */
+}ExportFormat_t;
+
+/* 
+   This typedef struct represents one streaming text export to a file descriptor or a FILE *.
+   Values are formatted into ExportBuffer and written in EXPORT_BUFFER_BYTES chunks, so the output sees a few large writes
+   instead of one formatted print per value. The exporter can be reused for any number of lists.
+
+   Explanation of members:
+   - ExportFd / ExportFile: Holds the output; exactly one of them is used (ExportFd is -1 when ExportFile is set).
+   - ExportFormat: Holds the separator, terminator and sign of the output.
+   - ExportSeparatorLength / ExportTerminatorLength: Holds the cached lengths of the separator and terminator.
+   - ExportCount: Holds the number of values of the current list written so far.
+   - ExportUsed: Holds the number of bytes waiting in ExportBuffer.
+   - ExportError: Holds 1 once a write failed; later calls then report NODE_NOK.
+*/
+typedef struct{
+    int ExportFd;                           /* output file descriptor, or -1 */
+    FILE *ExportFile;                       /* output stream, or NULL */
+    ExportFormat_t ExportFormat;            /* text layout */
+    size_t ExportSeparatorLength;           /* strlen of the separator */
+    size_t ExportTerminatorLength;          /* strlen of the terminator */
+    size_t ExportCount;                     /* values of the current list */
+    size_t ExportUsed;                      /* bytes waiting in ExportBuffer */
+    boolean ExportError;                    /* a write failed */
+    char ExportBuffer[EXPORT_BUFFER_BYTES]; /* text not yet written */
+}ListExporter_t;
+
+/* Section : Global Variables Declarations */
+
+extern const ExportFormat_t Export_Arrow_Format;   /* "1 -> 2 -> NULL \n", signed, as Display_All_Nodes */
+extern const ExportFormat_t Export_Csv_Format;     /* "1,2\n", unsigned */
+extern const ExportFormat_t Export_Lines_Format;   /* "1\n2\n", unsigned */
+
+/* Section : Functions Declaration */
+
+size_t Export_Format_Value(char *Buffer, uint32_t Value, boolean Signed);
+NodeStatus_t Export_Init_Fd(ListExporter_t *Exporter, int Fd, const ExportFormat_t *Format);
+NodeStatus_t Export_Init_File(ListExporter_t *Exporter, FILE *File, const ExportFormat_t *Format);
+NodeStatus_t Export_Value(ListExporter_t *Exporter, uint32_t Value);
+NodeStatus_t Export_End_List(ListExporter_t *Exporter);
+NodeStatus_t Export_Flush(ListExporter_t *Exporter);
+NodeStatus_t Export_Nodes(ListExporter_t *Exporter, Node_t *NodeHead);
+NodeStatus_t Export_List(ListExporter_t *Exporter, List_t *List);
+
+#endif  //_LISTEXPORT_H
\ No newline at end of file
@@ -0,0 +1,377 @@
+/* 
+ * File:   ListIndex.c
+ * Author: Mohammed Khairallah
+ * linkedin : linkedin.com/in/mohammed-khairallah
+ * Created on October 21, 2026, 2:00 PM
+ */
+#include "ListIndex.h"
+
+/*
+   This function List_Index_Home is responsible for finding the home slot of a value.
+   The value goes through the murmur3 finalizer and the top bits are kept. A single multiplication is not enough here:
+   keys that are themselves multiples of the hash constant (ids from another multiplicative hash) would pile up in long runs.
+*/
+static size_t List_Index_Home(const ListIndex_t *Index, uint32_t Value){
+    Value ^= Value >> 16;
+    Value *= 0x85EBCA6BU;
+    Value ^= Value >> 13;
+    Value *= 0xC2B2AE35U;
+    Value ^= Value >> 16;
+    return (size_t)(Value >> Index->IndexShift);
+}
+
+/*
+   This function List_Index_Locate is responsible for finding the slot of one indexed node.
+
+   Parameters:
+   - Index: A pointer to the index.
+   - Node: A pointer to the node; its NodeData selects the probe sequence.
+
+   Return value:
+   - size_t: The slot holding Node, or IndexCapacity if Node is not indexed.
+*/
+static size_t List_Index_Locate(const ListIndex_t *Index, const Node_t *Node){
+    size_t Mask = Index->IndexCapacity - 1U;
+    size_t Slot = List_Index_Home(Index, Node->NodeData);
+
+    while ((NULL != Index->IndexSlots[Slot].EntryNode) && (Node != Index->IndexSlots[Slot].EntryNode))
+    {
+        Slot = (Slot + 1U) & Mask;  // Linear probing
+    }
+    return (NULL == Index->IndexSlots[Slot].EntryNode) ? Index->IndexCapacity : Slot;
+}
+
+/* Function to store an entry in the first free slot of its probe sequence; the table must have a free slot */
+static void List_Index_Place(ListIndex_t *Index, const ListIndexEntry_t *Entry){
+    size_t Mask = Index->IndexCapacity - 1U;
+    size_t Slot = List_Index_Home(Index, Entry->EntryKey);
+
+    while (NULL != Index->IndexSlots[Slot].EntryNode)
+    {
+        Slot = (Slot + 1U) & Mask;
+    }
+    Index->IndexSlots[Slot] = *Entry;
+}
+
+/*
+   This function List_Index_Resize is responsible for moving all entries to a new slot table.
+
+   Parameters:
+   - Index: A pointer to the index.
+   - Capacity: The new number of slots, a power of two larger than IndexCount.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success or NODE_NOK if the table could not be allocated (the old one is kept then).
+*/
+static NodeStatus_t List_Index_Resize(ListIndex_t *Index, size_t Capacity){
+    NodeStatus_t status = NODE_NOK;
+    ListIndexEntry_t *OldSlots = Index->IndexSlots;
+    size_t OldCapacity = Index->IndexCapacity;
+    ListIndexEntry_t *NewSlots = (ListIndexEntry_t *)calloc(Capacity, sizeof(ListIndexEntry_t));
+
+    if(NULL == NewSlots){  // Check if memory allocation failed
+        status = NODE_NOK;
+    }
+    else{
+        size_t counter = 0;
+        uint32_t Shift = 32U;
+
+        while (((size_t)1U << (32U - Shift)) < Capacity)
+        {
+            Shift--;
+        }
+        Index->IndexSlots = NewSlots;
+        Index->IndexCapacity = Capacity;
+        Index->IndexShift = Shift;
+        for(counter = 0; counter < OldCapacity; counter++){
+            if(NULL != OldSlots[counter].EntryNode){
+                List_Index_Place(Index, &OldSlots[counter]);
+            }
+        }
+        free(OldSlots);
+        status = NODE_OK;
+    }
+    return status;
+}
+
+/*
+   This function List_Index_Init is responsible for preparing an empty index.
+
+   Parameters:
+   - Index: A pointer to the index to initialize.
+   - Capacity: The expected number of nodes, or 0. The table is sized so this many nodes fit without growing.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if Index is NULL, or NODE_NOK if the table could not be allocated.
+
+   Algorithm:
+   - The slot count is the smallest power of two of at least LIST_INDEX_MIN_CAPACITY and twice Capacity,
+     so the table starts at most half full.
+*/
+NodeStatus_t List_Index_Init(ListIndex_t *Index, size_t Capacity){
+    NodeStatus_t status = NODE_NOK;
+    size_t Slots = LIST_INDEX_MIN_CAPACITY;
+
+    /* Check for NULL pointers in the input parameters */
+    if(NULL == Index){
+        status = NODE_NULL_POINTER;
+    }
+    else{
+        while ((Slots / 2U) < Capacity)
+        {
+            Slots *= 2U;
+        }
+        Index->IndexSlots = NULL;
+        Index->IndexCapacity = 0;
+        Index->IndexCount = 0;
+        Index->IndexShift = 32U;
+        Index->IndexStale = 0U;
+        status = List_Index_Resize(Index, Slots);
+    }
+    return status;
+}
+
+/*
+   This function List_Index_Destroy is responsible for releasing the slot table of an index.
+   The index must be detached first (List_Use_Index with NULL), and it must be initialized again before reuse.
+
+   Parameters:
+   - Index: A pointer to the index.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success or NODE_NULL_POINTER if Index is NULL.
+*/
+NodeStatus_t List_Index_Destroy(ListIndex_t *Index){
+    NodeStatus_t status = NODE_NOK;
+
+    /* Check for NULL pointers in the input parameters */
+    if(NULL == Index){
+        status = NODE_NULL_POINTER;
+    }
+    else{
+        free(Index->IndexSlots);
+        Index->IndexSlots = NULL;
+        Index->IndexCapacity = 0;
+        Index->IndexCount = 0;
+        status = NODE_OK;
+    }
+    return status;
+}
+
+/*
+   This function List_Index_Clear is responsible for removing every entry, which makes a stale index usable again.
+
+   Parameters:
+   - Index: A pointer to the index.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success or NODE_NULL_POINTER if Index is NULL.
+
+   Algorithm:
+   - The slot table keeps its size. Nothing is done when the index is already empty, so clearing is cheap for small lists.
+*/
+NodeStatus_t List_Index_Clear(ListIndex_t *Index){
+    NodeStatus_t status = NODE_NOK;
+
+    /* Check for NULL pointers in the input parameters */
+    if(NULL == Index){
+        status = NODE_NULL_POINTER;
+    }
+    else{
+        if((0U != Index->IndexCount)||(0U != Index->IndexStale)){
+            size_t counter = 0;
+
+            for(counter = 0; counter < Index->IndexCapacity; counter++){
+                Index->IndexSlots[counter].EntryNode = NULL;
+            }
+        }
+        Index->IndexCount = 0;
+        Index->IndexStale = 0U;
+        status = NODE_OK;
+    }
+    return status;
+}
+
+/*
+   This function List_Index_Add is responsible for indexing a node that was just linked into the list.
+
+   Parameters:
+   - Index: A pointer to the index.
+   - Node: A pointer to the new node.
+   - PrevNode: A pointer to its predecessor, or NULL if it is the head.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success (also when the index is already stale), NODE_NULL_POINTER if a pointer is NULL,
+                   or NODE_NOK if the table had to grow and could not; the index is then marked stale.
+
+   Algorithm:
+   - The table doubles before it gets more than half full, which keeps linear probes short.
+   - Equal values are stored in separate slots of the same probe sequence.
+*/
+NodeStatus_t List_Index_Add(ListIndex_t *Index, Node_t *Node, Node_t *PrevNode){
+    NodeStatus_t status = NODE_NOK;
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == Index)||(NULL == Node)){
+        status = NODE_NULL_POINTER;
+    }
+    else if(0U != Index->IndexStale){
+        status = NODE_OK;  // Not following the list any more
+    }
+    else{
+        status = NODE_OK;
+        if(((Index->IndexCount + 1U) * 2U) > Index->IndexCapacity){
+            status = List_Index_Resize(Index, Index->IndexCapacity * 2U);
+        }
+        if(NODE_OK == status){
+            ListIndexEntry_t Entry;
+
+            Entry.EntryNode = Node;
+            Entry.EntryPrev = PrevNode;
+            Entry.EntryKey = Node->NodeData;
+            List_Index_Place(Index, &Entry);
+            Index->IndexCount++;
+        }
+        else{
+            Index->IndexStale = 1U;  // Lookups walk the list from now on
+        }
+    }
+    return status;
+}
+
+/*
+   This function List_Index_Remove is responsible for dropping a node that is being unlinked from the list.
+
+   Parameters:
+   - Index: A pointer to the index.
+   - Node: A pointer to the node; its NodeData must not have changed since it was added.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success or when the index is stale, NODE_NULL_POINTER if a pointer is NULL,
+                   or NODE_NOK if the node is not indexed.
+
+   Algorithm:
+   - Backward-shift deletion: the entries after the freed slot that would no longer be reachable from their home slot
+     are moved back into the gap, so no tombstones are needed and probes never get longer over time.
+*/
+NodeStatus_t List_Index_Remove(ListIndex_t *Index, Node_t *Node){
+    NodeStatus_t status = NODE_NOK;
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == Index)||(NULL == Node)){
+        status = NODE_NULL_POINTER;
+    }
+    else if(0U != Index->IndexStale){
+        status = NODE_OK;
+    }
+    else{
+        size_t Mask = Index->IndexCapacity - 1U;
+        size_t Gap = List_Index_Locate(Index, Node);
+
+        if(Gap == Index->IndexCapacity){
+            status = NODE_NOK;  // Node is not indexed
+        }
+        else{
+            size_t Slot = (Gap + 1U) & Mask;
+
+            while (NULL != Index->IndexSlots[Slot].EntryNode)
+            {
+                size_t Home = List_Index_Home(Index, Index->IndexSlots[Slot].EntryKey);
+
+                if(((Slot - Home) & Mask) >= ((Slot - Gap) & Mask)){  /* Home is at or before the gap, move the entry back */
+                    Index->IndexSlots[Gap] = Index->IndexSlots[Slot];
+                    Gap = Slot;
+                }
+                Slot = (Slot + 1U) & Mask;
+            }
+            Index->IndexSlots[Gap].EntryNode = NULL;
+            Index->IndexCount--;
+            status = NODE_OK;
+        }
+    }
+    return status;
+}
+
+/*
+   This function List_Index_Set_Prev is responsible for recording a new predecessor of an indexed node,
+   after a node was linked or unlinked just before it.
+
+   Parameters:
+   - Index: A pointer to the index.
+   - Node: A pointer to the indexed node.
+   - PrevNode: A pointer to its new predecessor, or NULL if it became the head.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success or when the index is stale, NODE_NULL_POINTER if Index or Node is NULL,
+                   or NODE_NOK if the node is not indexed.
+*/
+NodeStatus_t List_Index_Set_Prev(ListIndex_t *Index, Node_t *Node, Node_t *PrevNode){
+    NodeStatus_t status = NODE_NOK;
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == Index)||(NULL == Node)){
+        status = NODE_NULL_POINTER;
+    }
+    else if(0U != Index->IndexStale){
+        status = NODE_OK;
+    }
+    else{
+        size_t Slot = List_Index_Locate(Index, Node);
+
+        if(Slot == Index->IndexCapacity){
+            status = NODE_NOK;  // Node is not indexed
+        }
+        else{
+            Index->IndexSlots[Slot].EntryPrev = PrevNode;
+            status = NODE_OK;
+        }
+    }
+    return status;
+}
+
+/*
+   This function List_Index_Find is responsible for looking up a node by value.
+
+   Parameters:
+   - Index: A pointer to the index.
+   - Value: The value to look for.
+   - Node: A double pointer that receives the node holding Value.
+   - PrevNode: A double pointer that receives its predecessor (NULL for the head), or NULL if it is not needed.
+
+   Return value:
+   - NodeStatus_t: NODE_OK if the value was found, NODE_NULL_POINTER if Index or Node is NULL,
+                   NODE_EMPTY if the index is stale (the caller has to walk the list), or NODE_NOK if the value is not in the list.
+
+   When several nodes hold Value, which one is returned is not specified.
+*/
+NodeStatus_t List_Index_Find(const ListIndex_t *Index, uint32_t Value, Node_t **Node, Node_t **PrevNode){
+    NodeStatus_t status = NODE_NOK;
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == Index)||(NULL == Node)){
+        status = NODE_NULL_POINTER;
+    }
+    else if(0U != Index->IndexStale){
+        status = NODE_EMPTY;
+    }
+    else{
+        size_t Mask = Index->IndexCapacity - 1U;
+        size_t Slot = List_Index_Home(Index, Value);
+
+        while ((NULL != Index->IndexSlots[Slot].EntryNode) && (Value != Index->IndexSlots[Slot].EntryKey))
+        {
+            Slot = (Slot + 1U) & Mask;  // Linear probing
+        }
+        if(NULL == Index->IndexSlots[Slot].EntryNode){
+            status = NODE_NOK;  // Empty slot reached, the value is not indexed
+        }
+        else{
+            *Node = Index->IndexSlots[Slot].EntryNode;
+            if(NULL != PrevNode){
+                *PrevNode = Index->IndexSlots[Slot].EntryPrev;
+            }
+            status = NODE_OK;
+        }
+    }
+    return status;
+}
\ No newline at end of file
@@ -0,0 +1,68 @@
+/* 
+ * File:   ListIndex.h
+ * Author: Mohammed Khairallah
+ * linkedin : linkedin.com/in/mohammed-khairallah
+ * Created on October 21, 2026, 2:00 PM
+ */
+#ifndef _LISTINDEX_H
+#define _LISTINDEX_H
+
+/* Section : Includes */
+#include "SingleLinkedList.h"
+
+/* Section : Macro Declarations */
+
+#define LIST_INDEX_MIN_CAPACITY (16U)  /* Smallest slot table, always a power of two */
+
+/* Section : Macro Functions Declarations */
+
+
+/* Section : Data type Declarations */
+
+/* 
+   This typedef struct represents one slot of a list index.
+
+   Explanation of members:
+   - EntryKey: A copy of EntryNode->NodeData, so probing does not have to load the node.
+   - EntryNode: The indexed node, or NULL for an empty slot.
+   - EntryPrev: The node before EntryNode in the list, or NULL when EntryNode is the head.
+                Keeping it is what makes deleting by value O(1) on a singly linked list.
+*/
+typedef struct{
+    Node_t *EntryNode;  /* indexed node, NULL for an empty slot */
+    Node_t *EntryPrev;  /* predecessor of EntryNode */
+    uint32_t EntryKey;  /* NodeData of EntryNode */
+}ListIndexEntry_t;
+
+/* 
+   This typedef struct represents an open-addressing hash index from node values to the nodes of a List_t.
+   It is attached to a list with List_Use_Index, and from then on every List_ function keeps it in sync,
+   so List_Find_By_Value and List_Delete_By_Value are O(1) on average instead of a walk.
+
+   Explanation of members:
+   - IndexSlots: The slot table (linear probing, one slot per node, so equal values get one slot each).
+   - IndexCapacity: The number of slots, a power of two; the table doubles once it is half full.
+   - IndexCount: The number of nodes indexed.
+   - IndexShift: 32 - log2(IndexCapacity), used by the multiplicative hash.
+   - IndexStale: Set to 1 once the table could not grow. The index then stops following the list and lookups fall back
+                 to walking it, until List_Clear or List_Use_Index rebuilds it.
+*/
+typedef struct ListIndex{
+    ListIndexEntry_t *IndexSlots;  /* slot table */
+    size_t IndexCapacity;          /* number of slots */
+    size_t IndexCount;             /* number of indexed nodes */
+    uint32_t IndexShift;           /* hash shift for IndexCapacity */
+    boolean IndexStale;            /* 1 when the index no longer matches its list */
+}ListIndex_t;
+
+/* Section : Functions Declaration */
+
+NodeStatus_t List_Index_Init(ListIndex_t *Index, size_t Capacity);
+NodeStatus_t List_Index_Destroy(ListIndex_t *Index);
+NodeStatus_t List_Index_Clear(ListIndex_t *Index);
+NodeStatus_t List_Index_Add(ListIndex_t *Index, Node_t *Node, Node_t *PrevNode);
+NodeStatus_t List_Index_Remove(ListIndex_t *Index, Node_t *Node);
+NodeStatus_t List_Index_Set_Prev(ListIndex_t *Index, Node_t *Node, Node_t *PrevNode);
+NodeStatus_t List_Index_Find(const ListIndex_t *Index, uint32_t Value, Node_t **Node, Node_t **PrevNode);
+
+#endif  //_LISTINDEX_H
\ No newline at end of file
@@ -0,0 +1,588 @@
+/* 
+ * File:   ListParallel.c
+ * Author: Mohammed Khairallah
+ * linkedin : linkedin.com/in/mohammed-khairallah
+ * Created on October 26, 2026, 2:00 PM
+ */
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "ListParallel.h"
+
+/*
+   An operation is described by a ParallelJob_t and handed to every thread of the pool. Threads take segments with an
+   atomic increment of JobNext until none is left, and run JobRun on each one. Whatever a segment produces goes to a
+   place of its own (its positions of the output array, its partial result, its row of histogram counts), so threads
+   never write to the same memory, and the calling thread merges the per-segment results in segment order once all
+   threads are done. Which thread ran which segment therefore never shows in the result.
+*/
+
+/* 
+   This typedef struct describes one parallel operation.
+*/
+typedef struct ParallelJob{
+    void (*JobRun)(struct ParallelJob *Job, size_t Segment, Node_t *FirstNode, size_t NodeCount);  /* per-segment work */
+    ListSegments_t *JobSegments;              /* boundaries of the list */
+    size_t JobNext;                           /* next segment to take, accessed atomically */
+    ParallelVisit_t JobVisit;                 /* Parallel_For_Each function */
+    ParallelMap_t JobMap;                     /* Parallel_Map function */
+    ParallelAccumulate_t JobAccumulate;       /* Parallel_Reduce function */
+    void *JobContext;                         /* context of the caller's function */
+    uint32_t *JobOutput;                      /* Parallel_Map results */
+    uint64_t JobIdentity;                     /* Parallel_Reduce starting value of every segment */
+    uint64_t *JobCounts;                      /* Parallel_Histogram rows, JobBucketCount counts per segment */
+    uint32_t JobBucketWidth;                  /* Parallel_Histogram values per bucket */
+    size_t JobBucketCount;                    /* Parallel_Histogram buckets */
+}ParallelJob_t;
+
+/* Function to run segments of a job until all of them are taken */
+static void Parallel_Run_Job(ParallelJob_t *Job){
+    ListSegments_t *Segments = Job->JobSegments;
+    size_t Segment = __atomic_fetch_add(&Job->JobNext, 1U, __ATOMIC_RELAXED);
+
+    while (Segment < Segments->SegmentUsed)
+    {
+        Job->JobRun(Job, Segment, Segments->SegmentFirst[Segment],
+                    Segments->SegmentStart[Segment + 1U] - Segments->SegmentStart[Segment]);
+        Segment = __atomic_fetch_add(&Job->JobNext, 1U, __ATOMIC_RELAXED);
+    }
+}
+
+/* Function run by every worker thread: wait for a job, help with it, report back, until the pool stops */
+static void *Parallel_Worker_Main(void *Argument){
+    ParallelPool_t *Pool = Argument;
+    uint64_t Seen = 0;  /* The pool starts at generation 0, even if this thread starts late */
+
+    pthread_mutex_lock(&Pool->PoolLock);
+    while (0U == Pool->PoolStop)
+    {
+        if(Seen == Pool->PoolGeneration){
+            pthread_cond_wait(&Pool->PoolWake, &Pool->PoolLock);
+        }
+        else{
+            ParallelJob_t *Job = Pool->PoolJob;
+
+            Seen = Pool->PoolGeneration;
+            pthread_mutex_unlock(&Pool->PoolLock);
+            Parallel_Run_Job(Job);
+            pthread_mutex_lock(&Pool->PoolLock);
+            Pool->PoolBusy--;
+            if(0U == Pool->PoolBusy){
+                pthread_cond_signal(&Pool->PoolDone);  // Last one out wakes the calling thread
+            }
+        }
+    }
+    pthread_mutex_unlock(&Pool->PoolLock);
+    return NULL;
+}
+
+/* Function to run a job on all threads of the pool, the calling thread included, and wait for it to finish */
+static void Parallel_Execute(ParallelPool_t *Pool, ParallelJob_t *Job){
+    Job->JobNext = 0;
+    if(Pool->PoolThreadCount > 1U){
+        pthread_mutex_lock(&Pool->PoolLock);
+        Pool->PoolJob = Job;
+        Pool->PoolBusy = Pool->PoolThreadCount - 1U;
+        Pool->PoolGeneration++;
+        pthread_cond_broadcast(&Pool->PoolWake);
+        pthread_mutex_unlock(&Pool->PoolLock);
+    }
+    Parallel_Run_Job(Job);
+    if(Pool->PoolThreadCount > 1U){
+        pthread_mutex_lock(&Pool->PoolLock);
+        while (0U != Pool->PoolBusy)
+        {
+            pthread_cond_wait(&Pool->PoolDone, &Pool->PoolLock);
+        }
+        Pool->PoolJob = NULL;
+        pthread_mutex_unlock(&Pool->PoolLock);
+    }
+}
+
+/* Function to make sure the segments describe the list as it is now, taking the boundaries again if it changed */
+static NodeStatus_t Parallel_Prepare(const List_t *List, ListSegments_t *Segments){
+    NodeStatus_t status = NODE_OK;
+
+    if((Segments->SegmentList != List) || (Segments->SegmentVersion != List->ListVersion)){
+        status = Parallel_Segments_Build(Segments, List);
+    }
+    if((NODE_OK == status) && (0U == Segments->SegmentUsed)){
+        status = NODE_EMPTY;
+    }
+    return status;
+}
+
+static void Parallel_For_Each_Segment(ParallelJob_t *Job, size_t Segment, Node_t *FirstNode, size_t NodeCount){
+    Node_t *NodeCopy = FirstNode;
+    size_t counter = 0;
+
+    (void)Segment;
+    for(counter = 0; counter < NodeCount; counter++){
+        Job->JobVisit(&NodeCopy->NodeData, Job->JobContext);
+        NodeCopy = NodeCopy->NodeLink;
+    }
+}
+
+static void Parallel_Map_Segment(ParallelJob_t *Job, size_t Segment, Node_t *FirstNode, size_t NodeCount){
+    uint32_t *Output = Job->JobOutput + Job->JobSegments->SegmentStart[Segment];
+    const Node_t *NodeCopy = FirstNode;
+    size_t counter = 0;
+
+    for(counter = 0; counter < NodeCount; counter++){
+        Output[counter] = Job->JobMap(NodeCopy->NodeData, Job->JobContext);
+        NodeCopy = NodeCopy->NodeLink;
+    }
+}
+
+static void Parallel_Reduce_Segment(ParallelJob_t *Job, size_t Segment, Node_t *FirstNode, size_t NodeCount){
+    uint64_t Partial = Job->JobIdentity;
+    const Node_t *NodeCopy = FirstNode;
+    size_t counter = 0;
+
+    for(counter = 0; counter < NodeCount; counter++){
+        Partial = Job->JobAccumulate(Partial, NodeCopy->NodeData, Job->JobContext);
+        NodeCopy = NodeCopy->NodeLink;
+    }
+    Job->JobSegments->SegmentPartial[Segment] = Partial;
+}
+
+static void Parallel_Histogram_Segment(ParallelJob_t *Job, size_t Segment, Node_t *FirstNode, size_t NodeCount){
+    uint64_t *Counts = Job->JobCounts + (Segment * Job->JobBucketCount);
+    const Node_t *NodeCopy = FirstNode;
+    size_t counter = 0;
+
+    for(counter = 0; counter < NodeCount; counter++){
+        size_t Bucket = NodeCopy->NodeData / Job->JobBucketWidth;
+
+        Counts[(Bucket < Job->JobBucketCount) ? Bucket : (Job->JobBucketCount - 1U)]++;
+        NodeCopy = NodeCopy->NodeLink;
+    }
+}
+
+/*
+   This function Parallel_Pool_Init is responsible for starting the worker threads of a pool.
+
+   Parameters:
+   - Pool: A pointer to the pool to set up.
+   - Threads: The number of threads operations run on, the calling thread included (1 to PARALLEL_MAX_THREADS);
+              0 takes the number of online processors.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if Pool is NULL,
+                   or NODE_NOK if Threads is too large or a thread could not be created (no thread is left running).
+*/
+NodeStatus_t Parallel_Pool_Init(ParallelPool_t *Pool, size_t Threads){
+    NodeStatus_t status = NODE_NOK;
+
+    /* Check for NULL pointers in the input parameters */
+    if(NULL == Pool){
+        status = NODE_NULL_POINTER;
+    }
+    else{
+        if(0U == Threads){
+            long Online = sysconf(_SC_NPROCESSORS_ONLN);
+
+            Threads = (Online > 0) ? (size_t)Online : 1U;
+            Threads = (Threads > PARALLEL_MAX_THREADS) ? PARALLEL_MAX_THREADS : Threads;
+        }
+        if(Threads > PARALLEL_MAX_THREADS){
+            status = NODE_NOK;
+        }
+        else{
+            size_t Created = 0;
+
+            pthread_mutex_init(&Pool->PoolLock, NULL);
+            pthread_cond_init(&Pool->PoolWake, NULL);
+            pthread_cond_init(&Pool->PoolDone, NULL);
+            Pool->PoolJob = NULL;
+            Pool->PoolGeneration = 0;
+            Pool->PoolBusy = 0;
+            Pool->PoolStop = 0;
+            Pool->PoolThreadCount = Threads;
+            status = NODE_OK;
+            while ((Created + 1U < Threads) && (NODE_OK == status))
+            {
+                if(0 != pthread_create(&Pool->PoolThreads[Created], NULL, Parallel_Worker_Main, Pool)){
+                    status = NODE_NOK;
+                }
+                else{
+                    Created++;
+                }
+            }
+            if(NODE_OK != status){
+                Pool->PoolThreadCount = Created + 1U;  // Only stop and join the threads that exist
+                Parallel_Pool_Destroy(Pool);
+            }
+        }
+    }
+    return status;
+}
+
+/*
+   This function Parallel_Pool_Destroy is responsible for stopping the worker threads of a pool.
+   No operation may be running on the pool.
+
+   Parameters:
+   - Pool: A pointer to the pool to stop.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success or NODE_NULL_POINTER if Pool is NULL.
+*/
+NodeStatus_t Parallel_Pool_Destroy(ParallelPool_t *Pool){
+    NodeStatus_t status = NODE_NOK;
+
+    /* Check for NULL pointers in the input parameters */
+    if(NULL == Pool){
+        status = NODE_NULL_POINTER;
+    }
+    else{
+        size_t counter = 0;
+
+        pthread_mutex_lock(&Pool->PoolLock);
+        Pool->PoolStop = 1;
+        pthread_cond_broadcast(&Pool->PoolWake);
+        pthread_mutex_unlock(&Pool->PoolLock);
+        for(counter = 0; (counter + 1U) < Pool->PoolThreadCount; counter++){
+            pthread_join(Pool->PoolThreads[counter], NULL);
+        }
+        pthread_cond_destroy(&Pool->PoolDone);
+        pthread_cond_destroy(&Pool->PoolWake);
+        pthread_mutex_destroy(&Pool->PoolLock);
+        Pool->PoolThreadCount = 0;
+        status = NODE_OK;
+    }
+    return status;
+}
+
+/*
+   This function Parallel_Segments_Init is responsible for allocating the boundary arrays of a ListSegments_t.
+
+   Parameters:
+   - Segments: A pointer to the segments to set up.
+   - Count: The number of segments a list is cut into; 0 takes PARALLEL_DEFAULT_SEGMENTS.
+            More segments than threads let fast threads take over work from slow ones, at the cost of a longer
+            combine step and one more boundary per segment.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if Segments is NULL, or NODE_NOK if memory allocation fails.
+*/
+NodeStatus_t Parallel_Segments_Init(ListSegments_t *Segments, size_t Count){
+    NodeStatus_t status = NODE_NOK;
+
+    /* Check for NULL pointers in the input parameters */
+    if(NULL == Segments){
+        status = NODE_NULL_POINTER;
+    }
+    else{
+        Count = (0U == Count) ? PARALLEL_DEFAULT_SEGMENTS : Count;
+        Segments->SegmentFirst = (Node_t **)malloc(Count * sizeof(Node_t *));
+        Segments->SegmentStart = (size_t *)malloc((Count + 1U) * sizeof(size_t));
+        Segments->SegmentPartial = (uint64_t *)malloc(Count * sizeof(uint64_t));
+        Segments->SegmentCapacity = Count;
+        Segments->SegmentUsed = 0;
+        Segments->SegmentList = NULL;
+        Segments->SegmentVersion = 0;
+        if((NULL == Segments->SegmentFirst) || (NULL == Segments->SegmentStart) || (NULL == Segments->SegmentPartial)){
+            Parallel_Segments_Destroy(Segments);
+            status = NODE_NOK;
+        }
+        else{
+            status = NODE_OK;
+        }
+    }
+    return status;
+}
+
+/*
+   This function Parallel_Segments_Build is responsible for cutting a list handle into segments of nearly equal length.
+   The operations call it themselves when the list changed, so it only needs to be called to take the boundaries
+   ahead of time (outside a timed or latency-sensitive part).
+
+   Parameters:
+   - Segments: A pointer to segments set up with Parallel_Segments_Init.
+   - List: A pointer to the list handle to cut.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success (also for an empty list, which has no segment),
+                   or NODE_NULL_POINTER if a pointer is NULL.
+
+   Algorithm:
+   - The list length is known from the handle, so the length of every segment is known before the walk:
+     Length / Count nodes, and one more for the first Length % Count segments.
+   - One walk over the list records the first node and position of every segment; the last segment is not walked.
+*/
+NodeStatus_t Parallel_Segments_Build(ListSegments_t *Segments, const List_t *List){
+    NodeStatus_t status = NODE_NOK;
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == Segments)||(NULL == List)){
+        status = NODE_NULL_POINTER;
+    }
+    else{
+        size_t Used = (List->ListLength < Segments->SegmentCapacity) ? List->ListLength : Segments->SegmentCapacity;
+        Node_t *NodeCopy = List->ListHead;
+        size_t Position = 0;
+        size_t counter = 0;
+
+        for(counter = 0; counter < Used; counter++){
+            size_t SegmentLength = (List->ListLength / Used) + ((counter < (List->ListLength % Used)) ? 1U : 0U);
+
+            Segments->SegmentFirst[counter] = NodeCopy;
+            Segments->SegmentStart[counter] = Position;
+            Position += SegmentLength;
+            if((counter + 1U) < Used){
+                while (SegmentLength > 0U)
+                {
+                    NodeCopy = NodeCopy->NodeLink;  // Move to the next node
+                    SegmentLength--;
+                }
+            }
+        }
+        Segments->SegmentStart[Used] = List->ListLength;
+        Segments->SegmentUsed = Used;
+        Segments->SegmentList = List;
+        Segments->SegmentVersion = List->ListVersion;
+        status = NODE_OK;
+    }
+    return status;
+}
+
+/*
+   This function Parallel_Segments_Destroy is responsible for freeing the boundary arrays of a ListSegments_t.
+
+   Parameters:
+   - Segments: A pointer to the segments to free.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success or NODE_NULL_POINTER if Segments is NULL.
+*/
+NodeStatus_t Parallel_Segments_Destroy(ListSegments_t *Segments){
+    NodeStatus_t status = NODE_NOK;
+
+    /* Check for NULL pointers in the input parameters */
+    if(NULL == Segments){
+        status = NODE_NULL_POINTER;
+    }
+    else{
+        free(Segments->SegmentFirst);
+        free(Segments->SegmentStart);
+        free(Segments->SegmentPartial);
+        Segments->SegmentFirst = NULL;
+        Segments->SegmentStart = NULL;
+        Segments->SegmentPartial = NULL;
+        Segments->SegmentCapacity = 0;
+        Segments->SegmentUsed = 0;
+        Segments->SegmentList = NULL;
+        status = NODE_OK;
+    }
+    return status;
+}
+
+/*
+   This function Parallel_For_Each is responsible for calling a function on every node of a list handle in parallel.
+
+   Parameters:
+   - Pool: A pointer to the thread pool to run on.
+   - List: A pointer to the list handle. Its nodes must not be linked or unlinked during the call.
+   - Segments: A pointer to segments set up with Parallel_Segments_Init; their boundaries are reused if still valid.
+   - Function: Called once per node with a pointer to its value. It runs on several threads at once, in no particular
+               order across segments, so anything it shares through Context must be safe for that.
+   - Context: Passed to Function.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_EMPTY for an empty list, or NODE_NULL_POINTER if a pointer is NULL.
+                   NODE_NOK if the values were visited but the attached index could not be rebuilt (it is then
+                   left stale and lookups walk the list).
+
+   Algorithm:
+   - The segments run on the pool. Afterwards ListVersion is incremented, since any value may have changed,
+     and an attached index (keyed by value) is rebuilt from the chain with List_Use_Index.
+*/
+NodeStatus_t Parallel_For_Each(ParallelPool_t *Pool, List_t *List, ListSegments_t *Segments,
+                               ParallelVisit_t Function, void *Context){
+    NodeStatus_t status = NODE_NOK;
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == Pool)||(NULL == List)||(NULL == Segments)||(NULL == Function)){
+        status = NODE_NULL_POINTER;
+    }
+    else{
+        status = Parallel_Prepare(List, Segments);
+        if(NODE_OK == status){
+            ParallelJob_t Job = {0};
+
+            Job.JobRun = Parallel_For_Each_Segment;
+            Job.JobSegments = Segments;
+            Job.JobVisit = Function;
+            Job.JobContext = Context;
+            Parallel_Execute(Pool, &Job);
+
+            /* Values changed behind the index and any other cached view of the list; the chain itself did not,
+               so these segments stay valid */
+            List->ListVersion++;
+            Segments->SegmentVersion = List->ListVersion;
+            if(NULL != List->ListIndex){
+                status = List_Use_Index(List, List->ListIndex);
+            }
+        }
+    }
+    return status;
+}
+
+/*
+   This function Parallel_Map is responsible for storing the result of a function of every value of a list handle
+   in an array, in list order, computed in parallel.
+
+   Parameters:
+   - Pool: A pointer to the thread pool to run on.
+   - List: A pointer to the list handle. Its nodes must not be linked or unlinked during the call.
+   - Segments: A pointer to segments set up with Parallel_Segments_Init; their boundaries are reused if still valid.
+   - Function: Called once per value; like for Parallel_For_Each it runs on several threads at once.
+   - Context: Passed to Function.
+   - Output: The array receiving Function of the value at position i + 1 at index i.
+   - Capacity: The number of values Output has room for.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_EMPTY for an empty list, NODE_NULL_POINTER if a pointer is NULL,
+                   or NODE_NOK if Output is shorter than the list.
+*/
+NodeStatus_t Parallel_Map(ParallelPool_t *Pool, const List_t *List, ListSegments_t *Segments,
+                          ParallelMap_t Function, void *Context, uint32_t *Output, size_t Capacity){
+    NodeStatus_t status = NODE_NOK;
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == Pool)||(NULL == List)||(NULL == Segments)||(NULL == Function)||(NULL == Output)){
+        status = NODE_NULL_POINTER;
+    }
+    else if(Capacity < List->ListLength){
+        status = NODE_NOK;
+    }
+    else{
+        status = Parallel_Prepare(List, Segments);
+        if(NODE_OK == status){
+            ParallelJob_t Job = {0};
+
+            Job.JobRun = Parallel_Map_Segment;
+            Job.JobSegments = Segments;
+            Job.JobMap = Function;
+            Job.JobContext = Context;
+            Job.JobOutput = Output;
+            Parallel_Execute(Pool, &Job);
+        }
+    }
+    return status;
+}
+
+/*
+   This function Parallel_Reduce is responsible for folding the values of a list handle into one result in parallel.
+
+   Parameters:
+   - Pool: A pointer to the thread pool to run on.
+   - List: A pointer to the list handle. Its nodes must not be linked or unlinked during the call.
+   - Segments: A pointer to segments set up with Parallel_Segments_Init; their boundaries are reused if still valid.
+   - Accumulate: Folds the values of one segment, in list order, into a partial result starting from Identity.
+   - Combine: Merges the partial result of each segment, in segment order, into the total starting from Identity.
+   - Identity: Starting value of every partial result and of the total (0 for a sum, 0xFFFFFFFF for a minimum ...).
+   - Context: Passed to Accumulate and Combine.
+   - Result: Receives the total (Identity for an empty list).
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_EMPTY for an empty list, or NODE_NULL_POINTER if a pointer is NULL.
+
+   Algorithm:
+   - The threads compute one partial result per segment, then the calling thread combines them from the first
+     segment to the last. The grouping of the values only depends on the list length and the segment count, so the
+     result is the same for every run and every thread count, even for a Combine that is not exactly associative
+     (floating-point sums); it is the serial fold when the segment count is 1.
+*/
+NodeStatus_t Parallel_Reduce(ParallelPool_t *Pool, const List_t *List, ListSegments_t *Segments,
+                             ParallelAccumulate_t Accumulate, ParallelCombine_t Combine, uint64_t Identity,
+                             void *Context, uint64_t *Result){
+    NodeStatus_t status = NODE_NOK;
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == Pool)||(NULL == List)||(NULL == Segments)||(NULL == Accumulate)||(NULL == Combine)||(NULL == Result)){
+        status = NODE_NULL_POINTER;
+    }
+    else{
+        *Result = Identity;
+        status = Parallel_Prepare(List, Segments);
+        if(NODE_OK == status){
+            ParallelJob_t Job = {0};
+            size_t counter = 0;
+
+            Job.JobRun = Parallel_Reduce_Segment;
+            Job.JobSegments = Segments;
+            Job.JobAccumulate = Accumulate;
+            Job.JobContext = Context;
+            Job.JobIdentity = Identity;
+            Parallel_Execute(Pool, &Job);
+            for(counter = 0; counter < Segments->SegmentUsed; counter++){
+                *Result = Combine(*Result, Segments->SegmentPartial[counter], Context);
+            }
+        }
+    }
+    return status;
+}
+
+/*
+   This function Parallel_Histogram is responsible for counting the values of a list handle per range in parallel.
+
+   Parameters:
+   - Pool: A pointer to the thread pool to run on.
+   - List: A pointer to the list handle. Its nodes must not be linked or unlinked during the call.
+   - Segments: A pointer to segments set up with Parallel_Segments_Init; their boundaries are reused if still valid.
+   - BucketWidth: The number of consecutive values per bucket: bucket i counts the values from i * BucketWidth
+                  to (i + 1) * BucketWidth - 1. Values past the last bucket are counted in the last bucket.
+   - BucketCount: The number of buckets.
+   - Counts: The array of BucketCount counts receiving the result.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_EMPTY for an empty list (all counts 0), NODE_NULL_POINTER if a pointer
+                   is NULL, or NODE_NOK if BucketWidth or BucketCount is 0 or memory allocation fails.
+
+   Algorithm:
+   - Every segment counts into a private row of BucketCount counts (one allocation per call), so no count is shared
+     between threads; the calling thread then adds the rows up.
+*/
+NodeStatus_t Parallel_Histogram(ParallelPool_t *Pool, const List_t *List, ListSegments_t *Segments,
+                                uint32_t BucketWidth, size_t BucketCount, uint64_t *Counts){
+    NodeStatus_t status = NODE_NOK;
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == Pool)||(NULL == List)||(NULL == Segments)||(NULL == Counts)){
+        status = NODE_NULL_POINTER;
+    }
+    else if((0U == BucketWidth)||(0U == BucketCount)){
+        status = NODE_NOK;
+    }
+    else{
+        memset(Counts, 0, BucketCount * sizeof(uint64_t));
+        status = Parallel_Prepare(List, Segments);
+        if(NODE_OK == status){
+            ParallelJob_t Job = {0};
+
+            Job.JobCounts = (uint64_t *)calloc(Segments->SegmentUsed * BucketCount, sizeof(uint64_t));
+            if(NULL == Job.JobCounts){
+                status = NODE_NOK;
+            }
+            else{
+                size_t counter = 0;
+                size_t Bucket = 0;
+
+                Job.JobRun = Parallel_Histogram_Segment;
+                Job.JobSegments = Segments;
+                Job.JobBucketWidth = BucketWidth;
+                Job.JobBucketCount = BucketCount;
+                Parallel_Execute(Pool, &Job);
+                for(counter = 0; counter < Segments->SegmentUsed; counter++){
+                    for(Bucket = 0; Bucket < BucketCount; Bucket++){
+                        Counts[Bucket] += Job.JobCounts[(counter * BucketCount) + Bucket];
+                    }
+                }
+                free(Job.JobCounts);
+            }
+        }
+    }
+    return status;
+}
\ No newline at end of file
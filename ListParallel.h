@@ -0,0 +1,110 @@
+/* 
+ * File:   ListParallel.h
+ * Author: Mohammed Khairallah
+ * linkedin : linkedin.com/in/mohammed-khairallah
+ * Created on October 26, 2026, 2:00 PM
+ */
+#ifndef _LISTPARALLEL_H
+#define _LISTPARALLEL_H
+
+/* Section : Includes */
+#include <pthread.h>
+#include "SingleLinkedList.h"
+
+/* Section : Macro Declarations */
+
+#define PARALLEL_MAX_THREADS (64U)          /* Highest thread count of a ParallelPool_t, the calling thread included */
+#define PARALLEL_DEFAULT_SEGMENTS (64U)     /* Segments per list when Parallel_Segments_Init is given 0 */
+
+/* Section : Macro Functions Declarations */
+
+
+/* Section : Data type Declarations */
+
+/* Function applied to every node by Parallel_For_Each; it may change the value in place (an index is rebuilt after) */
+typedef void (*ParallelVisit_t)(uint32_t *Data, void *Context);
+
+/* Function applied to every value by Parallel_Map; the result is stored at the position of the value */
+typedef uint32_t (*ParallelMap_t)(uint32_t Data, void *Context);
+
+/* Function folding one value into the partial result of a segment (Parallel_Reduce) */
+typedef uint64_t (*ParallelAccumulate_t)(uint64_t Partial, uint32_t Data, void *Context);
+
+/* Function merging the partial result of the next segment into the running total (Parallel_Reduce) */
+typedef uint64_t (*ParallelCombine_t)(uint64_t Total, uint64_t Partial, void *Context);
+
+/* 
+   This typedef struct represents a pool of worker threads that run the segments of a list operation.
+
+   Explanation of members:
+   - PoolThreads: The worker threads; the thread that starts an operation works as well, so there are PoolThreadCount - 1.
+   - PoolThreadCount: The number of threads an operation runs on, the calling thread included (1 = no workers).
+   - PoolLock / PoolWake / PoolDone: Guard the members below; workers wait on PoolWake for a job, and the calling
+                                     thread waits on PoolDone for the workers to finish it.
+   - PoolJob: The operation being run, NULL between operations.
+   - PoolGeneration: Incremented for every operation, so a worker never runs the same job twice.
+   - PoolBusy: The number of workers still running the current job.
+   - PoolStop: Set by Parallel_Pool_Destroy to end the workers.
+
+   Workers are created once and sleep between operations. Within an operation every thread takes the next segment
+   that nobody has taken yet (one atomic increment), so a thread that is slowed down gets fewer segments.
+   A pool runs one operation at a time: it must not be used by several threads at once.
+*/
+typedef struct ParallelPool{
+    pthread_t PoolThreads[PARALLEL_MAX_THREADS];  /* workers */
+    size_t PoolThreadCount;                       /* threads per operation, caller included */
+    pthread_mutex_t PoolLock;                     /* guards the members below */
+    pthread_cond_t PoolWake;                      /* signalled when a job is posted or the pool stops */
+    pthread_cond_t PoolDone;                      /* signalled when the last worker finishes a job */
+    struct ParallelJob *PoolJob;                  /* current operation */
+    uint64_t PoolGeneration;                      /* operations posted so far */
+    size_t PoolBusy;                              /* workers still on the current operation */
+    boolean PoolStop;                             /* 1 once the pool is being destroyed */
+}ParallelPool_t;
+
+/* 
+   This typedef struct holds the boundaries of a list handle cut into segments of nearly equal length.
+
+   Explanation of members:
+   - SegmentFirst: The first node of every segment.
+   - SegmentStart: The 0-based position of the first node of every segment, plus the list length as entry SegmentUsed.
+   - SegmentPartial: One partial result per segment, used by Parallel_Reduce.
+   - SegmentCapacity: The number of segments the arrays have room for.
+   - SegmentUsed: The number of segments of the list (fewer than SegmentCapacity for a list shorter than that).
+   - SegmentList / SegmentVersion: The list handle and its ListVersion when the boundaries were taken.
+
+   Boundaries are found with one walk over the list and kept: every operation given the same ListSegments_t reuses
+   them as long as the list has not been changed structurally (the version still matches), and takes them again
+   otherwise. The segments only depend on the list length and SegmentCapacity, never on the number of threads,
+   so the results of Parallel_Reduce do not either.
+*/
+typedef struct{
+    Node_t **SegmentFirst;      /* first node per segment */
+    size_t *SegmentStart;       /* first position per segment, SegmentUsed + 1 entries */
+    uint64_t *SegmentPartial;   /* partial result per segment */
+    size_t SegmentCapacity;     /* room in the arrays */
+    size_t SegmentUsed;         /* segments in use */
+    const List_t *SegmentList;  /* list the boundaries belong to */
+    size_t SegmentVersion;      /* ListVersion of that list at the time */
+}ListSegments_t;
+
+/* Section : Functions Declaration */
+
+NodeStatus_t Parallel_Pool_Init(ParallelPool_t *Pool, size_t Threads);
+NodeStatus_t Parallel_Pool_Destroy(ParallelPool_t *Pool);
+
+NodeStatus_t Parallel_Segments_Init(ListSegments_t *Segments, size_t Count);
+NodeStatus_t Parallel_Segments_Build(ListSegments_t *Segments, const List_t *List);
+NodeStatus_t Parallel_Segments_Destroy(ListSegments_t *Segments);
+
+NodeStatus_t Parallel_For_Each(ParallelPool_t *Pool, List_t *List, ListSegments_t *Segments,
+                               ParallelVisit_t Function, void *Context);
+NodeStatus_t Parallel_Map(ParallelPool_t *Pool, const List_t *List, ListSegments_t *Segments,
+                          ParallelMap_t Function, void *Context, uint32_t *Output, size_t Capacity);
+NodeStatus_t Parallel_Reduce(ParallelPool_t *Pool, const List_t *List, ListSegments_t *Segments,
+                             ParallelAccumulate_t Accumulate, ParallelCombine_t Combine, uint64_t Identity,
+                             void *Context, uint64_t *Result);
+NodeStatus_t Parallel_Histogram(ParallelPool_t *Pool, const List_t *List, ListSegments_t *Segments,
+                                uint32_t BucketWidth, size_t BucketCount, uint64_t *Counts);
+
+#endif  //_LISTPARALLEL_H
\ No newline at end of file
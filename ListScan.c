@@ -0,0 +1,639 @@
+/* 
+ * File:   ListScan.c
+ * Author: Mohammed Khairallah
+ * linkedin : linkedin.com/in/mohammed-khairallah
+ * Created on October 22, 2026, 10:00 AM
+ */
+#include "ListScan.h"
+
+#if SCAN_HAVE_SSE2
+#include <immintrin.h>
+#endif
+
+#define SCAN_COUNT_FLUSH (65536U)  /* Vectors counted in 32-bit lanes before they are added to the total */
+
+#if SCAN_HAVE_AVX2
+#define SCAN_AVX2_FUNCTION __attribute__((target("avx2")))
+#endif
+
+static ScanLevel_t Scan_Level = SCAN_LEVEL_AUTO;  /* Level forced with Scan_Set_Level */
+
+/* Section : Scalar kernels (the reference, also used for the tails of the vector kernels) */
+
+static size_t Scan_Find_Scalar(const uint32_t *Data, size_t Count, uint32_t Value){
+    size_t Index = 0;
+
+    while ((Index < Count) && (Data[Index] != Value))
+    {
+        Index++;
+    }
+    return Index;
+}
+
+static size_t Scan_Count_Scalar(const uint32_t *Data, size_t Count, uint32_t Value){
+    size_t Matches = 0;
+    size_t counter = 0;
+
+    for(counter = 0; counter < Count; counter++){
+        Matches += (Data[counter] == Value) ? 1U : 0U;
+    }
+    return Matches;
+}
+
+static void Scan_Min_Max_Scalar(const uint32_t *Data, size_t Count, uint32_t *Min, uint32_t *Max){
+    uint32_t l_Min = *Min;
+    uint32_t l_Max = *Max;
+    size_t counter = 0;
+
+    for(counter = 0; counter < Count; counter++){
+        l_Min = (Data[counter] < l_Min) ? Data[counter] : l_Min;
+        l_Max = (Data[counter] > l_Max) ? Data[counter] : l_Max;
+    }
+    *Min = l_Min;
+    *Max = l_Max;
+}
+
+static uint64_t Scan_Sum_Scalar(const uint32_t *Data, size_t Count){
+    uint64_t Sum = 0;
+    size_t counter = 0;
+
+    for(counter = 0; counter < Count; counter++){
+        Sum += Data[counter];
+    }
+    return Sum;
+}
+
+static const ScanKernels_t Scan_Scalar_Kernels = {
+    Scan_Find_Scalar, Scan_Count_Scalar, Scan_Min_Max_Scalar, Scan_Sum_Scalar
+};
+
+#if SCAN_HAVE_SSE2
+/* Section : SSE2 kernels, 4 values per vector, unaligned loads (unrolled nodes store their values at offset 12) */
+
+/*
+   Find: 16 values are compared per step and only tested once, so the loop runs at load throughput;
+   the step that holds a match is searched again 4 values at a time to get the exact index.
+*/
+static size_t Scan_Find_Sse2(const uint32_t *Data, size_t Count, uint32_t Value){
+    __m128i Needle = _mm_set1_epi32((int)Value);
+    size_t Index = 0;
+    int Mask = 0;
+
+    while ((Index + 16U) <= Count)
+    {
+        __m128i Hit01 = _mm_or_si128(_mm_cmpeq_epi32(_mm_loadu_si128((const __m128i *)&Data[Index]), Needle),
+                                     _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i *)&Data[Index + 4U]), Needle));
+        __m128i Hit23 = _mm_or_si128(_mm_cmpeq_epi32(_mm_loadu_si128((const __m128i *)&Data[Index + 8U]), Needle),
+                                     _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i *)&Data[Index + 12U]), Needle));
+
+        if(0 != _mm_movemask_epi8(_mm_or_si128(Hit01, Hit23))){
+            break;  // A match is in these 16 values
+        }
+        Index += 16U;
+    }
+    while (((Index + 4U) <= Count) && (0 == Mask))
+    {
+        Mask = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(_mm_loadu_si128((const __m128i *)&Data[Index]), Needle)));
+        Index += (0 == Mask) ? 4U : (size_t)__builtin_ctz((unsigned int)Mask);
+    }
+    if(0 == Mask){
+        Index += Scan_Find_Scalar(&Data[Index], Count - Index, Value);
+    }
+    return Index;
+}
+
+/* Count: every matching lane subtracts -1 from its 32-bit counter; the counters are added up every SCAN_COUNT_FLUSH vectors */
+static size_t Scan_Count_Sse2(const uint32_t *Data, size_t Count, uint32_t Value){
+    __m128i Needle = _mm_set1_epi32((int)Value);
+    size_t Matches = 0;
+    size_t Index = 0;
+
+    while ((Index + 4U) <= Count)
+    {
+        __m128i Lanes = _mm_setzero_si128();
+        uint32_t Partial[4];
+        size_t Vectors = 0;
+
+        while (((Index + 4U) <= Count) && (Vectors < SCAN_COUNT_FLUSH))
+        {
+            Lanes = _mm_sub_epi32(Lanes, _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i *)&Data[Index]), Needle));
+            Index += 4U;
+            Vectors++;
+        }
+        _mm_storeu_si128((__m128i *)Partial, Lanes);
+        Matches += (size_t)Partial[0] + Partial[1] + Partial[2] + Partial[3];
+    }
+    return Matches + Scan_Count_Scalar(&Data[Index], Count - Index, Value);
+}
+
+/* Min / max: SSE2 only compares signed lanes, so the sign bit is flipped to order unsigned values correctly */
+static void Scan_Min_Max_Sse2(const uint32_t *Data, size_t Count, uint32_t *Min, uint32_t *Max){
+    __m128i Flip = _mm_set1_epi32((int)0x80000000U);
+    __m128i Low = _mm_set1_epi32((int)(*Min ^ 0x80000000U));
+    __m128i High = _mm_set1_epi32((int)(*Max ^ 0x80000000U));
+    uint32_t LowLanes[4];
+    uint32_t HighLanes[4];
+    size_t Index = 0;
+    size_t counter = 0;
+
+    while ((Index + 4U) <= Count)
+    {
+        __m128i Values = _mm_xor_si128(_mm_loadu_si128((const __m128i *)&Data[Index]), Flip);
+        __m128i Below = _mm_cmpgt_epi32(Low, Values);
+        __m128i Above = _mm_cmpgt_epi32(Values, High);
+
+        Low = _mm_or_si128(_mm_and_si128(Below, Values), _mm_andnot_si128(Below, Low));
+        High = _mm_or_si128(_mm_and_si128(Above, Values), _mm_andnot_si128(Above, High));
+        Index += 4U;
+    }
+    _mm_storeu_si128((__m128i *)LowLanes, _mm_xor_si128(Low, Flip));
+    _mm_storeu_si128((__m128i *)HighLanes, _mm_xor_si128(High, Flip));
+    for(counter = 0; counter < 4U; counter++){
+        *Min = (LowLanes[counter] < *Min) ? LowLanes[counter] : *Min;
+        *Max = (HighLanes[counter] > *Max) ? HighLanes[counter] : *Max;
+    }
+    Scan_Min_Max_Scalar(&Data[Index], Count - Index, Min, Max);
+}
+
+/* Sum: values are widened to 64-bit lanes by interleaving them with zeros, so the sum cannot overflow */
+static uint64_t Scan_Sum_Sse2(const uint32_t *Data, size_t Count){
+    __m128i Zero = _mm_setzero_si128();
+    __m128i SumLow = _mm_setzero_si128();
+    __m128i SumHigh = _mm_setzero_si128();
+    uint64_t Lanes[2];
+    size_t Index = 0;
+
+    while ((Index + 4U) <= Count)
+    {
+        __m128i Values = _mm_loadu_si128((const __m128i *)&Data[Index]);
+
+        SumLow = _mm_add_epi64(SumLow, _mm_unpacklo_epi32(Values, Zero));
+        SumHigh = _mm_add_epi64(SumHigh, _mm_unpackhi_epi32(Values, Zero));
+        Index += 4U;
+    }
+    _mm_storeu_si128((__m128i *)Lanes, _mm_add_epi64(SumLow, SumHigh));
+    return Lanes[0] + Lanes[1] + Scan_Sum_Scalar(&Data[Index], Count - Index);
+}
+
+static const ScanKernels_t Scan_Sse2_Kernels = {
+    Scan_Find_Sse2, Scan_Count_Sse2, Scan_Min_Max_Sse2, Scan_Sum_Sse2
+};
+#endif
+
+#if SCAN_HAVE_AVX2
+/* Section : AVX2 kernels, 8 values per vector; built with the target attribute and only used after a CPU check */
+
+SCAN_AVX2_FUNCTION static size_t Scan_Find_Avx2(const uint32_t *Data, size_t Count, uint32_t Value){
+    __m256i Needle = _mm256_set1_epi32((int)Value);
+    size_t Index = 0;
+    int Mask = 0;
+
+    while ((Index + 32U) <= Count)
+    {
+        __m256i Hit01 = _mm256_or_si256(_mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i *)&Data[Index]), Needle),
+                                        _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i *)&Data[Index + 8U]), Needle));
+        __m256i Hit23 = _mm256_or_si256(_mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i *)&Data[Index + 16U]), Needle),
+                                        _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i *)&Data[Index + 24U]), Needle));
+
+        if(0 == _mm256_testz_si256(_mm256_or_si256(Hit01, Hit23), _mm256_or_si256(Hit01, Hit23))){
+            break;  // A match is in these 32 values
+        }
+        Index += 32U;
+    }
+    while (((Index + 8U) <= Count) && (0 == Mask))
+    {
+        Mask = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i *)&Data[Index]), Needle)));
+        Index += (0 == Mask) ? 8U : (size_t)__builtin_ctz((unsigned int)Mask);
+    }
+    if(0 == Mask){
+        Index += Scan_Find_Scalar(&Data[Index], Count - Index, Value);
+    }
+    return Index;
+}
+
+SCAN_AVX2_FUNCTION static size_t Scan_Count_Avx2(const uint32_t *Data, size_t Count, uint32_t Value){
+    __m256i Needle = _mm256_set1_epi32((int)Value);
+    size_t Matches = 0;
+    size_t Index = 0;
+
+    while ((Index + 8U) <= Count)
+    {
+        __m256i Lanes = _mm256_setzero_si256();
+        uint32_t Partial[8];
+        size_t Vectors = 0;
+        size_t counter = 0;
+
+        while (((Index + 8U) <= Count) && (Vectors < SCAN_COUNT_FLUSH))
+        {
+            Lanes = _mm256_sub_epi32(Lanes, _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i *)&Data[Index]), Needle));
+            Index += 8U;
+            Vectors++;
+        }
+        _mm256_storeu_si256((__m256i *)Partial, Lanes);
+        for(counter = 0; counter < 8U; counter++){
+            Matches += Partial[counter];
+        }
+    }
+    return Matches + Scan_Count_Scalar(&Data[Index], Count - Index, Value);
+}
+
+SCAN_AVX2_FUNCTION static void Scan_Min_Max_Avx2(const uint32_t *Data, size_t Count, uint32_t *Min, uint32_t *Max){
+    __m256i Low = _mm256_set1_epi32((int)*Min);
+    __m256i High = _mm256_set1_epi32((int)*Max);
+    uint32_t LowLanes[8];
+    uint32_t HighLanes[8];
+    size_t Index = 0;
+    size_t counter = 0;
+
+    while ((Index + 8U) <= Count)
+    {
+        __m256i Values = _mm256_loadu_si256((const __m256i *)&Data[Index]);
+
+        Low = _mm256_min_epu32(Low, Values);
+        High = _mm256_max_epu32(High, Values);
+        Index += 8U;
+    }
+    _mm256_storeu_si256((__m256i *)LowLanes, Low);
+    _mm256_storeu_si256((__m256i *)HighLanes, High);
+    for(counter = 0; counter < 8U; counter++){
+        *Min = (LowLanes[counter] < *Min) ? LowLanes[counter] : *Min;
+        *Max = (HighLanes[counter] > *Max) ? HighLanes[counter] : *Max;
+    }
+    Scan_Min_Max_Scalar(&Data[Index], Count - Index, Min, Max);
+}
+
+SCAN_AVX2_FUNCTION static uint64_t Scan_Sum_Avx2(const uint32_t *Data, size_t Count){
+    __m256i SumLow = _mm256_setzero_si256();
+    __m256i SumHigh = _mm256_setzero_si256();
+    uint64_t Lanes[4];
+    size_t Index = 0;
+
+    while ((Index + 8U) <= Count)
+    {
+        __m256i Values = _mm256_loadu_si256((const __m256i *)&Data[Index]);
+
+        SumLow = _mm256_add_epi64(SumLow, _mm256_cvtepu32_epi64(_mm256_castsi256_si128(Values)));
+        SumHigh = _mm256_add_epi64(SumHigh, _mm256_cvtepu32_epi64(_mm256_extracti128_si256(Values, 1)));
+        Index += 8U;
+    }
+    _mm256_storeu_si256((__m256i *)Lanes, _mm256_add_epi64(SumLow, SumHigh));
+    return Lanes[0] + Lanes[1] + Lanes[2] + Lanes[3] + Scan_Sum_Scalar(&Data[Index], Count - Index);
+}
+
+static const ScanKernels_t Scan_Avx2_Kernels = {
+    Scan_Find_Avx2, Scan_Count_Avx2, Scan_Min_Max_Avx2, Scan_Sum_Avx2
+};
+#endif
+
+/* Section : Level selection */
+
+/* Function to find the best level this build and this CPU support */
+static ScanLevel_t Scan_Best_Level(void){
+    ScanLevel_t Level = SCAN_LEVEL_SCALAR;
+
+#if SCAN_HAVE_SSE2
+    Level = SCAN_LEVEL_SSE2;
+#endif
+#if SCAN_HAVE_AVX2
+    if(__builtin_cpu_supports("avx2")){
+        Level = SCAN_LEVEL_AVX2;
+    }
+#endif
+    return Level;
+}
+
+/*
+   This function Scan_Set_Level is responsible for forcing the kernels of one level, mainly to compare them in benchmarks.
+   It is not thread-safe: call it before scans start on other threads.
+
+   Parameters:
+   - Level: The level to use, or SCAN_LEVEL_AUTO to go back to the best supported one.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, or NODE_NOK if this build or this CPU does not support Level (nothing changes then).
+*/
+NodeStatus_t Scan_Set_Level(ScanLevel_t Level){
+    NodeStatus_t status = NODE_NOK;
+
+    if((SCAN_LEVEL_AUTO == Level)||((Level >= SCAN_LEVEL_SCALAR) && (Level <= Scan_Best_Level()))){
+        Scan_Level = Level;
+        status = NODE_OK;
+    }
+    return status;
+}
+
+/* Function to report the level the scans currently run at (never SCAN_LEVEL_AUTO) */
+ScanLevel_t Scan_Get_Level(void){
+    return (SCAN_LEVEL_AUTO == Scan_Level) ? Scan_Best_Level() : Scan_Level;
+}
+
+/* Function to get the kernels of the current level, for callers that scan many blocks */
+const ScanKernels_t *Scan_Get_Kernels(void){
+    const ScanKernels_t *Kernels = &Scan_Scalar_Kernels;
+
+    switch(Scan_Get_Level()){
+#if SCAN_HAVE_AVX2
+        case SCAN_LEVEL_AVX2: Kernels = &Scan_Avx2_Kernels; break;
+#endif
+#if SCAN_HAVE_SSE2
+        case SCAN_LEVEL_SSE2: Kernels = &Scan_Sse2_Kernels; break;
+#endif
+        default: Kernels = &Scan_Scalar_Kernels; break;
+    }
+    return Kernels;
+}
+
+/* Section : Arrays */
+
+/*
+   This function Scan_Find is responsible for finding the first occurrence of a value in an array,
+   such as a snapshot view (ListSnapshot.h) or the output of Extract_Nodes.
+
+   Parameters:
+   - Data / Count: The values.
+   - Value: The value to look for.
+   - NodePosition: A pointer that receives the 1-based position of the first match, as for Find_By_Value.
+
+   Return value:
+   - NodeStatus_t: NODE_OK if the value was found, NODE_NULL_POINTER if a pointer is NULL,
+                   NODE_EMPTY if Count is 0, or NODE_NOK if the value is not there.
+*/
+NodeStatus_t Scan_Find(const uint32_t *Data, size_t Count, uint32_t Value, size_t *NodePosition){
+    NodeStatus_t status = NODE_NOK;
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == Data)||(NULL == NodePosition)){
+        status = NODE_NULL_POINTER;
+    }
+    else if(0U == Count){
+        status = NODE_EMPTY;
+    }
+    else{
+        size_t Index = Scan_Get_Kernels()->KernelFind(Data, Count, Value);
+
+        if(Index == Count){
+            status = NODE_NOK;  // Value not found
+        }
+        else{
+            *NodePosition = Index + 1U;
+            status = NODE_OK;
+        }
+    }
+    return status;
+}
+
+/*
+   This function Scan_Count is responsible for counting the values of an array equal to a given value.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if a pointer is NULL, or NODE_EMPTY if Count is 0 (*Matches = 0).
+*/
+NodeStatus_t Scan_Count(const uint32_t *Data, size_t Count, uint32_t Value, size_t *Matches){
+    NodeStatus_t status = NODE_NOK;
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == Data)||(NULL == Matches)){
+        status = NODE_NULL_POINTER;
+    }
+    else{
+        *Matches = Scan_Get_Kernels()->KernelCount(Data, Count, Value);
+        status = (0U == Count) ? NODE_EMPTY : NODE_OK;
+    }
+    return status;
+}
+
+/*
+   This function Scan_Min_Max is responsible for finding the smallest and the largest value of an array in one pass.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if a pointer is NULL,
+                   or NODE_EMPTY if Count is 0 (*Min and *Max are not changed).
+*/
+NodeStatus_t Scan_Min_Max(const uint32_t *Data, size_t Count, uint32_t *Min, uint32_t *Max){
+    NodeStatus_t status = NODE_NOK;
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == Data)||(NULL == Min)||(NULL == Max)){
+        status = NODE_NULL_POINTER;
+    }
+    else if(0U == Count){
+        status = NODE_EMPTY;
+    }
+    else{
+        *Min = 0xFFFFFFFFU;
+        *Max = 0U;
+        Scan_Get_Kernels()->KernelMinMax(Data, Count, Min, Max);
+        status = NODE_OK;
+    }
+    return status;
+}
+
+/*
+   This function Scan_Sum is responsible for adding up the values of an array; the 64-bit sum cannot overflow
+   below 2^32 values.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if a pointer is NULL, or NODE_EMPTY if Count is 0 (*Sum = 0).
+*/
+NodeStatus_t Scan_Sum(const uint32_t *Data, size_t Count, uint64_t *Sum){
+    NodeStatus_t status = NODE_NOK;
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == Data)||(NULL == Sum)){
+        status = NODE_NULL_POINTER;
+    }
+    else{
+        *Sum = Scan_Get_Kernels()->KernelSum(Data, Count);
+        status = (0U == Count) ? NODE_EMPTY : NODE_OK;
+    }
+    return status;
+}
+
+/* Section : Unrolled lists, one kernel call per node (the kernels are looked up once per scan) */
+
+/*
+   This function Scan_Unrolled_Find is responsible for finding the first occurrence of a value in an unrolled list.
+
+   Parameters:
+   - List: A pointer to the unrolled list handle.
+   - Value: The value to look for.
+   - NodePosition: A pointer that receives the 1-based position of the first match.
+
+   Return value:
+   - NodeStatus_t: NODE_OK if the value was found, NODE_NULL_POINTER if a pointer is NULL,
+                   NODE_EMPTY if the list is empty, or NODE_NOK if the value is not there.
+*/
+NodeStatus_t Scan_Unrolled_Find(const UnrolledList_t *List, uint32_t Value, size_t *NodePosition){
+    NodeStatus_t status = NODE_NOK;
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == List)||(NULL == NodePosition)){
+        status = NODE_NULL_POINTER;
+    }
+    else if(NULL == List->ListHead){
+        status = NODE_EMPTY;
+    }
+    else{
+        const ScanKernels_t *Kernels = Scan_Get_Kernels();
+        const UnrolledNode_t *Node = List->ListHead;
+        size_t Offset = 0;
+        size_t Index = 0;
+
+        while ((NULL != Node) && (NODE_OK != status))
+        {
+            Index = Kernels->KernelFind(Node->NodeData, Node->NodeCount, Value);
+            if(Index < Node->NodeCount){
+                *NodePosition = Offset + Index + 1U;
+                status = NODE_OK;
+            }
+            Offset += Node->NodeCount;
+            Node = Node->NodeLink;
+        }
+    }
+    return status;
+}
+
+/* Function to count the values of an unrolled list equal to Value; NODE_EMPTY for an empty list (*Matches = 0) */
+NodeStatus_t Scan_Unrolled_Count(const UnrolledList_t *List, uint32_t Value, size_t *Matches){
+    NodeStatus_t status = NODE_NOK;
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == List)||(NULL == Matches)){
+        status = NODE_NULL_POINTER;
+    }
+    else{
+        const ScanKernels_t *Kernels = Scan_Get_Kernels();
+        const UnrolledNode_t *Node = List->ListHead;
+
+        *Matches = 0;
+        while (NULL != Node)
+        {
+            *Matches += Kernels->KernelCount(Node->NodeData, Node->NodeCount, Value);
+            Node = Node->NodeLink;
+        }
+        status = (NULL == List->ListHead) ? NODE_EMPTY : NODE_OK;
+    }
+    return status;
+}
+
+/* Function to find the smallest and largest value of an unrolled list; NODE_EMPTY for an empty list (nothing changed) */
+NodeStatus_t Scan_Unrolled_Min_Max(const UnrolledList_t *List, uint32_t *Min, uint32_t *Max){
+    NodeStatus_t status = NODE_NOK;
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == List)||(NULL == Min)||(NULL == Max)){
+        status = NODE_NULL_POINTER;
+    }
+    else if(NULL == List->ListHead){
+        status = NODE_EMPTY;
+    }
+    else{
+        const ScanKernels_t *Kernels = Scan_Get_Kernels();
+        const UnrolledNode_t *Node = List->ListHead;
+
+        *Min = 0xFFFFFFFFU;
+        *Max = 0U;
+        while (NULL != Node)
+        {
+            Kernels->KernelMinMax(Node->NodeData, Node->NodeCount, Min, Max);
+            Node = Node->NodeLink;
+        }
+        status = NODE_OK;
+    }
+    return status;
+}
+
+/* Function to add up the values of an unrolled list; NODE_EMPTY for an empty list (*Sum = 0) */
+NodeStatus_t Scan_Unrolled_Sum(const UnrolledList_t *List, uint64_t *Sum){
+    NodeStatus_t status = NODE_NOK;
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == List)||(NULL == Sum)){
+        status = NODE_NULL_POINTER;
+    }
+    else{
+        const ScanKernels_t *Kernels = Scan_Get_Kernels();
+        const UnrolledNode_t *Node = List->ListHead;
+
+        *Sum = 0;
+        while (NULL != Node)
+        {
+            *Sum += Kernels->KernelSum(Node->NodeData, Node->NodeCount);
+            Node = Node->NodeLink;
+        }
+        status = (NULL == List->ListHead) ? NODE_EMPTY : NODE_OK;
+    }
+    return status;
+}
+
+/* Section : List handles, one node per step (scalar by nature; Find_By_Value is the matching find) */
+
+/* Function to count the nodes of a list handle equal to Value; NODE_EMPTY for an empty list (*Matches = 0) */
+NodeStatus_t Scan_List_Count(const List_t *List, uint32_t Value, size_t *Matches){
+    NodeStatus_t status = NODE_NOK;
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == List)||(NULL == Matches)){
+        status = NODE_NULL_POINTER;
+    }
+    else{
+        const Node_t *NodeHeadCopy = List->ListHead;
+
+        *Matches = 0;
+        while (NULL != NodeHeadCopy)
+        {
+            *Matches += (NodeHeadCopy->NodeData == Value) ? 1U : 0U;
+            NodeHeadCopy = NodeHeadCopy->NodeLink;
+        }
+        status = (NULL == List->ListHead) ? NODE_EMPTY : NODE_OK;
+    }
+    return status;
+}
+
+/* Function to find the smallest and largest value of a list handle; NODE_EMPTY for an empty list (nothing changed) */
+NodeStatus_t Scan_List_Min_Max(const List_t *List, uint32_t *Min, uint32_t *Max){
+    NodeStatus_t status = NODE_NOK;
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == List)||(NULL == Min)||(NULL == Max)){
+        status = NODE_NULL_POINTER;
+    }
+    else if(NULL == List->ListHead){
+        status = NODE_EMPTY;
+    }
+    else{
+        const Node_t *NodeHeadCopy = List->ListHead;
+
+        *Min = 0xFFFFFFFFU;
+        *Max = 0U;
+        while (NULL != NodeHeadCopy)
+        {
+            Scan_Min_Max_Scalar(&NodeHeadCopy->NodeData, 1U, Min, Max);
+            NodeHeadCopy = NodeHeadCopy->NodeLink;
+        }
+        status = NODE_OK;
+    }
+    return status;
+}
+
+/* Function to add up the values of a list handle; NODE_EMPTY for an empty list (*Sum = 0) */
+NodeStatus_t Scan_List_Sum(const List_t *List, uint64_t *Sum){
+    NodeStatus_t status = NODE_NOK;
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == List)||(NULL == Sum)){
+        status = NODE_NULL_POINTER;
+    }
+    else{
+        const Node_t *NodeHeadCopy = List->ListHead;
+
+        *Sum = 0;
+        while (NULL != NodeHeadCopy)
+        {
+            *Sum += NodeHeadCopy->NodeData;
+            NodeHeadCopy = NodeHeadCopy->NodeLink;
+        }
+        status = (NULL == List->ListHead) ? NODE_EMPTY : NODE_OK;
+    }
+    return status;
+}
\ No newline at end of file
@@ -0,0 +1,88 @@
+/* 
+ * File:   ListScan.h
+ * Author: Mohammed Khairallah
+ * linkedin : linkedin.com/in/mohammed-khairallah
+ * Created on October 22, 2026, 10:00 AM
+ */
+#ifndef _LISTSCAN_H
+#define _LISTSCAN_H
+
+/* Section : Includes */
+#include "SingleLinkedList.h"
+#include "UnrolledList.h"
+
+/* Section : Macro Declarations */
+
+/* SSE2 kernels are built on x86 targets that guarantee SSE2 (all x86-64); define SCAN_FORCE_SCALAR to build scalar code only */
+#if defined(__SSE2__) && !defined(SCAN_FORCE_SCALAR)
+#define SCAN_HAVE_SSE2 (1)
+#else
+#define SCAN_HAVE_SSE2 (0)
+#endif
+
+/* AVX2 kernels need GCC or Clang (target attribute and runtime CPU check) */
+#if SCAN_HAVE_SSE2 && defined(__GNUC__)
+#define SCAN_HAVE_AVX2 (1)
+#else
+#define SCAN_HAVE_AVX2 (0)
+#endif
+
+/* Section : Macro Functions Declarations */
+
+
+/* Section : Data type Declarations */
+
+/* 
+   This typedef enum selects the instruction set used by the scan kernels.
+
+   Explanation of enumerators:
+   - SCAN_LEVEL_AUTO: The best level the CPU supports (the default).
+   - SCAN_LEVEL_SCALAR: Plain C, one value at a time; available everywhere.
+   - SCAN_LEVEL_SSE2: 4 values per instruction.
+   - SCAN_LEVEL_AVX2: 8 values per instruction, chosen at run time only if the CPU has AVX2.
+*/
+typedef enum{
+    SCAN_LEVEL_AUTO = 0,  /* best supported level */
+    SCAN_LEVEL_SCALAR,    /* portable C */
+    SCAN_LEVEL_SSE2,      /* 128-bit vectors */
+    SCAN_LEVEL_AVX2       /* 256-bit vectors */
+}ScanLevel_t;
+
+/* 
+   This typedef struct groups the kernels of one level, so a caller scanning many small blocks
+   (the nodes of an unrolled list) picks the level once instead of once per block.
+
+   Explanation of members (all take the block Data[0 .. Count - 1], Count may be 0):
+   - KernelFind: Returns the 0-based index of the first value equal to Value, or Count if there is none.
+   - KernelCount: Returns the number of values equal to Value.
+   - KernelMinMax: Lowers *Min and raises *Max with the values of the block.
+   - KernelSum: Returns the sum of the block as a 64-bit value.
+*/
+typedef struct{
+    size_t (*KernelFind)(const uint32_t *Data, size_t Count, uint32_t Value);
+    size_t (*KernelCount)(const uint32_t *Data, size_t Count, uint32_t Value);
+    void (*KernelMinMax)(const uint32_t *Data, size_t Count, uint32_t *Min, uint32_t *Max);
+    uint64_t (*KernelSum)(const uint32_t *Data, size_t Count);
+}ScanKernels_t;
+
+/* Section : Functions Declaration */
+
+NodeStatus_t Scan_Set_Level(ScanLevel_t Level);
+ScanLevel_t Scan_Get_Level(void);
+const ScanKernels_t *Scan_Get_Kernels(void);
+
+NodeStatus_t Scan_Find(const uint32_t *Data, size_t Count, uint32_t Value, size_t *NodePosition);
+NodeStatus_t Scan_Count(const uint32_t *Data, size_t Count, uint32_t Value, size_t *Matches);
+NodeStatus_t Scan_Min_Max(const uint32_t *Data, size_t Count, uint32_t *Min, uint32_t *Max);
+NodeStatus_t Scan_Sum(const uint32_t *Data, size_t Count, uint64_t *Sum);
+
+NodeStatus_t Scan_Unrolled_Find(const UnrolledList_t *List, uint32_t Value, size_t *NodePosition);
+NodeStatus_t Scan_Unrolled_Count(const UnrolledList_t *List, uint32_t Value, size_t *Matches);
+NodeStatus_t Scan_Unrolled_Min_Max(const UnrolledList_t *List, uint32_t *Min, uint32_t *Max);
+NodeStatus_t Scan_Unrolled_Sum(const UnrolledList_t *List, uint64_t *Sum);
+
+NodeStatus_t Scan_List_Count(const List_t *List, uint32_t Value, size_t *Matches);
+NodeStatus_t Scan_List_Min_Max(const List_t *List, uint32_t *Min, uint32_t *Max);
+NodeStatus_t Scan_List_Sum(const List_t *List, uint64_t *Sum);
+
+#endif  //_LISTSCAN_H
\ No newline at end of file
@@ -0,0 +1,388 @@
+/* 
+ * File:   ListSnapshot.c
+ * Author: Mohammed Khairallah
+ * linkedin : linkedin.com/in/mohammed-khairallah
+ * Created on October 19, 2026, 2:00 PM
+ */
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+#include "ListSnapshot.h"
+
+/* Function to write the values collected by a streaming writer */
+static NodeStatus_t Snapshot_Writer_Flush(SnapshotWriter_t *Writer){
+    NodeStatus_t status = NODE_OK;
+
+    if(0U != Writer->WriterUsed){
+        if(Writer->WriterUsed != fwrite(Writer->WriterBuffer, sizeof(uint32_t), Writer->WriterUsed, Writer->WriterFile)){
+            status = NODE_NOK;  // Disk full or I/O error
+        }
+        Writer->WriterUsed = 0;
+    }
+    return status;
+}
+
+/*
+   This function Snapshot_Writer_Open is responsible for creating a snapshot file and preparing it for streaming writes.
+   An existing file at Path is overwritten. The header is written with a count of 0 and completed by Snapshot_Writer_Close.
+
+   Parameters:
+   - Writer: A pointer to the writer to be initialized.
+   - Path: The path of the file to create.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if a pointer is NULL, or NODE_NOK if the file could not be created.
+*/
+NodeStatus_t Snapshot_Writer_Open(SnapshotWriter_t *Writer, const char *Path){
+    NodeStatus_t status = NODE_NOK;
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == Writer)||(NULL == Path)){
+        status = NODE_NULL_POINTER;
+    }
+    else{
+        SnapshotHeader_t Header = {SNAPSHOT_MAGIC, SNAPSHOT_VERSION, 0U};
+
+        Writer->WriterCount = 0;
+        Writer->WriterUsed = 0;
+        Writer->WriterFile = fopen(Path, "wb");
+        if(NULL == Writer->WriterFile){
+            status = NODE_NOK;
+        }
+        else if(1U != fwrite(&Header, sizeof(Header), 1U, Writer->WriterFile)){
+            fclose(Writer->WriterFile);
+            Writer->WriterFile = NULL;
+            status = NODE_NOK;
+        }
+        else{
+            status = NODE_OK;
+        }
+    }
+    return status;
+}
+
+/*
+   This function Snapshot_Writer_Append is responsible for adding one value at the end of a snapshot being written.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if Writer is NULL or not open, or NODE_NOK on a write error.
+*/
+NodeStatus_t Snapshot_Writer_Append(SnapshotWriter_t *Writer, uint32_t Data){
+    NodeStatus_t status = NODE_OK;
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == Writer)||(NULL == Writer->WriterFile)){
+        status = NODE_NULL_POINTER;
+    }
+    else{
+        if(SNAPSHOT_WRITER_BUFFER == Writer->WriterUsed){
+            status = Snapshot_Writer_Flush(Writer);
+        }
+        Writer->WriterBuffer[Writer->WriterUsed] = Data;
+        Writer->WriterUsed++;
+        Writer->WriterCount++;
+    }
+    return status;
+}
+
+/*
+   This function Snapshot_Writer_Close is responsible for finishing a snapshot file.
+   The remaining values are written, the header count is filled in and the file is closed.
+   The writer is closed even when an error is reported; the file is then incomplete and must not be loaded.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if Writer is NULL or not open, or NODE_NOK on a write error.
+*/
+NodeStatus_t Snapshot_Writer_Close(SnapshotWriter_t *Writer){
+    NodeStatus_t status = NODE_NOK;
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == Writer)||(NULL == Writer->WriterFile)){
+        status = NODE_NULL_POINTER;
+    }
+    else{
+        SnapshotHeader_t Header = {SNAPSHOT_MAGIC, SNAPSHOT_VERSION, Writer->WriterCount};
+
+        status = Snapshot_Writer_Flush(Writer);
+        if((NODE_OK == status) &&
+           ((0 != fseek(Writer->WriterFile, 0L, SEEK_SET)) || (1U != fwrite(&Header, sizeof(Header), 1U, Writer->WriterFile)))){
+            status = NODE_NOK;
+        }
+        if((0 != fclose(Writer->WriterFile)) && (NODE_OK == status)){
+            status = NODE_NOK;  // Buffered data could not be written
+        }
+        Writer->WriterFile = NULL;
+    }
+    return status;
+}
+
+/*
+   This function Snapshot_Save_List is responsible for writing a whole list handle to a snapshot file.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if a pointer is NULL, or NODE_NOK on an I/O error.
+*/
+NodeStatus_t Snapshot_Save_List(List_t *List, const char *Path){
+    NodeStatus_t status = NODE_NOK;
+    SnapshotWriter_t Writer;
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == List)||(NULL == Path)){
+        status = NODE_NULL_POINTER;
+    }
+    else if(NODE_OK == (status = Snapshot_Writer_Open(&Writer, Path))){
+        Node_t *NodeCopy = List->ListHead;
+
+        while ((NULL != NodeCopy) && (NODE_OK == status))
+        {
+            status = Snapshot_Writer_Append(&Writer, NodeCopy->NodeData);
+            NodeCopy = NodeCopy->NodeLink;  // Move to the next node
+        }
+        if((NODE_OK != Snapshot_Writer_Close(&Writer)) && (NODE_OK == status)){
+            status = NODE_NOK;
+        }
+    }
+    else{
+        /* Nothing, status holds the error */
+    }
+    return status;
+}
+
+/*
+   This function Snapshot_Save_Compact is responsible for writing a whole compact list to a snapshot file.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if a pointer is NULL, or NODE_NOK on an I/O error.
+*/
+NodeStatus_t Snapshot_Save_Compact(CompactList_t *List, const char *Path){
+    NodeStatus_t status = NODE_NOK;
+    SnapshotWriter_t Writer;
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == List)||(NULL == Path)){
+        status = NODE_NULL_POINTER;
+    }
+    else if(NODE_OK == (status = Snapshot_Writer_Open(&Writer, Path))){
+        uint32_t Index = List->ListHead;
+
+        while ((COMPACT_NULL_INDEX != Index) && (NODE_OK == status))
+        {
+            status = Snapshot_Writer_Append(&Writer, List->ListNodes[Index].NodeData);
+            Index = List->ListNodes[Index].NodeLink;  // Move to the next node
+        }
+        if((NODE_OK != Snapshot_Writer_Close(&Writer)) && (NODE_OK == status)){
+            status = NODE_NOK;
+        }
+    }
+    else{
+        /* Nothing, status holds the error */
+    }
+    return status;
+}
+
+/*
+   This function Snapshot_Map is responsible for opening a snapshot file read-only without copying its values.
+
+   Parameters:
+   - View: A pointer to the view that receives the values.
+   - Path: The path of the snapshot file.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if a pointer is NULL,
+                   or NODE_NOK if the file cannot be opened or is not a complete snapshot of this format and byte order.
+
+   Algorithm:
+   - The whole file is mapped (POSIX) or read into memory (Windows).
+   - The header is checked: magic, version, and that the file holds at least HeaderCount values.
+   - ViewData then points directly into the mapping; the values are never copied.
+*/
+NodeStatus_t Snapshot_Map(SnapshotView_t *View, const char *Path){
+    NodeStatus_t status = NODE_NOK;
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == View)||(NULL == Path)){
+        status = NODE_NULL_POINTER;
+    }
+    else{
+        View->ViewData = NULL;
+        View->ViewCount = 0;
+        View->ViewBase = NULL;
+        View->ViewBytes = 0;
+#if defined(_WIN32)
+        FILE *File = fopen(Path, "rb");
+
+        if(NULL != File){
+            if((0 == fseek(File, 0L, SEEK_END)) && (ftell(File) >= (long)sizeof(SnapshotHeader_t))){
+                View->ViewBytes = (size_t)ftell(File);
+                View->ViewBase = malloc(View->ViewBytes);
+                rewind(File);
+                if((NULL != View->ViewBase) && (1U == fread(View->ViewBase, View->ViewBytes, 1U, File))){
+                    status = NODE_OK;
+                }
+            }
+            fclose(File);
+        }
+#else
+        int FileDescriptor = open(Path, O_RDONLY);
+        struct stat FileStat;
+
+        if(FileDescriptor >= 0){
+            if((0 == fstat(FileDescriptor, &FileStat)) && (FileStat.st_size >= (off_t)sizeof(SnapshotHeader_t))){
+                View->ViewBytes = (size_t)FileStat.st_size;
+                View->ViewBase = mmap(NULL, View->ViewBytes, PROT_READ, MAP_SHARED, FileDescriptor, 0);
+                if(MAP_FAILED == View->ViewBase){
+                    View->ViewBase = NULL;
+                }
+                else{
+                    status = NODE_OK;
+                }
+            }
+            close(FileDescriptor);  // The mapping stays valid after the descriptor is closed
+        }
+#endif
+        if(NODE_OK == status){
+            const SnapshotHeader_t *Header = (const SnapshotHeader_t *)View->ViewBase;
+            uint64_t MaxCount = (View->ViewBytes - sizeof(SnapshotHeader_t)) / sizeof(uint32_t);
+
+            if((SNAPSHOT_MAGIC != Header->HeaderMagic) || (SNAPSHOT_VERSION != Header->HeaderVersion) ||
+               (Header->HeaderCount > MaxCount)){
+                status = NODE_NOK;  // Not a snapshot, other byte order or version, or truncated file
+            }
+            else{
+                View->ViewData = (const uint32_t *)(Header + 1);
+                View->ViewCount = Header->HeaderCount;
+            }
+        }
+        if((NODE_OK != status) && (NULL != View->ViewBase)){
+            Snapshot_Unmap(View);
+        }
+    }
+    return status;
+}
+
+/*
+   This function Snapshot_Unmap is responsible for releasing a view opened by Snapshot_Map.
+   ViewData must not be used afterwards.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success or NODE_NULL_POINTER if View is NULL.
+*/
+NodeStatus_t Snapshot_Unmap(SnapshotView_t *View){
+    NodeStatus_t status = NODE_NOK;
+
+    /* Check for NULL pointers in the input parameters */
+    if(NULL == View){
+        status = NODE_NULL_POINTER;
+    }
+    else{
+        if(NULL != View->ViewBase){
+#if defined(_WIN32)
+            free(View->ViewBase);
+#else
+            munmap(View->ViewBase, View->ViewBytes);
+#endif
+        }
+        View->ViewData = NULL;
+        View->ViewCount = 0;
+        View->ViewBase = NULL;
+        View->ViewBytes = 0;
+        status = NODE_OK;
+    }
+    return status;
+}
+
+/*
+   This function Snapshot_Load_List is responsible for appending the values of a snapshot file to a list handle.
+
+   Parameters:
+   - List: A pointer to the list handle. Its node pool is used if one is attached.
+   - Path: The path of the snapshot file.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if a pointer is NULL,
+                   or NODE_NOK if the file is not a valid snapshot or memory allocation failed (the list is then unchanged).
+
+   Algorithm:
+   - The file is mapped with Snapshot_Map and the mapped values are appended with List_Insert_Nodes_At_End,
+     so a pooled list receives all of them in one contiguous block and no position is ever searched.
+*/
+NodeStatus_t Snapshot_Load_List(List_t *List, const char *Path){
+    NodeStatus_t status = NODE_NOK;
+    SnapshotView_t View;
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == List)||(NULL == Path)){
+        status = NODE_NULL_POINTER;
+    }
+    else if(NODE_OK == (status = Snapshot_Map(&View, Path))){
+        if(View.ViewCount > (uint64_t)(((size_t)-1) / sizeof(Node_t))){
+            status = NODE_NOK;  // Cannot be held in memory on this build
+        }
+        else{
+            status = List_Insert_Nodes_At_End(List, View.ViewData, (size_t)View.ViewCount);
+        }
+        Snapshot_Unmap(&View);
+    }
+    else{
+        /* Nothing, status holds the error */
+    }
+    return status;
+}
+
+/*
+   This function Snapshot_Load_Compact is responsible for replacing the contents of a compact list with a snapshot file.
+   This is the fastest way to restart with a large list: one allocation and one sequential pass, no per-value insertion.
+
+   Parameters:
+   - List: A pointer to an initialized compact list handle. Its previous contents are released.
+   - Path: The path of the snapshot file.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if a pointer is NULL,
+                   or NODE_NOK if the file is not a valid snapshot, holds more than COMPACT_MAX_NODES values,
+                   or memory allocation failed (the list is then empty).
+
+   Algorithm:
+   - The node store is reserved for exactly HeaderCount nodes, and node i gets value i and a link to node i + 1,
+     so the list is stored in order with no free slots.
+*/
+NodeStatus_t Snapshot_Load_Compact(CompactList_t *List, const char *Path){
+    NodeStatus_t status = NODE_NOK;
+    SnapshotView_t View;
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == List)||(NULL == Path)){
+        status = NODE_NULL_POINTER;
+    }
+    else if(NODE_OK == (status = Snapshot_Map(&View, Path))){
+        Compact_Clear(List);
+        if(View.ViewCount > COMPACT_MAX_NODES){
+            status = NODE_NOK;
+        }
+        else if((0U != View.ViewCount) && (NODE_OK == (status = Compact_Reserve(List, (size_t)View.ViewCount)))){
+            uint32_t Count = (uint32_t)View.ViewCount;
+            uint32_t counter = 0;
+
+            for(counter = 0; counter < Count; counter++){
+                List->ListNodes[counter].NodeData = View.ViewData[counter];
+                List->ListNodes[counter].NodeLink = counter + 1U;
+            }
+            List->ListNodes[Count - 1U].NodeLink = COMPACT_NULL_INDEX;
+            List->ListHead = 0;
+            List->ListTail = Count - 1U;
+            List->ListUsed = Count;
+            List->ListLength = Count;
+        }
+        else{
+            /* Empty snapshot (status NODE_OK) or Compact_Reserve failed */
+        }
+        Snapshot_Unmap(&View);
+    }
+    else{
+        /* Nothing, status holds the error */
+    }
+    return status;
+}
\ No newline at end of file
@@ -0,0 +1,82 @@
+/* 
+ * File:   ListSnapshot.h
+ * Author: Mohammed Khairallah
+ * linkedin : linkedin.com/in/mohammed-khairallah
+ * Created on October 19, 2026, 2:00 PM
+ */
+#ifndef _LISTSNAPSHOT_H
+#define _LISTSNAPSHOT_H
+
+/* Section : Includes */
+#include "SingleLinkedList.h"
+#include "CompactList.h"
+
+/* Section : Macro Declarations */
+
+#define SNAPSHOT_MAGIC (0x314C4C53U)        /* "SLL1" when read as little-endian bytes */
+#define SNAPSHOT_VERSION (1U)               /* Format version written by this code */
+#define SNAPSHOT_WRITER_BUFFER (4096U)      /* Values the streaming writer collects before one fwrite */
+
+/* Section : Macro Functions Declarations */
+
+
+/* Section : Data type Declarations */
+
+/* 
+   This typedef struct represents the header at the start of a snapshot file.
+   The file is this header followed by HeaderCount packed uint32_t values in list order, all in the byte order of the
+   machine that wrote it (a file from a machine with the other byte order is rejected because the magic does not match).
+   The header is 16 bytes, so the values start 4-byte aligned and can be read in place from a memory mapping.
+
+   Explanation of members:
+   - HeaderMagic: Holds SNAPSHOT_MAGIC.
+   - HeaderVersion: Holds SNAPSHOT_VERSION.
+   - HeaderCount: Holds the number of values that follow.
+*/
+typedef struct{
+    uint32_t HeaderMagic;    /* file identifier */
+    uint32_t HeaderVersion;  /* format version */
+    uint64_t HeaderCount;    /* number of values */
+}SnapshotHeader_t;
+
+/* 
+   This typedef struct represents a snapshot file being written one value at a time.
+   Values are collected in WriterBuffer and written in blocks; the header count is filled in by Snapshot_Writer_Close.
+*/
+typedef struct{
+    FILE *WriterFile;                            /* file being written */
+    uint64_t WriterCount;                        /* values appended so far */
+    size_t WriterUsed;                           /* values waiting in WriterBuffer */
+    uint32_t WriterBuffer[SNAPSHOT_WRITER_BUFFER];  /* values not yet written */
+}SnapshotWriter_t;
+
+/* 
+   This typedef struct represents a snapshot file opened read-only without copying it.
+   On POSIX systems the file is memory-mapped, so opening costs the same whatever the number of values and pages are
+   read on first use. On Windows the file is read into one heap block instead.
+
+   Explanation of members:
+   - ViewData: Holds a pointer to the first value; ViewData[0] to ViewData[ViewCount - 1] are the list in order.
+   - ViewCount: Holds the number of values.
+   - ViewBase / ViewBytes: Holds the mapping (or heap block) and its size, used by Snapshot_Unmap.
+*/
+typedef struct{
+    const uint32_t *ViewData;  /* values in list order */
+    uint64_t ViewCount;        /* number of values */
+    void *ViewBase;            /* start of the mapping */
+    size_t ViewBytes;          /* size of the mapping */
+}SnapshotView_t;
+
+/* Section : Functions Declaration */
+
+NodeStatus_t Snapshot_Writer_Open(SnapshotWriter_t *Writer, const char *Path);
+NodeStatus_t Snapshot_Writer_Append(SnapshotWriter_t *Writer, uint32_t Data);
+NodeStatus_t Snapshot_Writer_Close(SnapshotWriter_t *Writer);
+NodeStatus_t Snapshot_Save_List(List_t *List, const char *Path);
+NodeStatus_t Snapshot_Save_Compact(CompactList_t *List, const char *Path);
+NodeStatus_t Snapshot_Map(SnapshotView_t *View, const char *Path);
+NodeStatus_t Snapshot_Unmap(SnapshotView_t *View);
+NodeStatus_t Snapshot_Load_List(List_t *List, const char *Path);
+NodeStatus_t Snapshot_Load_Compact(CompactList_t *List, const char *Path);
+
+#endif  //_LISTSNAPSHOT_H
\ No newline at end of file
@@ -0,0 +1,410 @@
+/* 
+ * File:   ListStats.c
+ * Author: Mohammed Khairallah
+ * linkedin : linkedin.com/in/mohammed-khairallah
+ * Created on October 23, 2026, 10:00 AM
+ */
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#include "ListStats.h"
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define LIST_STATS_HAVE_TSC (1)
+#else
+#define LIST_STATS_HAVE_TSC (0)
+#endif
+
+#define LIST_STATS_CALIBRATION_NS (1000000U)  /* Time the tick counter is measured against the clock */
+
+/*
+   Every thread updates its own ListStatsBlock_t, so the hooks need no atomic read-modify-write and no lock: the owner
+   adds with a relaxed load and store, and List_Stats_Snapshot reads and sums the blocks of all threads. Blocks are
+   never freed; the block of a thread that ended is taken over by the next new thread, so no count is lost.
+   Times are taken with the time stamp counter on x86 (converted with a factor calibrated once against the monotonic
+   clock) and with clock_gettime elsewhere.
+*/
+
+/* 
+   This typedef struct holds the counters of one thread.
+*/
+typedef struct ListStatsBlock{
+    ListStats_t BlockStats;               /* counters of the owner thread */
+    struct ListStatsBlock *BlockNext;     /* next block of the registry */
+    boolean BlockInUse;                   /* 1 while a running thread owns the block */
+}ListStatsBlock_t;
+
+static ListStatsBlock_t *List_Stats_Blocks = NULL;            /* registry of all blocks */
+static ListStatsBlock_t List_Stats_Fallback;                  /* shared by threads whose block could not be allocated */
+static pthread_mutex_t List_Stats_Lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_once_t List_Stats_Once = PTHREAD_ONCE_INIT;
+static pthread_key_t List_Stats_Key;
+static double List_Stats_Ns_Per_Tick = 1.0;
+static __thread ListStatsBlock_t *List_Stats_Local = NULL;    /* block of the calling thread */
+__thread uint64_t List_Stats_Nodes = 0;
+
+static const char *List_Stats_Names[LIST_OP_COUNT] = {
+    "Insert_Node_At_Beginning",
+    "Insert_Node_At_End",
+    "Insert_Node_After_Wide",
+    "Delete_Node_At_Beginning",
+    "Delete_Node_Wide",
+    "Display_All_Nodes",
+    "Get_Length_Wide",
+    "Get_Length",
+    "Insert_Nodes_At_Beginning",
+    "Insert_Nodes_At_End",
+    "Insert_Nodes_After",
+    "Extract_Nodes",
+    "Sort_Nodes",
+    "Insert_Node_Sorted",
+    "Merge_Sorted_Nodes",
+    "Find_By_Value",
+    "Delete_By_Value",
+    "Get_Fragmentation",
+    "Relinearize_Nodes",
+    "Concat_Nodes",
+    "Split_Nodes",
+    "List_Init",
+    "List_Use_Pool",
+    "List_Use_Index",
+    "List_Link_Node_After",
+    "List_Unlink_Node_After",
+    "List_Link_Chain_After",
+    "List_Insert_Node_At_Beginning",
+    "List_Insert_Node_At_End",
+    "List_Insert_Node_After",
+    "List_Delete_Node_At_Beginning",
+    "List_Delete_Node",
+    "List_Display_All_Nodes",
+    "List_Get_Length",
+    "List_Clear",
+    "List_Insert_Nodes_At_Beginning",
+    "List_Insert_Nodes_At_End",
+    "List_Insert_Nodes_After",
+    "List_Extract_Nodes",
+    "List_Cursor_Init",
+    "List_Cursor_Next",
+    "List_Cursor_Seek",
+    "List_Cursor_Peek",
+    "List_Cursor_Get_Position",
+    "List_Cursor_Insert_After",
+    "List_Cursor_Insert_Before",
+    "List_Cursor_Erase",
+    "List_Sort",
+    "List_Insert_Node_Sorted",
+    "List_Merge_Sorted",
+    "List_Find_By_Value",
+    "List_Delete_By_Value",
+    "List_Get_Fragmentation",
+    "List_Compact",
+    "List_Compact_Begin",
+    "List_Compact_Step",
+    "List_Concat",
+    "List_Split",
+    "List_Splice"
+};
+
+/* Function to read the clock used for latencies, in ticks */
+static inline uint64_t List_Stats_Ticks(void){
+#if LIST_STATS_HAVE_TSC
+    return __rdtsc();
+#else
+    struct timespec Now;
+
+    clock_gettime(CLOCK_MONOTONIC, &Now);
+    return ((uint64_t)Now.tv_sec * 1000000000ULL) + (uint64_t)Now.tv_nsec;
+#endif
+}
+
+/* Function to read a monotonic clock in nanoseconds */
+static uint64_t List_Stats_Now_Ns(void){
+    struct timespec Now;
+
+    clock_gettime(CLOCK_MONOTONIC, &Now);
+    return ((uint64_t)Now.tv_sec * 1000000000ULL) + (uint64_t)Now.tv_nsec;
+}
+
+/* Function to find the latency bucket of a call: 0 for 0 ns, k for [2^(k-1), 2^k) ns, the last bucket above that */
+static uint32_t List_Stats_Bucket(uint64_t Ns){
+    uint32_t Bucket = 0;
+
+    if(0U != Ns){
+        Bucket = 64U - (uint32_t)__builtin_clzll(Ns);
+        Bucket = (Bucket < LIST_STATS_BUCKETS) ? Bucket : (LIST_STATS_BUCKETS - 1U);
+    }
+    return Bucket;
+}
+
+/* Function to add to a counter of the calling thread's block (only the owner writes, snapshots read concurrently) */
+static inline void List_Stats_Add(uint64_t *Counter, uint64_t Value){
+    __atomic_store_n(Counter, __atomic_load_n(Counter, __ATOMIC_RELAXED) + Value, __ATOMIC_RELAXED);
+}
+
+/* Function called when a thread that owns a block ends: the block is handed over to the next new thread */
+static void List_Stats_Release_Block(void *Block){
+    pthread_mutex_lock(&List_Stats_Lock);
+    ((ListStatsBlock_t *)Block)->BlockInUse = 0U;
+    pthread_mutex_unlock(&List_Stats_Lock);
+}
+
+/* Function run once per process: thread exit key and, on x86, the tick to nanosecond factor (about 1 ms) */
+static void List_Stats_Setup(void){
+    (void)pthread_key_create(&List_Stats_Key, List_Stats_Release_Block);
+#if LIST_STATS_HAVE_TSC
+    {
+        uint64_t StartNs = List_Stats_Now_Ns();
+        uint64_t StartTicks = List_Stats_Ticks();
+        uint64_t EndNs = StartNs;
+
+        while ((EndNs - StartNs) < LIST_STATS_CALIBRATION_NS)
+        {
+            EndNs = List_Stats_Now_Ns();
+        }
+        List_Stats_Ns_Per_Tick = (double)(EndNs - StartNs) / (double)(List_Stats_Ticks() - StartTicks);
+    }
+#endif
+}
+
+/* Function to give the calling thread a block, reusing one of an ended thread when possible */
+static ListStatsBlock_t *List_Stats_Attach(void){
+    ListStatsBlock_t *Block = NULL;
+
+    (void)pthread_once(&List_Stats_Once, List_Stats_Setup);
+    pthread_mutex_lock(&List_Stats_Lock);
+    Block = List_Stats_Blocks;
+    while ((NULL != Block) && (0U != Block->BlockInUse))
+    {
+        Block = Block->BlockNext;
+    }
+    if(NULL == Block){
+        Block = (ListStatsBlock_t *)calloc(1U, sizeof(ListStatsBlock_t));
+        if(NULL != Block){
+            Block->BlockNext = List_Stats_Blocks;
+            List_Stats_Blocks = Block;
+        }
+    }
+    if(NULL != Block){
+        Block->BlockInUse = 1U;
+        (void)pthread_setspecific(List_Stats_Key, Block);
+    }
+    else{
+        Block = &List_Stats_Fallback;  // Out of memory: counts of threads sharing it may be lost
+    }
+    pthread_mutex_unlock(&List_Stats_Lock);
+    return Block;
+}
+
+/* Section : Hooks */
+
+/* Function called by LIST_STATS_ENTER when an operation starts */
+void List_Stats_Enter(ListStatsFrame_t *Frame){
+    if(NULL == List_Stats_Local){
+        List_Stats_Local = List_Stats_Attach();
+    }
+    Frame->FrameNodes = List_Stats_Nodes;
+    Frame->FrameStart = List_Stats_Ticks();
+}
+
+/*
+   This function List_Stats_Exit is called by LIST_STATS_EXIT when an operation returns, and records the call.
+
+   Parameters:
+   - Frame: The state saved by List_Stats_Enter.
+   - Op: The operation.
+   - Status: The result the operation returns.
+
+   Algorithm:
+   - The time and the nodes traversed since entry are added to the operation in the calling thread's block, and the
+     call is counted under its result and in its latency bucket. Operations called by other operations count for both.
+*/
+void List_Stats_Exit(const ListStatsFrame_t *Frame, ListOp_t Op, NodeStatus_t Status){
+    ListOpStats_t *OpStats = &List_Stats_Local->BlockStats.StatsOps[Op];
+    uint64_t Ns = (uint64_t)((double)(List_Stats_Ticks() - Frame->FrameStart) * List_Stats_Ns_Per_Tick);
+
+    List_Stats_Add(&OpStats->OpCalls[((uint32_t)Status < LIST_STATS_STATUSES) ? (uint32_t)Status : (uint32_t)NODE_NOK], 1U);
+    List_Stats_Add(&OpStats->OpNodes, List_Stats_Nodes - Frame->FrameNodes);
+    List_Stats_Add(&OpStats->OpTotalNs, Ns);
+    List_Stats_Add(&OpStats->OpLatency[List_Stats_Bucket(Ns)], 1U);
+    if(Ns > OpStats->OpMaxNs){
+        __atomic_store_n(&OpStats->OpMaxNs, Ns, __ATOMIC_RELAXED);
+    }
+}
+
+/* Function called by LIST_STATS_ALLOC and LIST_STATS_ALLOC_CHAIN after nodes were allocated */
+void List_Stats_Count_Alloc(size_t Allocs, boolean Failed){
+    if(NULL == List_Stats_Local){
+        List_Stats_Local = List_Stats_Attach();
+    }
+    List_Stats_Add(&List_Stats_Local->BlockStats.StatsAllocs, Allocs);
+    List_Stats_Add(&List_Stats_Local->BlockStats.StatsAllocFailures, Failed ? 1U : 0U);
+}
+
+/* Function called by LIST_STATS_FREE after nodes were released */
+void List_Stats_Count_Free(size_t Frees){
+    if(NULL == List_Stats_Local){
+        List_Stats_Local = List_Stats_Attach();
+    }
+    List_Stats_Add(&List_Stats_Local->BlockStats.StatsFrees, Frees);
+}
+
+/* Section : Snapshot */
+
+/* Function to read a counter of any thread's block */
+static uint64_t List_Stats_Read(const uint64_t *Counter){
+    return __atomic_load_n(Counter, __ATOMIC_RELAXED);
+}
+
+/* Function to add the counters of one block into a snapshot (OpMaxNs keeps the largest, all others are sums) */
+static void List_Stats_Merge(ListStats_t *Stats, const ListStatsBlock_t *Block){
+    uint32_t Op = 0;
+    uint32_t counter = 0;
+
+    for(Op = 0; Op < (uint32_t)LIST_OP_COUNT; Op++){
+        const ListOpStats_t *Source = &Block->BlockStats.StatsOps[Op];
+        ListOpStats_t *Target = &Stats->StatsOps[Op];
+        uint64_t MaxNs = List_Stats_Read(&Source->OpMaxNs);
+
+        for(counter = 0; counter < LIST_STATS_STATUSES; counter++){
+            Target->OpCalls[counter] += List_Stats_Read(&Source->OpCalls[counter]);
+        }
+        for(counter = 0; counter < LIST_STATS_BUCKETS; counter++){
+            Target->OpLatency[counter] += List_Stats_Read(&Source->OpLatency[counter]);
+        }
+        Target->OpNodes += List_Stats_Read(&Source->OpNodes);
+        Target->OpTotalNs += List_Stats_Read(&Source->OpTotalNs);
+        Target->OpMaxNs = (MaxNs > Target->OpMaxNs) ? MaxNs : Target->OpMaxNs;
+    }
+    Stats->StatsAllocs += List_Stats_Read(&Block->BlockStats.StatsAllocs);
+    Stats->StatsFrees += List_Stats_Read(&Block->BlockStats.StatsFrees);
+    Stats->StatsAllocFailures += List_Stats_Read(&Block->BlockStats.StatsAllocFailures);
+}
+
+/*
+   This function List_Stats_Snapshot is responsible for copying all counters, e.g. to export them to a metrics system.
+   The counters of all threads (running or ended) are added up.
+
+   Parameters:
+   - Stats: A pointer to the structure that receives the copy.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if Stats is NULL, or NODE_NOK if the library was built
+                   without LIST_STATS_ENABLE (Stats is then all zeros).
+
+   Each counter is read atomically, but operations running on other threads during the copy may be only partly
+   included (e.g. counted in OpCalls but not yet in OpLatency).
+*/
+NodeStatus_t List_Stats_Snapshot(ListStats_t *Stats){
+    NodeStatus_t status = NODE_NOK;
+
+    /* Check for NULL pointers in the input parameters */
+    if(NULL == Stats){
+        status = NODE_NULL_POINTER;
+    }
+    else{
+        const ListStatsBlock_t *Block = NULL;
+
+        memset(Stats, 0, sizeof(ListStats_t));
+        pthread_mutex_lock(&List_Stats_Lock);
+        for(Block = List_Stats_Blocks; NULL != Block; Block = Block->BlockNext){
+            List_Stats_Merge(Stats, Block);
+        }
+        List_Stats_Merge(Stats, &List_Stats_Fallback);
+        pthread_mutex_unlock(&List_Stats_Lock);
+#if defined(LIST_STATS_ENABLE)
+        status = NODE_OK;
+#else
+        status = NODE_NOK;
+#endif
+    }
+    return status;
+}
+
+/* Function to zero the counters of one block */
+static void List_Stats_Zero(ListStatsBlock_t *Block){
+    uint64_t *Target = (uint64_t *)&Block->BlockStats;
+    size_t counter = 0;
+
+    for(counter = 0; counter < (sizeof(ListStats_t) / sizeof(uint64_t)); counter++){
+        __atomic_store_n(&Target[counter], 0U, __ATOMIC_RELAXED);
+    }
+}
+
+/*
+   This function List_Stats_Reset is responsible for setting all counters of all threads back to zero.
+   It is exact when no list operation runs meanwhile; an operation finishing on another thread during the reset
+   may write back part of its old counts.
+*/
+NodeStatus_t List_Stats_Reset(void){
+    ListStatsBlock_t *Block = NULL;
+
+    pthread_mutex_lock(&List_Stats_Lock);
+    for(Block = List_Stats_Blocks; NULL != Block; Block = Block->BlockNext){
+        List_Stats_Zero(Block);
+    }
+    List_Stats_Zero(&List_Stats_Fallback);
+    pthread_mutex_unlock(&List_Stats_Lock);
+    return NODE_OK;
+}
+
+/* Function to get the name of an operation (the function name), or "unknown" */
+const char *List_Stats_Op_Name(ListOp_t Op){
+    return ((uint32_t)Op < (uint32_t)LIST_OP_COUNT) ? List_Stats_Names[Op] : "unknown";
+}
+
+/* Function to get the exclusive upper limit in ns of a latency bucket (0 for the open-ended last bucket) */
+uint64_t List_Stats_Bucket_Limit(uint32_t Bucket){
+    return (Bucket < (LIST_STATS_BUCKETS - 1U)) ? (1ULL << Bucket) : 0U;
+}
+
+/*
+   This function List_Stats_Percentile is responsible for estimating a latency percentile from a histogram.
+
+   Parameters:
+   - OpStats: A pointer to the counters of one operation (from a snapshot).
+   - Percent: The percentile, 1 to 100.
+   - LimitNs: A pointer that receives the upper limit of the bucket holding the percentile (the percentile is below it,
+              and at least half of it), or 0 when it falls in the open-ended last bucket.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if a pointer is NULL, NODE_EMPTY if no call was recorded,
+                   or NODE_NOK if Percent is out of range.
+*/
+NodeStatus_t List_Stats_Percentile(const ListOpStats_t *OpStats, uint32_t Percent, uint64_t *LimitNs){
+    NodeStatus_t status = NODE_NOK;
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == OpStats)||(NULL == LimitNs)){
+        status = NODE_NULL_POINTER;
+    }
+    else if((0U == Percent)||(Percent > 100U)){
+        status = NODE_NOK;
+    }
+    else{
+        uint64_t Calls = 0;
+        uint64_t Seen = 0;
+        uint32_t Bucket = 0;
+
+        for(Bucket = 0; Bucket < LIST_STATS_BUCKETS; Bucket++){
+            Calls += OpStats->OpLatency[Bucket];
+        }
+        if(0U == Calls){
+            status = NODE_EMPTY;
+        }
+        else{
+            uint64_t Rank = ((Calls * Percent) + 99U) / 100U;  // Calls at or below the percentile, rounded up
+
+            Bucket = 0;
+            Seen = OpStats->OpLatency[0];
+            while (Seen < Rank)
+            {
+                Bucket++;
+                Seen += OpStats->OpLatency[Bucket];
+            }
+            *LimitNs = List_Stats_Bucket_Limit(Bucket);
+            status = NODE_OK;
+        }
+    }
+    return status;
+}
\ No newline at end of file
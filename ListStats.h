@@ -0,0 +1,165 @@
+/* 
+ * File:   ListStats.h
+ * Author: Mohammed Khairallah
+ * linkedin : linkedin.com/in/mohammed-khairallah
+ * Created on October 23, 2026, 10:00 AM
+ */
+#ifndef _LISTSTATS_H
+#define _LISTSTATS_H
+
+/* Section : Includes */
+#include "SingleLinkedList.h"
+
+/* Section : Macro Declarations */
+
+/*
+   The instrumentation is compiled in only when LIST_STATS_ENABLE is defined (make STATS=1). Without it the hooks
+   below expand to nothing, SingleLinkedList.c is exactly the uninstrumented code, and List_Stats_Snapshot reports
+   NODE_NOK with all counters at zero.
+*/
+#define LIST_STATS_STATUSES (4U)  /* NodeStatus_t values, NODE_NOK .. NODE_NULL_POINTER */
+#define LIST_STATS_BUCKETS (32U)  /* Latency buckets: 0 ns, then [2^(k-1), 2^k) ns, the last one open-ended */
+
+/* Section : Macro Functions Declarations */
+
+#if defined(LIST_STATS_ENABLE)
+#define LIST_STATS_ENTER()                    ListStatsFrame_t ListStatsFrame; List_Stats_Enter(&ListStatsFrame)
+#define LIST_STATS_EXIT(Op, Status)           List_Stats_Exit(&ListStatsFrame, (Op), (Status))
+#define LIST_STATS_STEP()                     (List_Stats_Nodes++)
+#define LIST_STATS_ALLOC(Node)                List_Stats_Count_Alloc((NULL != (Node)) ? 1U : 0U, NULL == (Node))
+#define LIST_STATS_ALLOC_CHAIN(Status, Count) List_Stats_Count_Alloc((NODE_OK == (Status)) ? (Count) : 0U, NODE_OK != (Status))
+#define LIST_STATS_FREE(Count)                List_Stats_Count_Free(Count)
+#else
+#define LIST_STATS_ENTER()                    ((void)0)
+#define LIST_STATS_EXIT(Op, Status)           ((void)0)
+#define LIST_STATS_STEP()                     ((void)0)
+#define LIST_STATS_ALLOC(Node)                ((void)0)
+#define LIST_STATS_ALLOC_CHAIN(Status, Count) ((void)0)
+#define LIST_STATS_FREE(Count)                ((void)0)
+#endif
+
+/* Section : Data type Declarations */
+
+/*
+   One entry per public function of SingleLinkedList.c, in file order. Insert_Node_After and Delete_Node are counted as
+   their _Wide versions, and List_Cursor_Is_Valid (a check without any list access) is not counted.
+*/
+typedef enum{
+    LIST_OP_INSERT_NODE_AT_BEGINNING = 0,
+    LIST_OP_INSERT_NODE_AT_END,
+    LIST_OP_INSERT_NODE_AFTER_WIDE,
+    LIST_OP_DELETE_NODE_AT_BEGINNING,
+    LIST_OP_DELETE_NODE_WIDE,
+    LIST_OP_DISPLAY_ALL_NODES,
+    LIST_OP_GET_LENGTH_WIDE,
+    LIST_OP_GET_LENGTH,
+    LIST_OP_INSERT_NODES_AT_BEGINNING,
+    LIST_OP_INSERT_NODES_AT_END,
+    LIST_OP_INSERT_NODES_AFTER,
+    LIST_OP_EXTRACT_NODES,
+    LIST_OP_SORT_NODES,
+    LIST_OP_INSERT_NODE_SORTED,
+    LIST_OP_MERGE_SORTED_NODES,
+    LIST_OP_FIND_BY_VALUE,
+    LIST_OP_DELETE_BY_VALUE,
+    LIST_OP_GET_FRAGMENTATION,
+    LIST_OP_RELINEARIZE_NODES,
+    LIST_OP_CONCAT_NODES,
+    LIST_OP_SPLIT_NODES,
+    LIST_OP_LIST_INIT,
+    LIST_OP_LIST_USE_POOL,
+    LIST_OP_LIST_USE_INDEX,
+    LIST_OP_LIST_LINK_NODE_AFTER,
+    LIST_OP_LIST_UNLINK_NODE_AFTER,
+    LIST_OP_LIST_LINK_CHAIN_AFTER,
+    LIST_OP_LIST_INSERT_NODE_AT_BEGINNING,
+    LIST_OP_LIST_INSERT_NODE_AT_END,
+    LIST_OP_LIST_INSERT_NODE_AFTER,
+    LIST_OP_LIST_DELETE_NODE_AT_BEGINNING,
+    LIST_OP_LIST_DELETE_NODE,
+    LIST_OP_LIST_DISPLAY_ALL_NODES,
+    LIST_OP_LIST_GET_LENGTH,
+    LIST_OP_LIST_CLEAR,
+    LIST_OP_LIST_INSERT_NODES_AT_BEGINNING,
+    LIST_OP_LIST_INSERT_NODES_AT_END,
+    LIST_OP_LIST_INSERT_NODES_AFTER,
+    LIST_OP_LIST_EXTRACT_NODES,
+    LIST_OP_LIST_CURSOR_INIT,
+    LIST_OP_LIST_CURSOR_NEXT,
+    LIST_OP_LIST_CURSOR_SEEK,
+    LIST_OP_LIST_CURSOR_PEEK,
+    LIST_OP_LIST_CURSOR_GET_POSITION,
+    LIST_OP_LIST_CURSOR_INSERT_AFTER,
+    LIST_OP_LIST_CURSOR_INSERT_BEFORE,
+    LIST_OP_LIST_CURSOR_ERASE,
+    LIST_OP_LIST_SORT,
+    LIST_OP_LIST_INSERT_NODE_SORTED,
+    LIST_OP_LIST_MERGE_SORTED,
+    LIST_OP_LIST_FIND_BY_VALUE,
+    LIST_OP_LIST_DELETE_BY_VALUE,
+    LIST_OP_LIST_GET_FRAGMENTATION,
+    LIST_OP_LIST_COMPACT,
+    LIST_OP_LIST_COMPACT_BEGIN,
+    LIST_OP_LIST_COMPACT_STEP,
+    LIST_OP_LIST_CONCAT,
+    LIST_OP_LIST_SPLIT,
+    LIST_OP_LIST_SPLICE,
+    LIST_OP_COUNT  /* number of operations, not an operation */
+}ListOp_t;
+
+/* 
+   This typedef struct holds the counters of one operation.
+
+   Explanation of members:
+   - OpCalls: Calls per result, indexed by NodeStatus_t (OpCalls[NODE_NOK] counts failed allocations among others).
+   - OpNodes: Nodes stepped over, including the steps of List_/raw functions the operation calls.
+   - OpTotalNs / OpMaxNs: Total and largest time of one call.
+   - OpLatency: Calls per latency bucket (see List_Stats_Bucket_Limit).
+*/
+typedef struct{
+    uint64_t OpCalls[LIST_STATS_STATUSES];  /* calls per NodeStatus_t result */
+    uint64_t OpNodes;                       /* nodes traversed */
+    uint64_t OpTotalNs;                     /* time of all calls */
+    uint64_t OpMaxNs;                       /* slowest call */
+    uint64_t OpLatency[LIST_STATS_BUCKETS]; /* log2 latency histogram */
+}ListOpStats_t;
+
+/* 
+   This typedef struct holds a copy of all counters, as returned by List_Stats_Snapshot.
+
+   Explanation of members:
+   - StatsOps: Counters per operation, indexed by ListOp_t.
+   - StatsAllocs / StatsFrees: Nodes obtained and released (from malloc/free or from the list's node pool).
+   - StatsAllocFailures: Allocations that failed (a whole bulk chain counts once).
+*/
+typedef struct{
+    ListOpStats_t StatsOps[LIST_OP_COUNT];  /* counters per operation */
+    uint64_t StatsAllocs;                   /* nodes allocated */
+    uint64_t StatsFrees;                    /* nodes released */
+    uint64_t StatsAllocFailures;            /* failed allocations */
+}ListStats_t;
+
+/* 
+   This typedef struct is the per-call state of the hooks (declared by LIST_STATS_ENTER, not used directly).
+*/
+typedef struct{
+    uint64_t FrameStart;    /* clock ticks at entry */
+    uint64_t FrameNodes;    /* List_Stats_Nodes at entry */
+}ListStatsFrame_t;
+
+/* Section : Functions Declaration */
+
+NodeStatus_t List_Stats_Snapshot(ListStats_t *Stats);
+NodeStatus_t List_Stats_Reset(void);
+const char *List_Stats_Op_Name(ListOp_t Op);
+uint64_t List_Stats_Bucket_Limit(uint32_t Bucket);
+NodeStatus_t List_Stats_Percentile(const ListOpStats_t *OpStats, uint32_t Percent, uint64_t *LimitNs);
+
+/* Hooks used by SingleLinkedList.c through the macros above */
+extern __thread uint64_t List_Stats_Nodes;
+void List_Stats_Enter(ListStatsFrame_t *Frame);
+void List_Stats_Exit(const ListStatsFrame_t *Frame, ListOp_t Op, NodeStatus_t Status);
+void List_Stats_Count_Alloc(size_t Allocs, boolean Failed);
+void List_Stats_Count_Free(size_t Frees);
+
+#endif  //_LISTSTATS_H
\ No newline at end of file
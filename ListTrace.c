@@ -0,0 +1,673 @@
+/* 
+ * File:   ListTrace.c
+ * Author: Mohammed Khairallah
+ * linkedin : linkedin.com/in/mohammed-khairallah
+ * Created on October 23, 2026, 4:00 PM
+ */
+#include <string.h>
+#include <time.h>
+#if defined(_WIN32)
+#include <windows.h>
+#endif
+#include "ListTrace.h"
+#include "NodePool.h"
+#include "UnrolledList.h"
+#include "IndexedList.h"
+#include "CompactList.h"
+
+#define TRACE_LINE_MAX (128U)  /* Longest line of a text trace */
+
+/* 
+   This typedef struct holds a list handle with its own node pool, for the "pooled" backend.
+*/
+typedef struct{
+    List_t List;      /* list using Pool */
+    NodePool_t Pool;  /* node storage */
+}TracePooled_t;
+
+/* Storage for the list of any backend, provided by Trace_Replay */
+typedef union{
+    Node_t *Raw;               /* raw head pointer */
+    List_t Handle;             /* list handle */
+    TracePooled_t Pooled;      /* list handle with a pool */
+    UnrolledList_t Unrolled;   /* unrolled list */
+    IndexedList_t Indexed;     /* indexed list */
+    CompactList_t Compact;     /* compact list */
+}TraceContext_t;
+
+static const char *Trace_Op_Names[TRACE_OP_COUNT] = {
+    "unknown", "Insert_At_Beginning", "Insert_At_End", "Insert_After", "Display", "Get_Length", "Delete_Node",
+    "Delete_At_Beginning"
+};
+
+/* Function to read a monotonic clock in nanoseconds */
+static uint64_t Trace_Now_Ns(void){
+#if defined(_WIN32)
+    LARGE_INTEGER Counter;
+    LARGE_INTEGER Frequency;
+
+    QueryPerformanceCounter(&Counter);
+    QueryPerformanceFrequency(&Frequency);
+    return (uint64_t)((double)Counter.QuadPart * (1e9 / (double)Frequency.QuadPart));
+#else
+    struct timespec Now;
+
+    clock_gettime(CLOCK_MONOTONIC, &Now);
+    return ((uint64_t)Now.tv_sec * 1000000000ULL) + (uint64_t)Now.tv_nsec;
+#endif
+}
+
+/* Section : Backends, one Apply per list implementation mapping the records to its functions */
+
+static void Trace_Raw_Init(void *Context){
+    ((TraceContext_t *)Context)->Raw = NULL;
+}
+
+static NodeStatus_t Trace_Raw_Apply(void *Context, const TraceRecord_t *Record){
+    Node_t **NodeHead = &((TraceContext_t *)Context)->Raw;
+    uint32_t Data = Record->RecordData;
+    size_t Length = 0;
+    NodeStatus_t status = NODE_NOK;
+
+    switch(Record->RecordOp){
+        case TRACE_OP_INSERT_AT_BEGINNING: status = Insert_Node_At_Beginning(NodeHead, &Data); break;
+        case TRACE_OP_INSERT_AT_END: status = Insert_Node_At_End(NodeHead, &Data); break;
+        case TRACE_OP_INSERT_AFTER: status = Insert_Node_After_Wide(NodeHead, (size_t)Record->RecordPosition, &Data); break;
+        case TRACE_OP_DISPLAY: status = Display_All_Nodes(*NodeHead); break;
+        case TRACE_OP_GET_LENGTH: status = Get_Length_Wide(NodeHead, &Length); break;
+        case TRACE_OP_DELETE_NODE: status = Delete_Node_Wide(NodeHead, (size_t)Record->RecordPosition); break;
+        case TRACE_OP_DELETE_AT_BEGINNING: status = Delete_Node_At_Beginning(NodeHead); break;
+        default: status = NODE_NOK; break;
+    }
+    return status;
+}
+
+static size_t Trace_Raw_Length(void *Context){
+    size_t Length = 0;
+
+    (void)Get_Length_Wide(&((TraceContext_t *)Context)->Raw, &Length);
+    return Length;
+}
+
+static void Trace_Raw_Clear(void *Context){
+    while (NODE_OK == Delete_Node_At_Beginning(&((TraceContext_t *)Context)->Raw))
+    {
+        /* One node released per call */
+    }
+}
+
+static void Trace_Handle_Init(void *Context){
+    (void)List_Init(&((TraceContext_t *)Context)->Handle);
+}
+
+static NodeStatus_t Trace_Handle_Apply(void *Context, const TraceRecord_t *Record){
+    List_t *List = &((TraceContext_t *)Context)->Handle;  // Also the list of TracePooled_t, its first member
+    uint32_t Data = Record->RecordData;
+    size_t Length = 0;
+    NodeStatus_t status = NODE_NOK;
+
+    switch(Record->RecordOp){
+        case TRACE_OP_INSERT_AT_BEGINNING: status = List_Insert_Node_At_Beginning(List, &Data); break;
+        case TRACE_OP_INSERT_AT_END: status = List_Insert_Node_At_End(List, &Data); break;
+        case TRACE_OP_INSERT_AFTER: status = List_Insert_Node_After(List, (size_t)Record->RecordPosition, &Data); break;
+        case TRACE_OP_DISPLAY: status = List_Display_All_Nodes(List); break;
+        case TRACE_OP_GET_LENGTH: status = List_Get_Length(List, &Length); break;
+        case TRACE_OP_DELETE_NODE: status = List_Delete_Node(List, (size_t)Record->RecordPosition); break;
+        case TRACE_OP_DELETE_AT_BEGINNING: status = List_Delete_Node_At_Beginning(List); break;
+        default: status = NODE_NOK; break;
+    }
+    return status;
+}
+
+static size_t Trace_Handle_Length(void *Context){
+    return ((TraceContext_t *)Context)->Handle.ListLength;
+}
+
+static void Trace_Handle_Clear(void *Context){
+    (void)List_Clear(&((TraceContext_t *)Context)->Handle);
+}
+
+static void Trace_Pooled_Init(void *Context){
+    TracePooled_t *Pooled = &((TraceContext_t *)Context)->Pooled;
+
+    (void)List_Init(&Pooled->List);
+    if(NODE_OK == NodePool_Init(&Pooled->Pool, 0U)){
+        (void)List_Use_Pool(&Pooled->List, &Pooled->Pool);
+    }
+}
+
+static void Trace_Pooled_Clear(void *Context){
+    TracePooled_t *Pooled = &((TraceContext_t *)Context)->Pooled;
+
+    (void)List_Clear(&Pooled->List);
+    if(NULL != Pooled->List.ListPool){
+        (void)NodePool_Destroy(&Pooled->Pool);
+    }
+}
+
+static void Trace_Unrolled_Init(void *Context){
+    (void)Unrolled_Init(&((TraceContext_t *)Context)->Unrolled);
+}
+
+static NodeStatus_t Trace_Unrolled_Apply(void *Context, const TraceRecord_t *Record){
+    UnrolledList_t *List = &((TraceContext_t *)Context)->Unrolled;
+    uint32_t Data = Record->RecordData;
+    size_t Length = 0;
+    NodeStatus_t status = NODE_NOK;
+
+    switch(Record->RecordOp){
+        case TRACE_OP_INSERT_AT_BEGINNING: status = Unrolled_Insert_Node_At_Beginning(List, &Data); break;
+        case TRACE_OP_INSERT_AT_END: status = Unrolled_Insert_Node_At_End(List, &Data); break;
+        case TRACE_OP_INSERT_AFTER: status = Unrolled_Insert_Node_After(List, (size_t)Record->RecordPosition, &Data); break;
+        case TRACE_OP_DISPLAY: status = Unrolled_Display_All_Nodes(List); break;
+        case TRACE_OP_GET_LENGTH: status = Unrolled_Get_Length(List, &Length); break;
+        case TRACE_OP_DELETE_NODE: status = Unrolled_Delete_Node(List, (size_t)Record->RecordPosition); break;
+        case TRACE_OP_DELETE_AT_BEGINNING: status = Unrolled_Delete_Node_At_Beginning(List); break;
+        default: status = NODE_NOK; break;
+    }
+    return status;
+}
+
+static size_t Trace_Unrolled_Length(void *Context){
+    size_t Length = 0;
+
+    (void)Unrolled_Get_Length(&((TraceContext_t *)Context)->Unrolled, &Length);
+    return Length;
+}
+
+static void Trace_Unrolled_Clear(void *Context){
+    (void)Unrolled_Clear(&((TraceContext_t *)Context)->Unrolled);
+}
+
+static void Trace_Indexed_Init(void *Context){
+    (void)Indexed_Init(&((TraceContext_t *)Context)->Indexed);
+}
+
+static NodeStatus_t Trace_Indexed_Apply(void *Context, const TraceRecord_t *Record){
+    IndexedList_t *List = &((TraceContext_t *)Context)->Indexed;
+    uint32_t Data = Record->RecordData;
+    size_t Length = 0;
+    NodeStatus_t status = NODE_NOK;
+
+    switch(Record->RecordOp){
+        case TRACE_OP_INSERT_AT_BEGINNING: status = Indexed_Insert_Node_At_Beginning(List, &Data); break;
+        case TRACE_OP_INSERT_AT_END: status = Indexed_Insert_Node_At_End(List, &Data); break;
+        case TRACE_OP_INSERT_AFTER: status = Indexed_Insert_Node_After(List, (size_t)Record->RecordPosition, &Data); break;
+        case TRACE_OP_DISPLAY: status = Indexed_Display_All_Nodes(List); break;
+        case TRACE_OP_GET_LENGTH: status = Indexed_Get_Length(List, &Length); break;
+        case TRACE_OP_DELETE_NODE: status = Indexed_Delete_Node(List, (size_t)Record->RecordPosition); break;
+        case TRACE_OP_DELETE_AT_BEGINNING: status = Indexed_Delete_Node_At_Beginning(List); break;
+        default: status = NODE_NOK; break;
+    }
+    return status;
+}
+
+static size_t Trace_Indexed_Length(void *Context){
+    size_t Length = 0;
+
+    (void)Indexed_Get_Length(&((TraceContext_t *)Context)->Indexed, &Length);
+    return Length;
+}
+
+static void Trace_Indexed_Clear(void *Context){
+    (void)Indexed_Clear(&((TraceContext_t *)Context)->Indexed);
+}
+
+static void Trace_Compact_Init(void *Context){
+    (void)Compact_Init(&((TraceContext_t *)Context)->Compact);
+}
+
+static NodeStatus_t Trace_Compact_Apply(void *Context, const TraceRecord_t *Record){
+    CompactList_t *List = &((TraceContext_t *)Context)->Compact;
+    uint32_t Data = Record->RecordData;
+    size_t Length = 0;
+    NodeStatus_t status = NODE_NOK;
+
+    switch(Record->RecordOp){
+        case TRACE_OP_INSERT_AT_BEGINNING: status = Compact_Insert_Node_At_Beginning(List, &Data); break;
+        case TRACE_OP_INSERT_AT_END: status = Compact_Insert_Node_At_End(List, &Data); break;
+        case TRACE_OP_INSERT_AFTER: status = Compact_Insert_Node_After(List, (size_t)Record->RecordPosition, &Data); break;
+        case TRACE_OP_DISPLAY: status = Compact_Display_All_Nodes(List); break;
+        case TRACE_OP_GET_LENGTH: status = Compact_Get_Length(List, &Length); break;
+        case TRACE_OP_DELETE_NODE: status = Compact_Delete_Node(List, (size_t)Record->RecordPosition); break;
+        case TRACE_OP_DELETE_AT_BEGINNING: status = Compact_Delete_Node_At_Beginning(List); break;
+        default: status = NODE_NOK; break;
+    }
+    return status;
+}
+
+static size_t Trace_Compact_Length(void *Context){
+    size_t Length = 0;
+
+    (void)Compact_Get_Length(&((TraceContext_t *)Context)->Compact, &Length);
+    return Length;
+}
+
+static void Trace_Compact_Clear(void *Context){
+    (void)Compact_Clear(&((TraceContext_t *)Context)->Compact);
+}
+
+static const TraceBackend_t Trace_Backends[] = {
+    {"raw", Trace_Raw_Init, Trace_Raw_Apply, Trace_Raw_Length, Trace_Raw_Clear},
+    {"handle", Trace_Handle_Init, Trace_Handle_Apply, Trace_Handle_Length, Trace_Handle_Clear},
+    {"pooled", Trace_Pooled_Init, Trace_Handle_Apply, Trace_Handle_Length, Trace_Pooled_Clear},
+    {"unrolled", Trace_Unrolled_Init, Trace_Unrolled_Apply, Trace_Unrolled_Length, Trace_Unrolled_Clear},
+    {"indexed", Trace_Indexed_Init, Trace_Indexed_Apply, Trace_Indexed_Length, Trace_Indexed_Clear},
+    {"compact", Trace_Compact_Init, Trace_Compact_Apply, Trace_Compact_Length, Trace_Compact_Clear}
+};
+
+/* Section : Recording */
+
+/* Function to write the records collected by a binary writer */
+static NodeStatus_t Trace_Writer_Flush(TraceWriter_t *Writer){
+    NodeStatus_t status = NODE_OK;
+
+    if(0U != Writer->WriterUsed){
+        if(Writer->WriterUsed != fwrite(Writer->WriterBuffer, sizeof(TraceRecord_t), Writer->WriterUsed, Writer->WriterFile)){
+            status = NODE_NOK;  // Disk full or I/O error
+        }
+        Writer->WriterUsed = 0;
+    }
+    return status;
+}
+
+/*
+   This function Trace_Writer_Open is responsible for creating a trace file and preparing it for recording.
+   An existing file at Path is overwritten. A binary trace gets its header count from Trace_Writer_Close.
+
+   Parameters:
+   - Writer: A pointer to the writer to be initialized.
+   - Path: The path of the file to create.
+   - Format: TRACE_FORMAT_BINARY (compact, fastest to load) or TRACE_FORMAT_TEXT (readable and editable).
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if a pointer is NULL, or NODE_NOK if the file could not be created.
+*/
+NodeStatus_t Trace_Writer_Open(TraceWriter_t *Writer, const char *Path, TraceFormat_t Format){
+    NodeStatus_t status = NODE_NOK;
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == Writer)||(NULL == Path)){
+        status = NODE_NULL_POINTER;
+    }
+    else{
+        TraceHeader_t Header = {TRACE_MAGIC, TRACE_VERSION, 0U};
+        int Written = 0;
+
+        Writer->WriterFormat = Format;
+        Writer->WriterCount = 0;
+        Writer->WriterUsed = 0;
+        Writer->WriterFile = fopen(Path, (TRACE_FORMAT_TEXT == Format) ? "w" : "wb");
+        if(NULL != Writer->WriterFile){
+            if(TRACE_FORMAT_TEXT == Format){
+                Written = (0 < fprintf(Writer->WriterFile, "# SLT1 trace: op position data\n")) ? 1 : 0;
+            }
+            else{
+                Written = (1U == fwrite(&Header, sizeof(Header), 1U, Writer->WriterFile)) ? 1 : 0;
+            }
+        }
+        if(0 != Written){
+            status = NODE_OK;
+        }
+        else if(NULL != Writer->WriterFile){
+            fclose(Writer->WriterFile);
+            Writer->WriterFile = NULL;
+            status = NODE_NOK;
+        }
+        else{
+            status = NODE_NOK;
+        }
+    }
+    return status;
+}
+
+/*
+   This function Trace_Writer_Append is responsible for recording one operation at the end of a trace being written.
+
+   Parameters:
+   - Writer: A pointer to an open writer.
+   - Op: The operation.
+   - Position: The position it used (ignored, and recorded as 0, for operations without a position).
+   - Data: The value it inserted (ignored, and recorded as 0, for operations without a value).
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if Writer is NULL or not open,
+                   or NODE_NOK if Op is not an operation or on a write error.
+*/
+NodeStatus_t Trace_Writer_Append(TraceWriter_t *Writer, TraceOp_t Op, size_t Position, uint32_t Data){
+    NodeStatus_t status = NODE_OK;
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == Writer)||(NULL == Writer->WriterFile)){
+        status = NODE_NULL_POINTER;
+    }
+    else if((Op < TRACE_OP_INSERT_AT_BEGINNING)||(Op >= TRACE_OP_COUNT)){
+        status = NODE_NOK;
+    }
+    else{
+        TraceRecord_t Record = {(uint32_t)Op, 0U, 0U};
+
+        if((TRACE_OP_INSERT_AT_BEGINNING == Op)||(TRACE_OP_INSERT_AT_END == Op)||(TRACE_OP_INSERT_AFTER == Op)){
+            Record.RecordData = Data;
+        }
+        if((TRACE_OP_INSERT_AFTER == Op)||(TRACE_OP_DELETE_NODE == Op)){
+            Record.RecordPosition = (uint64_t)Position;
+        }
+        if(TRACE_FORMAT_TEXT == Writer->WriterFormat){
+            if(0 > fprintf(Writer->WriterFile, "%u %llu %u\n", Record.RecordOp, Record.RecordPosition, Record.RecordData)){
+                status = NODE_NOK;
+            }
+        }
+        else{
+            if(TRACE_WRITER_BUFFER == Writer->WriterUsed){
+                status = Trace_Writer_Flush(Writer);
+            }
+            Writer->WriterBuffer[Writer->WriterUsed] = Record;
+            Writer->WriterUsed++;
+        }
+        Writer->WriterCount++;
+    }
+    return status;
+}
+
+/*
+   This function Trace_Writer_Close is responsible for finishing a trace file.
+   The writer is closed even when an error is reported; the file is then incomplete.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if Writer is NULL or not open, or NODE_NOK on a write error.
+*/
+NodeStatus_t Trace_Writer_Close(TraceWriter_t *Writer){
+    NodeStatus_t status = NODE_NOK;
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == Writer)||(NULL == Writer->WriterFile)){
+        status = NODE_NULL_POINTER;
+    }
+    else{
+        TraceHeader_t Header = {TRACE_MAGIC, TRACE_VERSION, Writer->WriterCount};
+
+        status = NODE_OK;
+        if(TRACE_FORMAT_BINARY == Writer->WriterFormat){
+            status = Trace_Writer_Flush(Writer);
+            if((NODE_OK == status) &&
+               ((0 != fseek(Writer->WriterFile, 0L, SEEK_SET)) || (1U != fwrite(&Header, sizeof(Header), 1U, Writer->WriterFile)))){
+                status = NODE_NOK;
+            }
+        }
+        if((0 != fclose(Writer->WriterFile)) && (NODE_OK == status)){
+            status = NODE_NOK;  // Buffered data could not be written
+        }
+        Writer->WriterFile = NULL;
+    }
+    return status;
+}
+
+/* Section : Loading */
+
+/* Function to read the records of a binary trace whose magic was already read */
+static NodeStatus_t Trace_Load_Binary(FILE *File, TraceRecord_t **Records, size_t *Count){
+    NodeStatus_t status = NODE_NOK;
+    TraceHeader_t Header;
+
+    if((0 == fseek(File, 0L, SEEK_SET)) && (1U == fread(&Header, sizeof(Header), 1U, File)) &&
+       (TRACE_VERSION == Header.HeaderVersion) && (Header.HeaderCount <= ((size_t)-1 / sizeof(TraceRecord_t)))){
+        *Count = (size_t)Header.HeaderCount;
+        *Records = (TraceRecord_t *)malloc((0U == *Count) ? 1U : (*Count * sizeof(TraceRecord_t)));
+        if((NULL != *Records) && (*Count == fread(*Records, sizeof(TraceRecord_t), *Count, File))){
+            status = NODE_OK;
+        }
+    }
+    return status;
+}
+
+/* Function to read the records of a text trace, growing the array as lines are read */
+static NodeStatus_t Trace_Load_Text(FILE *File, TraceRecord_t **Records, size_t *Count){
+    NodeStatus_t status = NODE_OK;
+    char Line[TRACE_LINE_MAX];
+    size_t Capacity = 0;
+
+    (void)fseek(File, 0L, SEEK_SET);
+    while ((NODE_OK == status) && (NULL != fgets(Line, (int)sizeof(Line), File)))
+    {
+        unsigned int Op = 0;
+        unsigned long long Position = 0;
+        unsigned int Data = 0;
+        const char *Text = Line + strspn(Line, " \t");
+
+        if(('#' == Text[0])||('\n' == Text[0])||('\r' == Text[0])||('\0' == Text[0])){
+            /* Comment or blank line */
+        }
+        else if(3 != sscanf(Text, "%u %llu %u", &Op, &Position, &Data)){
+            status = NODE_NOK;  // Malformed line
+        }
+        else{
+            if(*Count == Capacity){
+                TraceRecord_t *Grown = NULL;
+
+                Capacity = (0U == Capacity) ? 1024U : (Capacity * 2U);
+                Grown = (TraceRecord_t *)realloc(*Records, Capacity * sizeof(TraceRecord_t));
+                if(NULL == Grown){
+                    status = NODE_NOK;
+                }
+                else{
+                    *Records = Grown;
+                }
+            }
+            if(NODE_OK == status){
+                (*Records)[*Count].RecordOp = Op;
+                (*Records)[*Count].RecordData = Data;
+                (*Records)[*Count].RecordPosition = Position;
+                (*Count)++;
+            }
+        }
+    }
+    if((NODE_OK == status) && (NULL == *Records)){
+        *Records = (TraceRecord_t *)malloc(sizeof(TraceRecord_t));  // Empty trace, still a block to free
+        status = (NULL == *Records) ? NODE_NOK : NODE_OK;
+    }
+    return status;
+}
+
+/*
+   This function Trace_Load is responsible for reading a whole trace into memory, so it can be replayed without I/O.
+   The format (binary or text) is recognized from the start of the file.
+
+   Parameters:
+   - Path: The path of the trace.
+   - Records: A pointer that receives a malloc'ed array of the records, to be released with free().
+   - Count: A pointer that receives the number of records.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if a pointer is NULL, NODE_EMPTY if the trace holds no record,
+                   or NODE_NOK if the file cannot be read, is malformed or holds an unknown operation (nothing is
+                   returned then).
+*/
+NodeStatus_t Trace_Load(const char *Path, TraceRecord_t **Records, size_t *Count){
+    NodeStatus_t status = NODE_NOK;
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == Path)||(NULL == Records)||(NULL == Count)){
+        status = NODE_NULL_POINTER;
+    }
+    else{
+        FILE *File = fopen(Path, "rb");
+        uint32_t Magic = 0;
+
+        *Records = NULL;
+        *Count = 0;
+        if(NULL != File){
+            if((1U == fread(&Magic, sizeof(Magic), 1U, File)) && (TRACE_MAGIC == Magic)){
+                status = Trace_Load_Binary(File, Records, Count);
+            }
+            else{
+                status = Trace_Load_Text(File, Records, Count);
+            }
+            fclose(File);
+        }
+        if(NODE_OK == status){
+            size_t counter = 0;
+
+            for(counter = 0; (counter < *Count) && (NODE_OK == status); counter++){
+                if(((*Records)[counter].RecordOp < TRACE_OP_INSERT_AT_BEGINNING)||((*Records)[counter].RecordOp >= TRACE_OP_COUNT)){
+                    status = NODE_NOK;  // Unknown operation
+                }
+            }
+        }
+        if(NODE_OK != status){
+            free(*Records);
+            *Records = NULL;
+            *Count = 0;
+        }
+        else if(0U == *Count){
+            status = NODE_EMPTY;
+        }
+        else{
+            /* Nothing, the records are returned */
+        }
+    }
+    return status;
+}
+
+/* Section : Replay */
+
+/* Function to get the name of an operation, or "unknown" */
+const char *Trace_Op_Name(TraceOp_t Op){
+    return ((Op >= TRACE_OP_INSERT_AT_BEGINNING) && (Op < TRACE_OP_COUNT)) ? Trace_Op_Names[Op] : Trace_Op_Names[0];
+}
+
+/* Function to get a backend by index (0, 1, ...), or NULL past the last one */
+const TraceBackend_t *Trace_Get_Backend(size_t Index){
+    return (Index < (sizeof(Trace_Backends) / sizeof(Trace_Backends[0]))) ? &Trace_Backends[Index] : NULL;
+}
+
+/* Function to get a backend by name ("raw", "handle", "pooled", "unrolled", "indexed", "compact"), or NULL */
+const TraceBackend_t *Trace_Find_Backend(const char *Name){
+    const TraceBackend_t *Backend = NULL;
+    size_t counter = 0;
+
+    while ((NULL != Name) && (NULL == Backend) && (NULL != Trace_Get_Backend(counter)))
+    {
+        if(0 == strcmp(Name, Trace_Backends[counter].BackendName)){
+            Backend = &Trace_Backends[counter];
+        }
+        counter++;
+    }
+    return Backend;
+}
+
+/* Function to get the report slot of a record: its operation, or 0 for an unknown operation */
+static uint32_t Trace_Op_Slot(const TraceRecord_t *Record){
+    return (Record->RecordOp < TRACE_OP_COUNT) ? Record->RecordOp : 0U;
+}
+
+static int Trace_Compare_Ns(const void *Left, const void *Right){
+    uint64_t LeftValue = *(const uint64_t *)Left;
+    uint64_t RightValue = *(const uint64_t *)Right;
+
+    return (LeftValue > RightValue) - (LeftValue < RightValue);
+}
+
+/* Function to fill the latency statistics of one operation from its sorted call times */
+static void Trace_Summarize(TraceOpReport_t *OpReport, const uint64_t *Sorted, size_t Count){
+    double Total = 0.0;
+    size_t counter = 0;
+
+    for(counter = 0; counter < Count; counter++){
+        Total += (double)Sorted[counter];
+    }
+    OpReport->MeanNs = Total / (double)Count;
+    OpReport->P50Ns = (double)Sorted[((Count * 50U) + 99U) / 100U - 1U];  // Nearest rank
+    OpReport->P90Ns = (double)Sorted[((Count * 90U) + 99U) / 100U - 1U];
+    OpReport->P99Ns = (double)Sorted[((Count * 99U) + 99U) / 100U - 1U];
+    OpReport->MaxNs = (double)Sorted[Count - 1U];
+}
+
+/*
+   This function Trace_Replay is responsible for running a trace against one backend and measuring it.
+
+   Parameters:
+   - Backend: The list implementation, from Trace_Get_Backend or Trace_Find_Backend.
+   - Records / Count: The trace, e.g. from Trace_Load.
+   - Report: A pointer to the report to fill.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if a pointer is NULL, NODE_EMPTY if Count is 0,
+                   or NODE_NOK if the memory for the latencies could not be allocated.
+
+   Algorithm:
+   - Pass 1 replays the whole trace at full speed on a fresh list, timed as one block: total time and throughput.
+   - Pass 2 replays it again on a fresh list and times every call on its own. Reading the clock around each call adds
+     its own cost, which is why the throughput comes from pass 1.
+   - The call times of each operation are sorted to get the percentiles. Display records print the list as the
+     original operation did. Records with an unknown operation return NODE_NOK and are reported in ReportOps[0].
+*/
+NodeStatus_t Trace_Replay(const TraceBackend_t *Backend, const TraceRecord_t *Records, size_t Count, TraceReport_t *Report){
+    NodeStatus_t status = NODE_NOK;
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == Backend)||(NULL == Records)||(NULL == Report)){
+        status = NODE_NULL_POINTER;
+    }
+    else if(0U == Count){
+        status = NODE_EMPTY;
+    }
+    else{
+        uint64_t *Latencies = (uint64_t *)malloc(Count * sizeof(uint64_t));
+        uint64_t *Sorted = (uint64_t *)malloc(Count * sizeof(uint64_t));
+        TraceContext_t Context;
+        uint64_t Start = 0;
+        size_t counter = 0;
+        uint32_t Op = 0;
+
+        if((NULL == Latencies)||(NULL == Sorted)){
+            status = NODE_NOK;
+        }
+        else{
+            memset(Report, 0, sizeof(TraceReport_t));
+            Report->ReportRecords = Count;
+
+            Backend->BackendInit(&Context);
+            Start = Trace_Now_Ns();
+            for(counter = 0; counter < Count; counter++){
+                (void)Backend->BackendApply(&Context, &Records[counter]);
+            }
+            Report->ReportTotalNs = Trace_Now_Ns() - Start;
+            Report->ReportFinalLength = Backend->BackendLength(&Context);
+            Backend->BackendClear(&Context);
+            Report->ReportOpsPerSec = (0U == Report->ReportTotalNs) ? 0.0 : ((double)Count * 1e9 / (double)Report->ReportTotalNs);
+
+            Backend->BackendInit(&Context);
+            for(counter = 0; counter < Count; counter++){
+                TraceOpReport_t *OpReport = &Report->ReportOps[Trace_Op_Slot(&Records[counter])];
+                NodeStatus_t Result = NODE_NOK;
+
+                Start = Trace_Now_Ns();
+                Result = Backend->BackendApply(&Context, &Records[counter]);
+                Latencies[counter] = Trace_Now_Ns() - Start;
+                OpReport->OpCount++;
+                OpReport->OpNotOk += (NODE_OK == Result) ? 0U : 1U;
+            }
+            Backend->BackendClear(&Context);
+
+            for(Op = 0; Op < TRACE_OP_COUNT; Op++){
+                size_t Used = 0;
+
+                for(counter = 0; counter < Count; counter++){
+                    if(Op == Trace_Op_Slot(&Records[counter])){
+                        Sorted[Used] = Latencies[counter];
+                        Used++;
+                    }
+                }
+                if(0U != Used){
+                    qsort(Sorted, Used, sizeof(uint64_t), Trace_Compare_Ns);
+                    Trace_Summarize(&Report->ReportOps[Op], Sorted, Used);
+                }
+            }
+            status = NODE_OK;
+        }
+        free(Latencies);
+        free(Sorted);
+    }
+    return status;
+}
\ No newline at end of file
@@ -0,0 +1,142 @@
+/* 
+ * File:   ListTrace.h
+ * Author: Mohammed Khairallah
+ * linkedin : linkedin.com/in/mohammed-khairallah
+ * Created on October 23, 2026, 4:00 PM
+ */
+#ifndef _LISTTRACE_H
+#define _LISTTRACE_H
+
+/* Section : Includes */
+#include "SingleLinkedList.h"
+
+/* Section : Macro Declarations */
+
+#define TRACE_MAGIC (0x31544C53U)    /* "SLT1" when read as little-endian bytes */
+#define TRACE_VERSION (1U)           /* Format version written by this code */
+#define TRACE_WRITER_BUFFER (1024U)  /* Records the binary writer collects before one fwrite */
+
+/* Section : Macro Functions Declarations */
+
+
+/* Section : Data type Declarations */
+
+/* Operations of a trace, numbered like the choices of the Application menu */
+typedef enum{
+    TRACE_OP_INSERT_AT_BEGINNING = 1,  /* Insert_Node_At_Beginning(Data) */
+    TRACE_OP_INSERT_AT_END,            /* Insert_Node_At_End(Data) */
+    TRACE_OP_INSERT_AFTER,             /* Insert_Node_After_Wide(Position, Data) */
+    TRACE_OP_DISPLAY,                  /* Display_All_Nodes */
+    TRACE_OP_GET_LENGTH,               /* Get_Length_Wide */
+    TRACE_OP_DELETE_NODE,              /* Delete_Node_Wide(Position) */
+    TRACE_OP_DELETE_AT_BEGINNING,      /* Delete_Node_At_Beginning */
+    TRACE_OP_COUNT                     /* one past the last operation, not an operation */
+}TraceOp_t;
+
+/* File formats of a trace */
+typedef enum{
+    TRACE_FORMAT_BINARY = 0,  /* TraceHeader_t followed by packed TraceRecord_t, 16 bytes per operation */
+    TRACE_FORMAT_TEXT         /* one "op position data" line per operation, lines starting with # are comments */
+}TraceFormat_t;
+
+/* 
+   This typedef struct represents one recorded operation.
+
+   Explanation of members:
+   - RecordOp: The operation, a TraceOp_t.
+   - RecordData: The value inserted (0 for operations without a value).
+   - RecordPosition: The position of Insert_After and Delete_Node (0 for the others).
+*/
+typedef struct{
+    uint32_t RecordOp;        /* TraceOp_t */
+    uint32_t RecordData;      /* value inserted */
+    uint64_t RecordPosition;  /* position used */
+}TraceRecord_t;
+
+/* 
+   This typedef struct represents the header at the start of a binary trace file, laid out like SnapshotHeader_t.
+   Files are written in the byte order of the recording machine.
+*/
+typedef struct{
+    uint32_t HeaderMagic;    /* TRACE_MAGIC */
+    uint32_t HeaderVersion;  /* TRACE_VERSION */
+    uint64_t HeaderCount;    /* number of records */
+}TraceHeader_t;
+
+/* 
+   This typedef struct represents a trace file being recorded one operation at a time.
+*/
+typedef struct{
+    FILE *WriterFile;                               /* file being written */
+    TraceFormat_t WriterFormat;                     /* binary or text */
+    uint64_t WriterCount;                           /* records appended so far */
+    size_t WriterUsed;                              /* records waiting in WriterBuffer (binary format) */
+    TraceRecord_t WriterBuffer[TRACE_WRITER_BUFFER];  /* records not yet written */
+}TraceWriter_t;
+
+/* 
+   This typedef struct represents a list implementation a trace can be replayed against.
+   The functions work on an opaque context that Trace_Replay provides.
+
+   Explanation of members:
+   - BackendName: The name used to select it, e.g. "raw" or "unrolled".
+   - BackendInit / BackendClear: Set up an empty list / release all its nodes.
+   - BackendApply: Run one record, returning the status of the list function.
+   - BackendLength: Report the current length.
+*/
+typedef struct{
+    const char *BackendName;                                                   /* selection name */
+    void (*BackendInit)(void *Context);                                        /* empty list */
+    NodeStatus_t (*BackendApply)(void *Context, const TraceRecord_t *Record);  /* one operation */
+    size_t (*BackendLength)(void *Context);                                    /* current length */
+    void (*BackendClear)(void *Context);                                       /* release the list */
+}TraceBackend_t;
+
+/* 
+   This typedef struct holds the latency statistics of one operation of a replay.
+
+   Explanation of members:
+   - OpCount: The number of records with this operation.
+   - OpNotOk: The number of those whose list function did not return NODE_OK (e.g. a position past the end).
+   - MeanNs / P50Ns / P90Ns / P99Ns / MaxNs: Distribution of the time of one call.
+*/
+typedef struct{
+    uint64_t OpCount;  /* records */
+    uint64_t OpNotOk;  /* results other than NODE_OK */
+    double MeanNs;     /* mean ns per call */
+    double P50Ns;      /* median */
+    double P90Ns;      /* 90th percentile */
+    double P99Ns;      /* 99th percentile */
+    double MaxNs;      /* slowest call */
+}TraceOpReport_t;
+
+/* 
+   This typedef struct holds the result of Trace_Replay.
+
+   Explanation of members:
+   - ReportRecords: The number of records replayed.
+   - ReportTotalNs / ReportOpsPerSec: Time of the untimed-per-call pass over the whole trace, and the throughput.
+   - ReportFinalLength: The list length at the end of the trace.
+   - ReportOps: Latencies per operation, from a second pass that times every call (indexed by TraceOp_t,
+                ReportOps[0] counts records with an unknown operation).
+*/
+typedef struct{
+    uint64_t ReportRecords;                      /* records replayed */
+    uint64_t ReportTotalNs;                      /* full speed time of the trace */
+    double ReportOpsPerSec;                      /* full speed throughput */
+    size_t ReportFinalLength;                    /* length after the last record */
+    TraceOpReport_t ReportOps[TRACE_OP_COUNT];   /* latencies per operation */
+}TraceReport_t;
+
+/* Section : Functions Declaration */
+
+NodeStatus_t Trace_Writer_Open(TraceWriter_t *Writer, const char *Path, TraceFormat_t Format);
+NodeStatus_t Trace_Writer_Append(TraceWriter_t *Writer, TraceOp_t Op, size_t Position, uint32_t Data);
+NodeStatus_t Trace_Writer_Close(TraceWriter_t *Writer);
+NodeStatus_t Trace_Load(const char *Path, TraceRecord_t **Records, size_t *Count);
+const char *Trace_Op_Name(TraceOp_t Op);
+const TraceBackend_t *Trace_Get_Backend(size_t Index);
+const TraceBackend_t *Trace_Find_Backend(const char *Name);
+NodeStatus_t Trace_Replay(const TraceBackend_t *Backend, const TraceRecord_t *Records, size_t Count, TraceReport_t *Report);
+
+#endif  //_LISTTRACE_H
\ No newline at end of file
@@ -0,0 +1,547 @@
+/* 
+ * File:   NodePool.c
+ * Author: Mohammed Khairallah
+ * linkedin : linkedin.com/in/mohammed-khairallah
+ * Created on October 18, 2026, 10:00 AM
+ */
+#include "NodePool.h"
+
+/*
+   This function NodePool_Add_Slab is responsible for growing a pool by one slab.
+   The new slab becomes the bump region of the pool, so its nodes are handed out in address order.
+
+   Parameters:
+   - Pool: A pointer to the pool to grow.
+   - SlabNodes: The number of nodes in the new slab (PoolSlabNodes, or more for a large chain).
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success or NODE_NOK if the slab could not be allocated.
+*/
+static NodeStatus_t NodePool_Add_Slab(NodePool_t *Pool, size_t SlabNodes){
+    NodeStatus_t status = NODE_NOK;
+    size_t SlabBytes = sizeof(NodeSlab_t) + (SlabNodes * sizeof(Node_t));
+    NodeSlab_t *NewSlab = (NodeSlab_t *)malloc(SlabBytes);
+
+    if(NULL == NewSlab){  // Check if memory allocation failed
+        status = NODE_NOK;
+    }
+    else{
+        NewSlab->SlabNodes = SlabNodes;
+        NewSlab->SlabLink = Pool->PoolSlabs;
+        Pool->PoolSlabs = NewSlab;
+
+        /* Any nodes left in the previous bump region go to the free list so they are not lost */
+        while (Pool->PoolBumpNext != Pool->PoolBumpEnd)
+        {
+            Pool->PoolBumpNext->NodeLink = Pool->PoolFreeList;
+            Pool->PoolFreeList = Pool->PoolBumpNext;
+            Pool->PoolBumpNext++;
+        }
+        Pool->PoolBumpNext = &NewSlab->SlabStorage[0];
+        Pool->PoolBumpEnd = &NewSlab->SlabStorage[NewSlab->SlabNodes];
+
+        Pool->PoolStats.SlabCount++;
+        Pool->PoolStats.NodeCapacity += NewSlab->SlabNodes;
+        Pool->PoolStats.NodesFree += NewSlab->SlabNodes;
+        Pool->PoolStats.BytesReserved += SlabBytes;
+        status = NODE_OK;
+    }
+    return status;
+}
+
+/*
+   This function NodePool_Carve_Run is responsible for cutting NodeCount consecutive nodes out of the bump region.
+   A new slab of max(PoolSlabNodes, NodeCount) nodes is added first when the bump region is too small.
+
+   Parameters:
+   - Pool: A pointer to the pool to allocate from.
+   - NodeCount: The number of nodes requested (at least 1).
+   - FirstNode: A double pointer that receives the first node of the run.
+   - LastNode: A double pointer that receives the last node of the run.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success or NODE_NOK if a new slab could not be allocated.
+                   The statistics are left to the caller.
+*/
+static NodeStatus_t NodePool_Carve_Run(NodePool_t *Pool, size_t NodeCount, Node_t **FirstNode, Node_t **LastNode){
+    NodeStatus_t status = NODE_OK;
+    Node_t *NodeCopy = NULL;
+    size_t counter = 0;
+
+    if((size_t)(Pool->PoolBumpEnd - Pool->PoolBumpNext) < NodeCount){  /* Run does not fit in the current slab */
+        status = NodePool_Add_Slab(Pool, (NodeCount > Pool->PoolSlabNodes) ? NodeCount : Pool->PoolSlabNodes);
+    }
+    if(NODE_OK == status){
+        NodeCopy = Pool->PoolBumpNext;
+        for(counter = 1; counter < NodeCount; counter++){
+            NodeCopy->NodeLink = NodeCopy + 1;
+            NodeCopy++;
+        }
+        NodeCopy->NodeLink = NULL;
+        *FirstNode = Pool->PoolBumpNext;
+        *LastNode = NodeCopy;
+        Pool->PoolBumpNext += NodeCount;
+    }
+    return status;
+}
+
+/*
+   This function NodePool_Init is responsible for initializing an empty node pool.
+   No memory is allocated until the first node is requested.
+
+   Parameters:
+   - Pool: A pointer to the pool to be initialized.
+   - SlabNodes: The number of nodes allocated per slab, or 0 to use NODE_POOL_DEFAULT_SLAB_NODES.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success or NODE_NULL_POINTER if Pool is NULL.
+*/
+NodeStatus_t NodePool_Init(NodePool_t *Pool, size_t SlabNodes){
+    NodeStatus_t status = NODE_NOK;
+    NodePoolStats_t EmptyStats = {0};
+
+    /* Check for NULL pointers in the input parameters */
+    if(NULL == Pool){
+        status = NODE_NULL_POINTER;
+    }
+    else{
+        Pool->PoolSlabs = NULL;
+        Pool->PoolFreeList = NULL;
+        Pool->PoolBumpNext = NULL;
+        Pool->PoolBumpEnd = NULL;
+        Pool->PoolSlabNodes = (0 == SlabNodes) ? NODE_POOL_DEFAULT_SLAB_NODES : SlabNodes;
+        Pool->PoolStats = EmptyStats;
+        status = NODE_OK;
+    }
+    return status;
+}
+
+/*
+   This function NodePool_Alloc is responsible for handing out one node from a pool.
+   It takes a pointer to the pool (Pool) and a double pointer (Node) that receives the node.
+
+   Parameters:
+   - Pool: A pointer to the pool to allocate from.
+   - Node: A double pointer that receives the allocated (uninitialized) node.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if a pointer is NULL, or NODE_NOK if a new slab could not be allocated.
+
+   Algorithm:
+   - Recently released nodes are reused first by popping the free list, which keeps the working set warm in the cache.
+   - Otherwise the next never-used node of the newest slab is taken.
+   - Only when both are exhausted is a new slab allocated with malloc, so malloc is called once per PoolSlabNodes nodes.
+*/
+NodeStatus_t NodePool_Alloc(NodePool_t *Pool, Node_t **Node){
+    NodeStatus_t status = NODE_NOK;
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == Pool)||(NULL == Node)){
+        status = NODE_NULL_POINTER;
+    }
+    else{
+        status = NODE_OK;
+        if(NULL != Pool->PoolFreeList){  /* Reuse a released node */
+            *Node = Pool->PoolFreeList;
+            Pool->PoolFreeList = Pool->PoolFreeList->NodeLink;
+        }
+        else{
+            if(Pool->PoolBumpNext == Pool->PoolBumpEnd){  /* Current slab used up */
+                status = NodePool_Add_Slab(Pool, Pool->PoolSlabNodes);
+            }
+            if(NODE_OK == status){
+                *Node = Pool->PoolBumpNext;
+                Pool->PoolBumpNext++;
+            }
+        }
+        if(NODE_OK == status){
+            Pool->PoolStats.AllocCount++;
+            Pool->PoolStats.NodesInUse++;
+            Pool->PoolStats.NodesFree--;
+            if(Pool->PoolStats.NodesInUse > Pool->PoolStats.PeakNodesInUse){
+                Pool->PoolStats.PeakNodesInUse = Pool->PoolStats.NodesInUse;
+            }
+        }
+    }
+    return status;
+}
+
+/*
+   This function NodePool_Alloc_Chain is responsible for handing out many nodes at once as one contiguous, linked chain.
+   It is used by the bulk insertions, which fill a whole array of values in a single pass.
+
+   Parameters:
+   - Pool: A pointer to the pool to allocate from.
+   - NodeCount: The number of nodes requested (at least 1).
+   - FirstNode: A double pointer that receives the first node of the chain.
+   - LastNode: A double pointer that receives the last node of the chain.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if a pointer is NULL,
+                   or NODE_NOK if NodeCount is 0 or a new slab could not be allocated.
+
+   Algorithm:
+   - When the bump region is large enough, the nodes are carved consecutively from it, so FirstNode[0] .. FirstNode[NodeCount - 1]
+     is the chain in order and each NodeLink already points to the next array element. The last NodeLink is always NULL
+     and NodeData is not set.
+   - If the bump region is too small but the free list holds at least NodeCount nodes, the chain is cut from the head of
+     the free list instead (it is already linked, so only the cut point is walked). Released nodes are scattered, so this
+     chain is not contiguous, but repeated ingest / clear cycles reuse the same memory instead of growing the pool.
+   - Otherwise one new slab of max(PoolSlabNodes, NodeCount) nodes is allocated first;
+     the rest of the old bump region goes to the free list as usual.
+   - Each node is still an ordinary pool node and can later be released on its own with NodePool_Free.
+*/
+NodeStatus_t NodePool_Alloc_Chain(NodePool_t *Pool, size_t NodeCount, Node_t **FirstNode, Node_t **LastNode){
+    NodeStatus_t status = NODE_NOK;
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == Pool)||(NULL == FirstNode)||(NULL == LastNode)){
+        status = NODE_NULL_POINTER;
+    }
+    else if(0U == NodeCount){
+        status = NODE_NOK;
+    }
+    else{
+        size_t BumpNodes = (size_t)(Pool->PoolBumpEnd - Pool->PoolBumpNext);
+        Node_t *NodeCopy = NULL;
+        size_t counter = 0;
+
+        status = NODE_OK;
+        if((BumpNodes < NodeCount) && ((Pool->PoolStats.NodesFree - BumpNodes) >= NodeCount)){  /* Reuse released nodes */
+            NodeCopy = Pool->PoolFreeList;
+            for(counter = 1; counter < NodeCount; counter++){
+                NodeCopy = NodeCopy->NodeLink;
+            }
+            *FirstNode = Pool->PoolFreeList;
+            *LastNode = NodeCopy;
+            Pool->PoolFreeList = NodeCopy->NodeLink;
+            NodeCopy->NodeLink = NULL;
+        }
+        else{
+            status = NodePool_Carve_Run(Pool, NodeCount, FirstNode, LastNode);
+        }
+        if(NODE_OK == status){
+            Pool->PoolStats.AllocCount += NodeCount;
+            Pool->PoolStats.NodesInUse += NodeCount;
+            Pool->PoolStats.NodesFree -= NodeCount;
+            if(Pool->PoolStats.NodesInUse > Pool->PoolStats.PeakNodesInUse){
+                Pool->PoolStats.PeakNodesInUse = Pool->PoolStats.NodesInUse;
+            }
+        }
+    }
+    return status;
+}
+
+/*
+   This function NodePool_Alloc_Run is responsible for handing out NodeCount nodes that are adjacent in memory.
+   Unlike NodePool_Alloc_Chain it never falls back to the free list, so the run is contiguous even when released
+   nodes are available. List_Compact uses it as the destination of the nodes it relocates.
+
+   Parameters:
+   - Pool: A pointer to the pool to allocate from.
+   - NodeCount: The number of nodes requested (at least 1).
+   - FirstNode: A double pointer that receives the first node of the run.
+   - LastNode: A double pointer that receives the last node of the run.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if a pointer is NULL,
+                   or NODE_NOK if NodeCount is 0 or a new slab could not be allocated.
+
+   Algorithm:
+   - The nodes are carved from the bump region (adding a slab if it is too small), linked in address order,
+     with the last NodeLink set to NULL. NodeData is not set.
+*/
+NodeStatus_t NodePool_Alloc_Run(NodePool_t *Pool, size_t NodeCount, Node_t **FirstNode, Node_t **LastNode){
+    NodeStatus_t status = NODE_NOK;
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == Pool)||(NULL == FirstNode)||(NULL == LastNode)){
+        status = NODE_NULL_POINTER;
+    }
+    else if(0U == NodeCount){
+        status = NODE_NOK;
+    }
+    else{
+        status = NodePool_Carve_Run(Pool, NodeCount, FirstNode, LastNode);
+        if(NODE_OK == status){
+            Pool->PoolStats.AllocCount += NodeCount;
+            Pool->PoolStats.NodesInUse += NodeCount;
+            Pool->PoolStats.NodesFree -= NodeCount;
+            if(Pool->PoolStats.NodesInUse > Pool->PoolStats.PeakNodesInUse){
+                Pool->PoolStats.PeakNodesInUse = Pool->PoolStats.NodesInUse;
+            }
+        }
+    }
+    return status;
+}
+
+/*
+   This function NodePool_Free is responsible for giving one node back to the pool it was allocated from.
+
+   Parameters:
+   - Pool: A pointer to the pool that owns the node.
+   - Node: A pointer to the node to release. It must not be used afterwards.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success or NODE_NULL_POINTER if a pointer is NULL.
+
+   Algorithm:
+   - The node is pushed on the intrusive free list through its NodeLink member. This is O(1).
+*/
+NodeStatus_t NodePool_Free(NodePool_t *Pool, Node_t *Node){
+    NodeStatus_t status = NODE_NOK;
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == Pool)||(NULL == Node)){
+        status = NODE_NULL_POINTER;
+    }
+    else{
+        Node->NodeLink = Pool->PoolFreeList;
+        Pool->PoolFreeList = Node;
+        Pool->PoolStats.FreeCount++;
+        Pool->PoolStats.NodesInUse--;
+        Pool->PoolStats.NodesFree++;
+        status = NODE_OK;
+    }
+    return status;
+}
+
+/*
+   This function NodePool_Free_Chain is responsible for giving a whole chain of nodes back to the pool at once.
+   It is used to release an entire list without visiting its nodes.
+
+   Parameters:
+   - Pool: A pointer to the pool that owns the nodes.
+   - FirstNode: A pointer to the first node of the chain.
+   - LastNode: A pointer to the last node of the chain (the one whose NodeLink is ignored).
+   - NodeCount: The number of nodes in the chain, used to keep the statistics exact.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success or NODE_NULL_POINTER if a pointer is NULL.
+
+   Algorithm:
+   - Because the free list is threaded through NodeLink, the chain is already a valid free list:
+     LastNode is linked to the current free list and FirstNode becomes its new head. This is O(1).
+*/
+NodeStatus_t NodePool_Free_Chain(NodePool_t *Pool, Node_t *FirstNode, Node_t *LastNode, size_t NodeCount){
+    NodeStatus_t status = NODE_NOK;
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == Pool)||(NULL == FirstNode)||(NULL == LastNode)){
+        status = NODE_NULL_POINTER;
+    }
+    else{
+        LastNode->NodeLink = Pool->PoolFreeList;
+        Pool->PoolFreeList = FirstNode;
+        Pool->PoolStats.FreeCount += NodeCount;
+        Pool->PoolStats.NodesInUse -= NodeCount;
+        Pool->PoolStats.NodesFree += NodeCount;
+        Pool->PoolStats.ChainReleaseCount++;
+        status = NODE_OK;
+    }
+    return status;
+}
+
+/*
+   This function NodePool_Get_Stats is responsible for copying the usage statistics of a pool.
+
+   Parameters:
+   - Pool: A pointer to the pool.
+   - Stats: A pointer to the structure that receives the statistics.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success or NODE_NULL_POINTER if a pointer is NULL.
+*/
+NodeStatus_t NodePool_Get_Stats(NodePool_t *Pool, NodePoolStats_t *Stats){
+    NodeStatus_t status = NODE_NOK;
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == Pool)||(NULL == Stats)){
+        status = NODE_NULL_POINTER;
+    }
+    else{
+        *Stats = Pool->PoolStats;
+        status = NODE_OK;
+    }
+    return status;
+}
+
+/*
+   This function NodePool_Compare_Slabs is the qsort comparator used by NodePool_Trim (ascending slab address).
+*/
+static int NodePool_Compare_Slabs(const void *Left, const void *Right){
+    size_t LeftAddress = (size_t)(*(NodeSlab_t * const *)Left);
+    size_t RightAddress = (size_t)(*(NodeSlab_t * const *)Right);
+
+    return (LeftAddress > RightAddress) - (LeftAddress < RightAddress);
+}
+
+/*
+   This function NodePool_Find_Slab is responsible for finding the slab that holds a node.
+   Slabs must be sorted by address; the index of the owning slab is returned, or SlabCount if no slab owns the node.
+*/
+static size_t NodePool_Find_Slab(NodeSlab_t **Slabs, size_t SlabCount, const Node_t *Node){
+    size_t Low = 0;
+    size_t High = SlabCount;
+    size_t Found = SlabCount;
+
+    while (Low < High)  // Last slab whose address is not above the node
+    {
+        size_t Middle = Low + ((High - Low) / 2U);
+        if((size_t)Slabs[Middle] <= (size_t)Node){
+            Low = Middle + 1U;
+        }
+        else{
+            High = Middle;
+        }
+    }
+    if((Low > 0U) && ((size_t)Node < (size_t)&Slabs[Low - 1U]->SlabStorage[Slabs[Low - 1U]->SlabNodes])){
+        Found = Low - 1U;
+    }
+    return Found;
+}
+
+/*
+   This function NodePool_Trim is responsible for returning to the heap every slab whose nodes are all free.
+   A pool otherwise only grows; after List_Compact moved a list into a fresh run, the slabs it left behind are empty
+   and can be given back.
+
+   Parameters:
+   - Pool: A pointer to the pool to trim.
+   - SlabsReleased: A pointer that receives the number of slabs returned to the heap (may be NULL).
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success (also when nothing could be released), NODE_NULL_POINTER if Pool is NULL,
+                   or NODE_NOK if the temporary arrays could not be allocated (the pool is unchanged).
+
+   Algorithm:
+   - The slabs are sorted by address, and every node on the free list is attributed to its slab with a binary search.
+   - A slab whose free count equals its size holds no node in use. The newest slab is skipped because its never-used
+     nodes (the bump region) are not on the free list.
+   - The free list is rebuilt without the nodes of the released slabs, keeping the order of the remaining nodes,
+     and the released slabs are unlinked and freed. The cost is O(F log S) for F free nodes and S slabs.
+*/
+NodeStatus_t NodePool_Trim(NodePool_t *Pool, size_t *SlabsReleased){
+    NodeStatus_t status = NODE_NOK;
+
+    /* Check for NULL pointers in the input parameters */
+    if(NULL == Pool){
+        status = NODE_NULL_POINTER;
+    }
+    else{
+        size_t SlabCount = Pool->PoolStats.SlabCount;
+        size_t Released = 0;
+        NodeSlab_t **Slabs = NULL;
+        size_t *FreeNodes = NULL;
+
+        if(SlabCount > 1U){  // The newest slab is never released, so one slab needs no work
+            Slabs = (NodeSlab_t **)malloc(SlabCount * sizeof(NodeSlab_t *));
+            FreeNodes = (size_t *)calloc(SlabCount, sizeof(size_t));
+        }
+        if((SlabCount > 1U) && ((NULL == Slabs) || (NULL == FreeNodes))){  // Check if memory allocation failed
+            status = NODE_NOK;
+        }
+        else if(SlabCount > 1U){
+            NodeSlab_t *SlabCopy = Pool->PoolSlabs;
+            NodeSlab_t **SlabLink = NULL;
+            Node_t **FreeLink = &Pool->PoolFreeList;
+            Node_t *NodeCopy = Pool->PoolFreeList;
+            size_t counter = 0;
+
+            while (NULL != SlabCopy)
+            {
+                Slabs[counter] = SlabCopy;
+                counter++;
+                SlabCopy = SlabCopy->SlabLink;
+            }
+            qsort(Slabs, SlabCount, sizeof(NodeSlab_t *), NodePool_Compare_Slabs);
+            while (NULL != NodeCopy)
+            {
+                counter = NodePool_Find_Slab(Slabs, SlabCount, NodeCopy);
+                if(counter < SlabCount){
+                    FreeNodes[counter]++;
+                }
+                NodeCopy = NodeCopy->NodeLink;
+            }
+
+            /* The newest slab owns the bump region; mark it as busy so it is kept */
+            FreeNodes[NodePool_Find_Slab(Slabs, SlabCount, &Pool->PoolSlabs->SlabStorage[0])] = 0U;
+
+            /* Drop the nodes of empty slabs from the free list */
+            NodeCopy = Pool->PoolFreeList;
+            while (NULL != NodeCopy)
+            {
+                counter = NodePool_Find_Slab(Slabs, SlabCount, NodeCopy);
+                if((counter < SlabCount) && (FreeNodes[counter] == Slabs[counter]->SlabNodes)){
+                    *FreeLink = NodeCopy->NodeLink;
+                }
+                else{
+                    FreeLink = &NodeCopy->NodeLink;
+                }
+                NodeCopy = NodeCopy->NodeLink;
+            }
+
+            /* Unlink and free the empty slabs */
+            SlabLink = &Pool->PoolSlabs;
+            while (NULL != *SlabLink)
+            {
+                SlabCopy = *SlabLink;
+                counter = NodePool_Find_Slab(Slabs, SlabCount, &SlabCopy->SlabStorage[0]);
+                if(FreeNodes[counter] == SlabCopy->SlabNodes){
+                    *SlabLink = SlabCopy->SlabLink;
+                    Pool->PoolStats.SlabCount--;
+                    Pool->PoolStats.NodeCapacity -= SlabCopy->SlabNodes;
+                    Pool->PoolStats.NodesFree -= SlabCopy->SlabNodes;
+                    Pool->PoolStats.BytesReserved -= sizeof(NodeSlab_t) + (SlabCopy->SlabNodes * sizeof(Node_t));
+                    free(SlabCopy);
+                    Released++;
+                }
+                else{
+                    SlabLink = &SlabCopy->SlabLink;
+                }
+            }
+            status = NODE_OK;
+        }
+        else{
+            status = NODE_OK;
+        }
+        free(Slabs);
+        free(FreeNodes);
+        if((NODE_OK == status) && (NULL != SlabsReleased)){
+            *SlabsReleased = Released;
+        }
+    }
+    return status;
+}
+
+/*
+   This function NodePool_Destroy is responsible for returning every slab of a pool to the heap.
+   All nodes handed out by the pool become invalid, whether or not they were released.
+   The pool is left empty and can be used again.
+
+   Parameters:
+   - Pool: A pointer to the pool to destroy.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success or NODE_NULL_POINTER if Pool is NULL.
+*/
+NodeStatus_t NodePool_Destroy(NodePool_t *Pool){
+    NodeStatus_t status = NODE_NOK;
+
+    /* Check for NULL pointers in the input parameters */
+    if(NULL == Pool){
+        status = NODE_NULL_POINTER;
+    }
+    else{
+        NodeSlab_t *SlabCopy = Pool->PoolSlabs;
+
+        while (NULL != SlabCopy)
+        {
+            NodeSlab_t *NextSlab = SlabCopy->SlabLink;  // Keep the successor before the slab is freed
+            free(SlabCopy);
+            SlabCopy = NextSlab;
+        }
+        status = NodePool_Init(Pool, Pool->PoolSlabNodes);
+    }
+    return status;
+}
\ No newline at end of file
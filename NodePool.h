@@ -0,0 +1,95 @@
+/* 
+ * File:   NodePool.h
+ * Author: Mohammed Khairallah
+ * linkedin : linkedin.com/in/mohammed-khairallah
+ * Created on October 18, 2026, 10:00 AM
+ */
+#ifndef _NODEPOOL_H
+#define _NODEPOOL_H
+
+/* Section : Includes */
+#include "SingleLinkedList.h"
+
+/* Section : Macro Declarations */
+
+#define NODE_POOL_DEFAULT_SLAB_NODES (1024U)  /* Nodes per slab when NodePool_Init is given 0 */
+
+/* Section : Macro Functions Declarations */
+
+
+/* Section : Data type Declarations */
+
+/* 
+   This typedef struct represents one slab (chunk) of nodes owned by a node pool.
+   It contains three members:
+   - SlabLink: a pointer to the next slab of the same pool.
+   - SlabNodes: the number of nodes stored in this slab.
+   - SlabStorage: the nodes themselves, allocated together with the slab header.
+   NodeSlab_t is an alias for the struct NodeSlab.
+*/
+typedef struct NodeSlab{
+    struct NodeSlab *SlabLink;  /* pointer to next slab */
+    size_t SlabNodes;           /* number of nodes in SlabStorage */
+    Node_t SlabStorage[];       /* contiguous node storage */
+}NodeSlab_t; /* end structure NodeSlab */
+
+/* 
+   This typedef struct holds the usage statistics of a node pool.
+
+   Explanation of members:
+   - SlabCount: Number of slabs allocated from the heap.
+   - NodeCapacity: Total number of nodes in all slabs.
+   - NodesInUse: Number of nodes currently handed out by the pool.
+   - NodesFree: Number of nodes ready to be handed out without another slab allocation.
+   - PeakNodesInUse: Highest value NodesInUse has reached since NodePool_Init.
+   - AllocCount: Number of nodes handed out by NodePool_Alloc, NodePool_Alloc_Chain and NodePool_Alloc_Run.
+   - FreeCount: Number of nodes given back by NodePool_Free and NodePool_Free_Chain.
+   - ChainReleaseCount: Number of NodePool_Free_Chain calls (each one releases a whole chain in O(1)).
+   - BytesReserved: Heap memory held by the slabs, headers included.
+*/
+typedef struct{
+    size_t SlabCount;          /* slabs allocated from the heap */
+    size_t NodeCapacity;       /* nodes in all slabs */
+    size_t NodesInUse;         /* nodes currently handed out */
+    size_t NodesFree;          /* nodes available without a new slab */
+    size_t PeakNodesInUse;     /* high-water mark of NodesInUse */
+    size_t AllocCount;         /* nodes handed out */
+    size_t FreeCount;          /* nodes given back */
+    size_t ChainReleaseCount;  /* whole chains given back */
+    size_t BytesReserved;      /* heap bytes held by the slabs */
+}NodePoolStats_t;
+
+/* 
+   This typedef struct represents a pool (slab allocator) of Node_t objects.
+   Nodes are carved out of large slabs, and released nodes are kept on an intrusive free list
+   threaded through their own NodeLink member, so allocating and freeing a node never calls malloc or free.
+
+   Explanation of members:
+   - PoolSlabs: Singly linked list of all slabs owned by the pool.
+   - PoolFreeList: Chain of released nodes, linked through NodeLink.
+   - PoolBumpNext / PoolBumpEnd: The part of the newest slab that was never handed out yet.
+   - PoolSlabNodes: Number of nodes requested for every new slab.
+   - PoolStats: Usage statistics, see NodePoolStats_t.
+*/
+typedef struct NodePool{
+    NodeSlab_t *PoolSlabs;      /* all slabs owned by the pool */
+    Node_t *PoolFreeList;       /* released nodes linked through NodeLink */
+    Node_t *PoolBumpNext;       /* next never-used node of the newest slab */
+    Node_t *PoolBumpEnd;        /* end of the newest slab */
+    size_t PoolSlabNodes;       /* nodes per new slab */
+    NodePoolStats_t PoolStats;  /* usage statistics */
+}NodePool_t; /* end structure NodePool */
+
+/* Section : Functions Declaration */
+
+NodeStatus_t NodePool_Init(NodePool_t *Pool, size_t SlabNodes);
+NodeStatus_t NodePool_Alloc(NodePool_t *Pool, Node_t **Node);
+NodeStatus_t NodePool_Alloc_Chain(NodePool_t *Pool, size_t NodeCount, Node_t **FirstNode, Node_t **LastNode);
+NodeStatus_t NodePool_Alloc_Run(NodePool_t *Pool, size_t NodeCount, Node_t **FirstNode, Node_t **LastNode);
+NodeStatus_t NodePool_Free(NodePool_t *Pool, Node_t *Node);
+NodeStatus_t NodePool_Free_Chain(NodePool_t *Pool, Node_t *FirstNode, Node_t *LastNode, size_t NodeCount);
+NodeStatus_t NodePool_Get_Stats(NodePool_t *Pool, NodePoolStats_t *Stats);
+NodeStatus_t NodePool_Trim(NodePool_t *Pool, size_t *SlabsReleased);
+NodeStatus_t NodePool_Destroy(NodePool_t *Pool);
+
+#endif  //_NODEPOOL_H
\ No newline at end of file
@@ -0,0 +1,481 @@
+/* 
+ * File:   PersistentList.c
+ * Author: Mohammed Khairallah
+ * linkedin : linkedin.com/in/mohammed-khairallah
+ * Created on October 27, 2026, 10:00 AM
+ */
+#include "PersistentList.h"
+
+#define PERSISTENT_HAZARD_SLOT (0U)  /* Hazard slot protecting the version a snapshot is taken of */
+
+/*
+   Every update is one of three edits of the version it starts from (the base), described by a PersistentUpdate_t:
+   the first NodeCount nodes of the base are copied, a new node may follow, and the rest of the base (the suffix)
+   is shared by pointing at it and counting one more reference on its first node.
+
+       Insert after position N:  copy N nodes, new node, share from node N + 1.
+       Delete position N:        copy N - 1 nodes, share from node N + 1.
+       Set position N:           copy N - 1 nodes, new node, share from node N + 1.
+
+   A node is referenced by its predecessors in all versions and by the versions it is the head of; it is freed when
+   the count drops to 0, which drops one reference of its successor in turn, so a released version frees exactly the
+   nodes no other version uses.
+*/
+
+/* 
+   This typedef enum lists the edits an update can make.
+*/
+typedef enum{
+    PERSISTENT_INSERT_AFTER = 0,  /* new node after NodePosition (0 = in front) */
+    PERSISTENT_DELETE,            /* remove the node at NodePosition */
+    PERSISTENT_SET                /* replace the value at NodePosition */
+}PersistentUpdate_t;
+
+/* Function used by the hazard pointer domain to drop the list's reference to a replaced version */
+static void Persistent_Reclaim(void *Pointer){
+    Persistent_Version_Release((PersistentVersion_t *)Pointer);
+}
+
+/*
+   This function Persistent_Build is responsible for building the version that results from one update of a base.
+
+   Return value:
+   - NodeStatus_t: NODE_OK with *NewVersion set, NODE_EMPTY if a node is to be removed or set in an empty base,
+                   or NODE_NOK if the position is out of range or memory allocation fails (nothing is left allocated).
+*/
+static NodeStatus_t Persistent_Build(const PersistentVersion_t *Base, PersistentUpdate_t Update, size_t NodePosition,
+                                     uint32_t Data, PersistentVersion_t **NewVersion){
+    NodeStatus_t status = NODE_NOK;
+    size_t CopyCount = (PERSISTENT_INSERT_AFTER == Update) ? NodePosition : (NodePosition - 1U);
+
+    if((PERSISTENT_INSERT_AFTER != Update) && (0U == Base->VersionLength)){
+        status = NODE_EMPTY;
+    }
+    else if(((PERSISTENT_INSERT_AFTER == Update) && (NodePosition > Base->VersionLength)) ||
+            ((PERSISTENT_INSERT_AFTER != Update) && ((0U == NodePosition) || (NodePosition > Base->VersionLength)))){
+        status = NODE_NOK;
+    }
+    else{
+        PersistentVersion_t *Version = (PersistentVersion_t *)malloc(sizeof(PersistentVersion_t));
+
+        if(NULL == Version){  // Check if memory allocation failed
+            status = NODE_NOK;
+        }
+        else{
+            PersistentNode_t **LinkSlot = &Version->VersionHead;
+            PersistentNode_t *BaseNode = Base->VersionHead;
+            size_t counter = 0;
+
+            Version->VersionHead = NULL;
+            Version->VersionRefs = 1U;  // The reference of the list once it is published
+            Version->VersionLength = Base->VersionLength;
+            status = NODE_OK;
+
+            /* Copy the path in front of the position */
+            for(counter = 0; (counter < CopyCount) && (NODE_OK == status); counter++){
+                PersistentNode_t *NodeCopy = (PersistentNode_t *)malloc(sizeof(PersistentNode_t));
+
+                if(NULL == NodeCopy){
+                    status = NODE_NOK;
+                }
+                else{
+                    NodeCopy->NodeData = BaseNode->NodeData;
+                    NodeCopy->NodeRefs = 1U;
+                    *LinkSlot = NodeCopy;
+                    LinkSlot = &NodeCopy->NodeLink;
+                    BaseNode = BaseNode->NodeLink;
+                }
+            }
+
+            /* The new node, if any */
+            if((NODE_OK == status) && (PERSISTENT_DELETE != Update)){
+                PersistentNode_t *NodeList = (PersistentNode_t *)malloc(sizeof(PersistentNode_t));
+
+                if(NULL == NodeList){
+                    status = NODE_NOK;
+                }
+                else{
+                    NodeList->NodeData = Data;
+                    NodeList->NodeRefs = 1U;
+                    *LinkSlot = NodeList;
+                    LinkSlot = &NodeList->NodeLink;
+                }
+            }
+
+            /* Share the rest of the base */
+            if(NODE_OK == status){
+                if(PERSISTENT_INSERT_AFTER == Update){
+                    Version->VersionLength++;
+                }
+                else{
+                    Version->VersionLength -= (PERSISTENT_DELETE == Update) ? 1U : 0U;
+                    BaseNode = BaseNode->NodeLink;  // Skip the node that is removed or replaced
+                }
+                if(NULL != BaseNode){
+                    __atomic_add_fetch(&BaseNode->NodeRefs, 1U, __ATOMIC_RELAXED);
+                }
+                *LinkSlot = BaseNode;
+                *NewVersion = Version;
+            }
+            else{
+                *LinkSlot = NULL;  // End the partial copy here, it does not share anything yet
+                Persistent_Version_Release(Version);
+            }
+        }
+    }
+    return status;
+}
+
+/*
+   This function Persistent_Update is responsible for applying one update to the current version and publishing it.
+
+   Algorithm:
+   - A snapshot of the current version is taken and the new version is built from it.
+   - The new version is published with a compare-and-swap that only succeeds if the snapshot is still current.
+     The snapshot holds a reference, so the version cannot be freed and reallocated in between (no ABA problem).
+   - On success the list's reference to the old version is retired to the hazard pointer domain; on failure another
+     writer came first, the new version is released and the update is built again on the newer version.
+*/
+static NodeStatus_t Persistent_Update(PersistentList_t *List, PersistentUpdate_t Update, size_t NodePosition, uint32_t Data){
+    NodeStatus_t status = NODE_NOK;
+    boolean Done = 0;
+
+    while (0U == Done)
+    {
+        PersistentVersion_t *Base = NULL;
+        PersistentVersion_t *Expected = NULL;
+        PersistentVersion_t *NewVersion = NULL;
+
+        status = Persistent_List_Snapshot(List, &Base);
+        if(NODE_OK != status){
+            Done = 1;  // No hazard pointer record, the current version cannot be read safely
+        }
+        else{
+            Expected = Base;
+            status = Persistent_Build(Base, Update, NodePosition, Data, &NewVersion);
+            if(NODE_OK != status){
+                Done = 1;  // Nothing to publish
+            }
+            else if(__atomic_compare_exchange_n(&List->ListCurrent, &Expected, NewVersion, 0, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED)){
+                /* The list's reference, dropped once no reader is taking a snapshot. The update is published either way;
+                   if the retired list cannot grow the old version is leaked, since releasing it now is not safe */
+                (void)Hazard_Retire(Base, Persistent_Reclaim);
+                Done = 1;
+            }
+            else{
+                Persistent_Version_Release(NewVersion);  // Another writer came first, build again on its version
+            }
+            Persistent_Version_Release(Base);  // Drop the snapshot reference
+        }
+    }
+    return status;
+}
+
+/*
+   This function Persistent_List_Init is responsible for initializing a persistent list to the empty list.
+   It must be called before the list is shared with other threads.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if List is NULL, or NODE_NOK if memory allocation failed.
+*/
+NodeStatus_t Persistent_List_Init(PersistentList_t *List){
+    NodeStatus_t status = NODE_NOK;
+
+    /* Check for NULL pointers in the input parameters */
+    if(NULL == List){
+        status = NODE_NULL_POINTER;
+    }
+    else{
+        PersistentVersion_t *Version = (PersistentVersion_t *)malloc(sizeof(PersistentVersion_t));
+
+        if(NULL == Version){  // Check if memory allocation failed
+            status = NODE_NOK;
+        }
+        else{
+            Version->VersionHead = NULL;
+            Version->VersionLength = 0;
+            Version->VersionRefs = 1U;
+            __atomic_store_n(&List->ListCurrent, Version, __ATOMIC_RELEASE);
+            status = NODE_OK;
+        }
+    }
+    return status;
+}
+
+/*
+   This function Persistent_List_Insert_Node_At_Beginning is the persistent version of Insert_Node_At_Beginning.
+   The new version shares every node of the previous one; one node is allocated.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if a pointer is NULL, or NODE_NOK if memory allocation failed.
+*/
+NodeStatus_t Persistent_List_Insert_Node_At_Beginning(PersistentList_t *List, void *Data){
+    NodeStatus_t status = NODE_NOK;
+    uint32_t *_Data = Data;  // Cast the void pointer Data to uint32_t pointer
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == List)||(NULL == Data)){
+        status = NODE_NULL_POINTER;
+    }
+    else{
+        status = Persistent_Update(List, PERSISTENT_INSERT_AFTER, 0U, *_Data);
+    }
+    return status;
+}
+
+/*
+   This function Persistent_List_Delete_Node_At_Beginning is the persistent version of Delete_Node_At_Beginning.
+   The new version is the previous one without its first node; nothing is copied. The node itself is freed once
+   no snapshot of an older version uses it.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if List is NULL, NODE_EMPTY if the list is empty,
+                   or NODE_NOK if memory allocation failed.
+*/
+NodeStatus_t Persistent_List_Delete_Node_At_Beginning(PersistentList_t *List){
+    NodeStatus_t status = NODE_NOK;
+
+    /* Check for NULL pointers in the input parameters */
+    if(NULL == List){
+        status = NODE_NULL_POINTER;
+    }
+    else{
+        status = Persistent_Update(List, PERSISTENT_DELETE, 1U, 0U);
+    }
+    return status;
+}
+
+/*
+   This function Persistent_List_Insert_Node_After is the persistent version of List_Insert_Node_After.
+   The NodePosition nodes in front of the new node are copied, the nodes after it are shared.
+
+   Parameters:
+   - List: A pointer to the persistent list.
+   - NodePosition: The position after which the node is inserted, 0 (in front) to the length of the list.
+   - Data: A pointer to the uint32_t value to store.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if a pointer is NULL,
+                   or NODE_NOK if the position is out of range or memory allocation failed.
+*/
+NodeStatus_t Persistent_List_Insert_Node_After(PersistentList_t *List, size_t NodePosition, void *Data){
+    NodeStatus_t status = NODE_NOK;
+    uint32_t *_Data = Data;  // Cast the void pointer Data to uint32_t pointer
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == List)||(NULL == Data)){
+        status = NODE_NULL_POINTER;
+    }
+    else{
+        status = Persistent_Update(List, PERSISTENT_INSERT_AFTER, NodePosition, *_Data);
+    }
+    return status;
+}
+
+/*
+   This function Persistent_List_Delete_Node is the persistent version of List_Delete_Node.
+   The NodePosition - 1 nodes in front of the deleted node are copied, the nodes after it are shared.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if List is NULL, NODE_EMPTY if the list is empty,
+                   or NODE_NOK if the position is out of range or memory allocation failed.
+*/
+NodeStatus_t Persistent_List_Delete_Node(PersistentList_t *List, size_t NodePosition){
+    NodeStatus_t status = NODE_NOK;
+
+    /* Check for NULL pointers in the input parameters */
+    if(NULL == List){
+        status = NODE_NULL_POINTER;
+    }
+    else{
+        status = Persistent_Update(List, PERSISTENT_DELETE, NodePosition, 0U);
+    }
+    return status;
+}
+
+/*
+   This function Persistent_List_Set_Node is responsible for changing the value at a position.
+   Nodes never change once published, so the node and the NodePosition - 1 nodes in front of it are copied,
+   and the nodes after it are shared.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if a pointer is NULL, NODE_EMPTY if the list is empty,
+                   or NODE_NOK if the position is out of range or memory allocation failed.
+*/
+NodeStatus_t Persistent_List_Set_Node(PersistentList_t *List, size_t NodePosition, void *Data){
+    NodeStatus_t status = NODE_NOK;
+    uint32_t *_Data = Data;  // Cast the void pointer Data to uint32_t pointer
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == List)||(NULL == Data)){
+        status = NODE_NULL_POINTER;
+    }
+    else{
+        status = Persistent_Update(List, PERSISTENT_SET, NodePosition, *_Data);
+    }
+    return status;
+}
+
+/*
+   This function Persistent_List_Snapshot is responsible for taking a reference to the current version of a list.
+   It never waits for writers and costs the same for any length.
+
+   Parameters:
+   - List: A pointer to the persistent list.
+   - Version: Receives the current version. It can be read without a lock until it is given back with
+              Persistent_Version_Release, and does not change when the list is updated.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if a pointer is NULL,
+                   or NODE_NOK if the hazard pointer record of the calling thread could not be allocated.
+
+   Algorithm:
+   - The current version is read through a hazard pointer, so the list's reference to it cannot be dropped before
+     the reference count is incremented, even if a writer replaces it at that moment.
+*/
+NodeStatus_t Persistent_List_Snapshot(PersistentList_t *List, PersistentVersion_t **Version){
+    NodeStatus_t status = NODE_NOK;
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == List)||(NULL == Version)){
+        status = NODE_NULL_POINTER;
+    }
+    else if(NODE_OK != Hazard_Thread_Init()){
+        status = NODE_NOK;  // Reading the version unprotected could touch a freed one
+    }
+    else{
+        PersistentVersion_t *Current = (PersistentVersion_t *)Hazard_Protect(PERSISTENT_HAZARD_SLOT, (void **)&List->ListCurrent);
+
+        __atomic_add_fetch(&Current->VersionRefs, 1U, __ATOMIC_RELAXED);
+        Hazard_Clear(PERSISTENT_HAZARD_SLOT);
+        *Version = Current;
+        status = NODE_OK;
+    }
+    return status;
+}
+
+/*
+   This function Persistent_List_Destroy is responsible for releasing the list's reference to its current version.
+   No other thread may use the list during or after the call; snapshots still held stay valid until released.
+   Replaced versions still waiting in the hazard pointer domain are released by Hazard_Scan, Hazard_Thread_Exit
+   or Hazard_Shutdown.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success or NODE_NULL_POINTER if List is NULL.
+*/
+NodeStatus_t Persistent_List_Destroy(PersistentList_t *List){
+    NodeStatus_t status = NODE_NOK;
+
+    /* Check for NULL pointers in the input parameters */
+    if(NULL == List){
+        status = NODE_NULL_POINTER;
+    }
+    else{
+        PersistentVersion_t *Current = __atomic_exchange_n(&List->ListCurrent, NULL, __ATOMIC_ACQ_REL);
+
+        if(NULL != Current){
+            Persistent_Version_Release(Current);
+        }
+        status = NODE_OK;
+    }
+    return status;
+}
+
+/* Function to read the number of nodes of a version */
+NodeStatus_t Persistent_Version_Get_Length(const PersistentVersion_t *Version, size_t *Length){
+    NodeStatus_t status = NODE_NOK;
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == Version)||(NULL == Length)){
+        status = NODE_NULL_POINTER;
+    }
+    else{
+        *Length = Version->VersionLength;
+        status = NODE_OK;
+    }
+    return status;
+}
+
+/* Function to read the value at a position (1 to the length) of a version; NODE_NOK if out of range */
+NodeStatus_t Persistent_Version_Get_Node(const PersistentVersion_t *Version, size_t NodePosition, uint32_t *Data){
+    NodeStatus_t status = NODE_NOK;
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == Version)||(NULL == Data)){
+        status = NODE_NULL_POINTER;
+    }
+    else if((0U == NodePosition)||(NodePosition > Version->VersionLength)){
+        status = NODE_NOK;
+    }
+    else{
+        const PersistentNode_t *NodeCopy = Version->VersionHead;
+        size_t counter = 1;
+
+        while (counter < NodePosition)
+        {
+            NodeCopy = NodeCopy->NodeLink;  // Move to the next node
+            counter++;
+        }
+        *Data = NodeCopy->NodeData;
+        status = NODE_OK;
+    }
+    return status;
+}
+
+/* Function to print the values of a version like Display_All_Nodes; NODE_EMPTY for an empty version */
+NodeStatus_t Persistent_Version_Display_All_Nodes(const PersistentVersion_t *Version){
+    NodeStatus_t status = NODE_NOK;
+
+    /* Check for NULL pointers in the input parameters */
+    if(NULL == Version){
+        status = NODE_NULL_POINTER;
+    }
+    else{
+        const PersistentNode_t *NodeCopy = Version->VersionHead;
+
+        while (NULL != NodeCopy)
+        {
+            printf("%i -> ", NodeCopy->NodeData);  // Display the node data
+            NodeCopy = NodeCopy->NodeLink;
+        }
+        printf("NULL \n");
+        status = (NULL == Version->VersionHead) ? NODE_EMPTY : NODE_OK;
+    }
+    return status;
+}
+
+/*
+   This function Persistent_Version_Release is responsible for giving back a reference to a version.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success or NODE_NULL_POINTER if Version is NULL.
+
+   Algorithm:
+   - When the last reference goes, the version is freed and its first node loses a reference. Every node whose count
+     drops to 0 is freed and passes the drop on to its successor; the walk stops at the first node another version
+     still uses, so only the nodes private to this version are visited.
+*/
+NodeStatus_t Persistent_Version_Release(PersistentVersion_t *Version){
+    NodeStatus_t status = NODE_NOK;
+
+    /* Check for NULL pointers in the input parameters */
+    if(NULL == Version){
+        status = NODE_NULL_POINTER;
+    }
+    else{
+        if(1U == __atomic_fetch_sub(&Version->VersionRefs, 1U, __ATOMIC_ACQ_REL)){
+            PersistentNode_t *NodeCopy = Version->VersionHead;
+
+            free(Version);
+            while ((NULL != NodeCopy) && (1U == __atomic_fetch_sub(&NodeCopy->NodeRefs, 1U, __ATOMIC_ACQ_REL)))
+            {
+                PersistentNode_t *NextNode = NodeCopy->NodeLink;
+
+                free(NodeCopy);
+                NodeCopy = NextNode;
+            }
+        }
+        status = NODE_OK;
+    }
+    return status;
+}
\ No newline at end of file
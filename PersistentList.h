@@ -0,0 +1,92 @@
+/* 
+ * File:   PersistentList.h
+ * Author: Mohammed Khairallah
+ * linkedin : linkedin.com/in/mohammed-khairallah
+ * Created on October 27, 2026, 10:00 AM
+ */
+#ifndef _PERSISTENTLIST_H
+#define _PERSISTENTLIST_H
+
+/* Section : Includes */
+#include "SingleLinkedList.h"
+#include "HazardPointer.h"
+
+/* Section : Macro Declarations */
+
+
+/* Section : Macro Functions Declarations */
+
+
+/* Section : Data type Declarations */
+
+/* 
+   This typedef struct represents a node of a persistent list.
+   It has the layout of Node_t, with the 4 bytes of padding after NodeData used as a reference count,
+   so a node is still 16 bytes on 64-bit targets. A node never changes once it is part of a version.
+
+   Explanation of members:
+   - NodeData: Holds the data value within the node, represented as an unsigned 32-bit integer.
+   - NodeRefs: The number of versions and nodes that point to this node. Only accessed with atomic operations.
+   - NodeLink: Holds a pointer to the next node.
+*/
+typedef struct PersistentNode{
+    uint32_t NodeData;                  /* Stores an unsigned 32-bit integer data in the node */
+    uint32_t NodeRefs;                  /* references from versions and nodes, accessed atomically */
+    struct PersistentNode *NodeLink;    /* pointer to next node */
+}PersistentNode_t; /* end structure PersistentNode */
+
+/* 
+   This typedef struct represents one version of a persistent list: the list as it was after one update.
+
+   Explanation of members:
+   - VersionHead: Holds a pointer to the first node (NULL for the empty list).
+   - VersionLength: The number of nodes.
+   - VersionRefs: The number of holders of the version: the list while it is current, plus every snapshot taken of it.
+                  Only accessed with atomic operations.
+
+   A version can be read from any number of threads without a lock for as long as a reference to it is held.
+*/
+typedef struct PersistentVersion{
+    PersistentNode_t *VersionHead;  /* first node */
+    size_t VersionLength;           /* number of nodes */
+    size_t VersionRefs;             /* holders, accessed atomically */
+}PersistentVersion_t;
+
+/* 
+   This typedef struct represents a persistent list shared between readers and writers.
+
+   Explanation of members:
+   - ListCurrent: Holds a pointer to the current version. It is only read and written with atomic operations.
+
+   Every update builds a new version and publishes it with one compare-and-swap of ListCurrent, so readers never wait:
+   Persistent_List_Snapshot takes a reference to the current version in O(1), whatever its length, and the version
+   keeps its contents until it is released, however many updates follow.
+   New versions share nodes with the version they were built from: inserting or deleting at the beginning allocates
+   at most one node, and an update at position N copies the N nodes in front of it (the path) and shares the rest.
+   Nodes and versions are freed by reference counting when the last version that uses them is released.
+   The list's own reference to a replaced version is dropped through hazard pointers (HazardPointer.h), since a reader
+   may be taking a snapshot of it at that moment, so every thread that uses the list must call Hazard_Thread_Exit
+   before it ends. Writers may run concurrently with each other too: a writer that loses the race builds its update
+   again on the newer version.
+*/
+typedef struct{
+    PersistentVersion_t *ListCurrent;   /* current version, accessed atomically */
+}PersistentList_t;
+
+/* Section : Functions Declaration */
+
+NodeStatus_t Persistent_List_Init(PersistentList_t *List);
+NodeStatus_t Persistent_List_Insert_Node_At_Beginning(PersistentList_t *List, void *Data);
+NodeStatus_t Persistent_List_Delete_Node_At_Beginning(PersistentList_t *List);
+NodeStatus_t Persistent_List_Insert_Node_After(PersistentList_t *List, size_t NodePosition, void *Data);
+NodeStatus_t Persistent_List_Delete_Node(PersistentList_t *List, size_t NodePosition);
+NodeStatus_t Persistent_List_Set_Node(PersistentList_t *List, size_t NodePosition, void *Data);
+NodeStatus_t Persistent_List_Snapshot(PersistentList_t *List, PersistentVersion_t **Version);
+NodeStatus_t Persistent_List_Destroy(PersistentList_t *List);
+
+NodeStatus_t Persistent_Version_Get_Length(const PersistentVersion_t *Version, size_t *Length);
+NodeStatus_t Persistent_Version_Get_Node(const PersistentVersion_t *Version, size_t NodePosition, uint32_t *Data);
+NodeStatus_t Persistent_Version_Display_All_Nodes(const PersistentVersion_t *Version);
+NodeStatus_t Persistent_Version_Release(PersistentVersion_t *Version);
+
+#endif  //_PERSISTENTLIST_H
\ No newline at end of file
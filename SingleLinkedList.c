@@ -5,6 +5,11 @@
  * Created on December 31, 2023, 8:54 PM
  */
 #include "SingleLinkedList.h"
+#include "NodePool.h"
+#include "ListIndex.h"
+#include "ListStats.h"
+
+#define SORT_BINS_MAX (64U)  /* Sorted runs kept by Sort_Chain, one per power of two up to 2^63 nodes */
 
 /*
    This function Insert_Node_At_Beginning is responsible for inserting a new node at the beginning of a linked list.
@@ -34,6 +39,7 @@
 NodeStatus_t Insert_Node_At_Beginning(Node_t **NodeHead, void *Data){
     NodeStatus_t status = NODE_NOK;  // Initialize status as NODE_NOK
     uint32_t *_Data = Data;  // Cast the void pointer Data to uint32_t pointer
+    LIST_STATS_ENTER();
 
     /* Check for NULL pointers in the input parameters */
     if((NULL == NodeHead||(NULL == Data))){
@@ -44,6 +50,7 @@ NodeStatus_t Insert_Node_At_Beginning(Node_t **NodeHead, void *Data){
 
         // Allocate memory for a new node
         NodeList = (Node_t *)malloc(sizeof(Node_t));
+        LIST_STATS_ALLOC(NodeList);
 
         if(NULL == NodeList){  // Check if memory allocation failed
             status = NODE_NOK; // Set status as NODE_NOK if memory allocation failed
@@ -62,6 +69,7 @@ NodeStatus_t Insert_Node_At_Beginning(Node_t **NodeHead, void *Data){
             status = NODE_OK;
         }
     }
+    LIST_STATS_EXIT(LIST_OP_INSERT_NODE_AT_BEGINNING, status);
     return status; // Return the status indicating the success or failure of the insertion operation
 }
 
@@ -93,6 +101,7 @@ NodeStatus_t Insert_Node_At_Beginning(Node_t **NodeHead, void *Data){
 NodeStatus_t Insert_Node_At_End(Node_t **NodeHead, void *Data){
     NodeStatus_t status = NODE_NOK;
     uint32_t *_Data = Data;  // Cast the void pointer Data to uint32_t pointer
+    LIST_STATS_ENTER();
 
     /* Check for NULL pointers in the input parameters */
     if((NULL == NodeHead||(NULL == Data))){
@@ -103,6 +112,7 @@ NodeStatus_t Insert_Node_At_End(Node_t **NodeHead, void *Data){
 
         // Allocate memory for a new node
         NodeList = (Node_t *)malloc(sizeof(Node_t));
+        LIST_STATS_ALLOC(NodeList);
 
         if(NULL == NodeList){ // Check if memory allocation failed
             status = NODE_NOK;  // Set status as NODE_NOK if memory allocation failed
@@ -124,6 +134,7 @@ NodeStatus_t Insert_Node_At_End(Node_t **NodeHead, void *Data){
                 while (NULL != (NodeHeadCopy->NodeLink))
                 {
                     NodeHeadCopy = NodeHeadCopy->NodeLink;
+                    LIST_STATS_STEP();
                 }
 
                 // Insert the new node at the end of the list
@@ -132,16 +143,17 @@ NodeStatus_t Insert_Node_At_End(Node_t **NodeHead, void *Data){
             status = NODE_OK;
         }
     }
+    LIST_STATS_EXIT(LIST_OP_INSERT_NODE_AT_END, status);
     return status;
 }
 
 /*
-   This function Insert_Node_After is responsible for inserting a new node after a specific position in a linked list.
+   This function Insert_Node_After_Wide is responsible for inserting a new node after a specific position in a linked list.
    It takes a double pointer to the head of the linked list (NodeHead), a position (NodePosition), and a pointer to generic data (Data) as input.
 
    Parameters:
    - NodeHead: A double pointer to the head of the linked list where the new node is to be inserted.
-   - NodePosition: The position after which the new node needs to be inserted.
+   - NodePosition: The position after which the new node needs to be inserted, as a size_t so any list length can be addressed.
    - Data: A void pointer to generic data that needs to be stored in the new node.
 
    Return value:
@@ -150,8 +162,7 @@ NodeStatus_t Insert_Node_At_End(Node_t **NodeHead, void *Data){
    Explanation of the function:
    - NodeStatus_t: An enumeration representing different statuses related to node operations (NODE_NOK, NODE_OK, NODE_EMPTY, NODE_NULL_POINTER).
    - uint32_t *_Data: A pointer to an unsigned 32-bit integer, obtained by casting the void pointer Data.
-   - uint16_t NodeCounter: A counter to keep track of the number of nodes in the linked list.
-   - uint16_t counter: A counter variable used for iteration.
+   - size_t counter: A counter variable used for iteration.
 
    Algorithm:
    - The function first initializes the status variable as NODE_NOK (indicating an unsuccessful operation).
@@ -159,15 +170,17 @@ NodeStatus_t Insert_Node_At_End(Node_t **NodeHead, void *Data){
    - If the pointers are valid, the function dynamically allocates memory for a new node (NodeList) using malloc().
    - If memory allocation fails (NodeList is NULL), the status is set as NODE_NOK.
    - If the linked list is empty, the new node becomes the head of the list.
-   - Otherwise, if the NodePosition is within a valid range, the function finds the node at the specified position and inserts the new node after it.
+   - Otherwise, if NodePosition is not zero, the function walks towards the node at the specified position, stopping early if the list ends.
+   - If that node exists the new node is inserted after it, otherwise the position was out of range and the new node is freed.
+   - The range check and the search share a single traversal, so the list length is never computed separately.
    - The data passed (pointed by Data) is assigned to the NodeData member of the new node.
    - Finally, the function returns the status indicating the success or failure of the insertion operation.
 */
-NodeStatus_t Insert_Node_After(Node_t **NodeHead, uint16_t NodePosition, void *Data){
+NodeStatus_t Insert_Node_After_Wide(Node_t **NodeHead, size_t NodePosition, void *Data){
     NodeStatus_t status = NODE_NOK;
     uint32_t *_Data = Data;    // Cast the void pointer Data to uint32_t pointer
-    uint16_t NodeCounter = 0;  // Initialize NodeCounter to keep track of node count
-    uint16_t counter = 1;      // Initialize counter for iteration
+    size_t counter = 1;        // Initialize counter for iteration
+    LIST_STATS_ENTER();
 
     /* Check for NULL pointers in the input parameters */
     if((NULL == NodeHead)||(NULL == Data)){
@@ -178,6 +191,7 @@ NodeStatus_t Insert_Node_After(Node_t **NodeHead, uint16_t NodePosition, void *D
 
         // Allocate memory for a new node
         NodeList = (Node_t *)malloc(sizeof(Node_t));
+        LIST_STATS_ALLOC(NodeList);
 
         if(NULL == NodeList){ // Check if memory allocation failed
             status = NODE_NOK;  // Set status as NODE_NOK if memory allocation fails
@@ -190,19 +204,23 @@ NodeStatus_t Insert_Node_After(Node_t **NodeHead, uint16_t NodePosition, void *D
                 status = NODE_OK;
             }
             else{
+                struct Node *NodeHeadCopy = NULL;
+
                 NodeList->NodeData = *_Data;  // Assign the data to the NodeData of the new node
-                Get_Length(NodeHead, &NodeCounter);  // Get the length of the linked list
 
-                if((0 != NodePosition)&&(NodePosition <= NodeCounter)){
-                    struct Node *NodeHeadCopy = *NodeHead;
+                if(0 != NodePosition){
+                    NodeHeadCopy = *NodeHead;
 
-                    // Traverse to find the node at NodePosition
-                    while (counter < NodePosition)
+                    // Traverse to find the node at NodePosition, stopping if the list is shorter
+                    while ((NULL != NodeHeadCopy) && (counter < NodePosition))
                     {
                         NodeHeadCopy = NodeHeadCopy->NodeLink;
+                        LIST_STATS_STEP();
                         counter++;
                     }
+                }
 
+                if(NULL != NodeHeadCopy){
                     /* Connect the right side connection */
                     NodeList->NodeLink = NodeHeadCopy->NodeLink;
                     /* Connect the Left side connection */
@@ -212,13 +230,23 @@ NodeStatus_t Insert_Node_After(Node_t **NodeHead, uint16_t NodePosition, void *D
                 else{
                     status = NODE_NOK;
                     free(NodeList);  // Free the memory allocated for the new node
+                    LIST_STATS_FREE(1U);
                 }
             }
         }
     }
+    LIST_STATS_EXIT(LIST_OP_INSERT_NODE_AFTER_WIDE, status);
     return status;
 }
 
+/*
+   This function Insert_Node_After is responsible for inserting a new node after a specific position in a linked list.
+   It is kept for existing callers with 16-bit positions and forwards to Insert_Node_After_Wide, so its behavior is identical.
+*/
+NodeStatus_t Insert_Node_After(Node_t **NodeHead, uint16_t NodePosition, void *Data){
+    return Insert_Node_After_Wide(NodeHead, (size_t)NodePosition, Data);
+}
+
 /*
    This function Delete_Node_At_Beginning is responsible for deleting the node at the beginning of a linked list.
    It takes a double pointer to the head of the linked list (NodeHead) as input.
@@ -246,6 +274,7 @@ NodeStatus_t Insert_Node_After(Node_t **NodeHead, uint16_t NodePosition, void *D
 */
 NodeStatus_t Delete_Node_At_Beginning(Node_t **NodeHead){
     NodeStatus_t status = NODE_NOK;
+    LIST_STATS_ENTER();
 
     /* Check for NULL pointers in the input parameters */
     if(NULL == NodeHead){
@@ -262,28 +291,29 @@ NodeStatus_t Delete_Node_At_Beginning(Node_t **NodeHead){
             *NodeHead = NodeHeadCopy->NodeLink; // Update the head pointer to the next node
             NodeHeadCopy->NodeLink = NULL; // Set the NodeLink of the removed node to NULL (detach it from the list)
             free(NodeHeadCopy); // Free the memory allocated for the removed node
+            LIST_STATS_FREE(1U);
             status = NODE_OK;  // Set status as NODE_OK indicating successful deletion
         }
     }
+    LIST_STATS_EXIT(LIST_OP_DELETE_NODE_AT_BEGINNING, status);
     return status;
 }
 
 /*
-   This function, Delete_Node, is responsible for deleting a node from a specified position in a linked list.
+   This function, Delete_Node_Wide, is responsible for deleting a node from a specified position in a linked list.
    It takes a double pointer to the head of the linked list (NodeHead) and the position of the node to be deleted (NodePosition).
 
    Parameters:
    - NodeHead: A double pointer to the head of the linked list from which the node will be deleted.
-   - NodePosition: An unsigned 16-bit integer representing the position of the node to be deleted.
+   - NodePosition: A size_t representing the position of the node to be deleted, so any list length can be addressed.
 
    Return value:
    - NodeStatus_t: It returns a NodeStatus_t value, indicating the status of the operation (NODE_NOK, NODE_OK, NODE_NULL_POINTER).
 
    Explanation of the function:
    - NodeStatus_t: An enumeration representing different statuses related to node operations.
-   - struct Node *NextNode: A pointer to a Node structure used to store the next node after the node to be deleted.
-   - uint16_t NodeCounter: An unsigned 16-bit integer to keep track of the node count in the linked list.
-   - uint16_t counter: An unsigned 16-bit integer used for iteration within the function.
+   - struct Node *RemovedNode: A pointer to a Node structure used to store the node to be deleted.
+   - size_t counter: A size_t used for iteration within the function.
 
    Algorithm:
    - The function initializes the status variable as NODE_NOK, indicating an unsuccessful operation.
@@ -292,21 +322,21 @@ NodeStatus_t Delete_Node_At_Beginning(Node_t **NodeHead){
         - If the NodePosition is 1 (indicating the first node):
             - It calls the Delete_Node_At_Beginning function to delete the first node.
         - If the NodePosition is other than 1:
-            - It retrieves the length of the linked list using Get_Length function.
-            - If the specified position (NodePosition) is valid and within the range:
-                - It traverses the list to find the node before the one to be deleted.
+            - It traverses the list to find the node before the one to be deleted, stopping early if the list ends.
+            - If that node and its successor exist (the specified position is valid and within the range):
                 - It updates pointers to detach the node to be deleted from the linked list.
                 - It frees the memory allocated for the deleted node.
-            - If the specified position is invalid or out of range:
+            - If the specified position is zero or out of range:
                 - It sets status as NODE_NOK, indicating an unsuccessful operation.
+        - The range check and the search share a single traversal, so the list length is never computed separately.
    - The function returns the status indicating the success or failure of the operation.
 */
 
-NodeStatus_t Delete_Node(Node_t **NodeHead, uint16_t NodePosition){
+NodeStatus_t Delete_Node_Wide(Node_t **NodeHead, size_t NodePosition){
     NodeStatus_t status = NODE_NOK;
     struct Node *RemovedNode = NULL;
-    uint16_t NodeCounter = 0;  // Initialize NodeCounter to keep track of node count
-    uint16_t counter = 1;  // Initialize counter for iteration
+    size_t counter = 1;  // Initialize counter for iteration
+    LIST_STATS_ENTER();
 
     /* Check for NULL pointers in the input parameters */
     if(NULL == NodeHead){
@@ -317,22 +347,25 @@ NodeStatus_t Delete_Node(Node_t **NodeHead, uint16_t NodePosition){
             status = Delete_Node_At_Beginning(NodeHead);
         }
         else{
-            // Get the length of the linked list using Get_Length function
-            Get_Length(NodeHead, &NodeCounter);
+            struct Node *NodeHeadCopy = NULL;
 
-            if((0 != NodePosition)&&(NodePosition <= NodeCounter)){
-                struct Node *NodeHeadCopy = *NodeHead;  // Create a temporary copy of the head pointer
+            if(0 != NodePosition){
+                NodeHeadCopy = *NodeHead;  // Create a temporary copy of the head pointer
 
-                // Traverse to find the node at NodePosition
-                while (counter < (NodePosition - 1))
+                // Traverse to find the node before NodePosition, stopping if the list is shorter
+                while ((NULL != NodeHeadCopy) && (counter < (NodePosition - 1)))
                 {
                     NodeHeadCopy = NodeHeadCopy->NodeLink;
+                    LIST_STATS_STEP();
                     counter++;
                 }
+            }
 
+            if((NULL != NodeHeadCopy) && (NULL != NodeHeadCopy->NodeLink)){
                 RemovedNode = NodeHeadCopy->NodeLink;  
                 NodeHeadCopy->NodeLink = RemovedNode->NodeLink;  
                 free(RemovedNode); // Free the memory allocated for the removed node
+                LIST_STATS_FREE(1U);
                 status = NODE_OK;  // Set status as NODE_OK indicating successful deletion
             }
             else{
@@ -341,9 +374,18 @@ NodeStatus_t Delete_Node(Node_t **NodeHead, uint16_t NodePosition){
         }
         
     }
+    LIST_STATS_EXIT(LIST_OP_DELETE_NODE_WIDE, status);
     return status;
 }
 
+/*
+   This function Delete_Node is responsible for deleting a node from a specified position in a linked list.
+   It is kept for existing callers with 16-bit positions and forwards to Delete_Node_Wide, so its behavior is identical.
+*/
+NodeStatus_t Delete_Node(Node_t **NodeHead, uint16_t NodePosition){
+    return Delete_Node_Wide(NodeHead, (size_t)NodePosition);
+}
+
 /*
    This function Display_All_Nodes is responsible for displaying the data of all nodes in a linked list.
    It takes a pointer to the head of the linked list (NodeHead) as input.
@@ -371,6 +413,7 @@ NodeStatus_t Delete_Node(Node_t **NodeHead, uint16_t NodePosition){
 NodeStatus_t Display_All_Nodes(Node_t *NodeHead){
     NodeStatus_t status = NODE_NOK;
     Node_t *NodeHeadcopy = NodeHead;  // Create a temporary copy of the head pointer
+    LIST_STATS_ENTER();
 
     /* Check for NULL pointers in the input parameters */
     if(NULL == NodeHead){
@@ -380,29 +423,32 @@ NodeStatus_t Display_All_Nodes(Node_t *NodeHead){
         while(NodeHeadcopy != NULL){
             printf("%i -> ", NodeHeadcopy->NodeData);  // Display the node data
             NodeHeadcopy = NodeHeadcopy->NodeLink;  // Move to the next node
+            LIST_STATS_STEP();
         }
         if(NULL == NodeHeadcopy){
             printf("NULL \n");  // Print "NULL" to indicate the end of the linked list
         }
         status = NODE_OK; // Set status as NODE_OK indicating successful display
     }
+    LIST_STATS_EXIT(LIST_OP_DISPLAY_ALL_NODES, status);
     return status;
 }
 
 /*
-   This function Get_Length is responsible for determining the length (number of nodes) of a linked list.
-   It takes a double pointer to the head of the linked list (NodeHead) and a pointer to an unsigned 16-bit integer (Length) as input.
+   This function Get_Length_Wide is responsible for determining the length (number of nodes) of a linked list.
+   It takes a double pointer to the head of the linked list (NodeHead) and a pointer to a size_t (Length) as input.
 
    Parameters:
    - NodeHead: A double pointer to the head of the linked list whose length needs to be determined.
-   - Length: A pointer to an unsigned 16-bit integer where the length of the linked list will be stored.
+   - Length: A pointer to a size_t where the length of the linked list will be stored.
 
    Return value:
    - NodeStatus_t: It returns a NodeStatus_t value, which indicates the status of the operation (NODE_NOK, NODE_OK, NODE_NULL_POINTER).
 
    Explanation of the function:
    - NodeStatus_t: An enumeration representing different statuses related to node operations.
-   - uint16_t l_Length: A local variable to calculate and store the length of the linked list.
+   - size_t l_Length: A local variable to calculate and store the length of the linked list.
+     Every node occupies at least sizeof(Node_t) bytes of memory, so the node count can never exceed what size_t holds.
 
    Algorithm:
    - The function first initializes the status variable as NODE_NOK (indicating an unsuccessful operation).
@@ -414,9 +460,10 @@ NodeStatus_t Display_All_Nodes(Node_t *NodeHead){
      - Finally, it sets the status as NODE_OK indicating a successful length calculation operation.
    - The function returns the status indicating the success or failure of the operation.
 */
-NodeStatus_t Get_Length(Node_t **NodeHead, uint16_t *Length){
+NodeStatus_t Get_Length_Wide(Node_t **NodeHead, size_t *Length){
     NodeStatus_t status = NODE_NOK;
-    uint16_t l_Length = 0; // Local variable to store the length of the linked list
+    size_t l_Length = 0; // Local variable to store the length of the linked list
+    LIST_STATS_ENTER();
 
     /* Check for NULL pointers in the input parameters */
     if((NULL == NodeHead)||(NULL == Length)){
@@ -428,10 +475,2765 @@ NodeStatus_t Get_Length(Node_t **NodeHead, uint16_t *Length){
         while (NULL != NodeHeadCopy)
         {
             NodeHeadCopy = NodeHeadCopy->NodeLink;  // Move to the next node
+            LIST_STATS_STEP();
             l_Length++; // Increment the length counter
         }
         *Length = l_Length;  // Store the calculated length in the provided Length variable using the pointer
         status = NODE_OK;
     }
+    LIST_STATS_EXIT(LIST_OP_GET_LENGTH_WIDE, status);
+    return status;
+}
+
+/*
+   This function Get_Length is responsible for determining the length (number of nodes) of a linked list into a 16-bit counter.
+   It is kept for existing callers and forwards to Get_Length_Wide.
+
+   Return value:
+   - NodeStatus_t: NODE_OK if the length fits in uint16_t, NODE_NULL_POINTER if a pointer is NULL,
+                   or NODE_NOK if the list has more than NODE_LENGTH_MAX_U16 nodes. In that case Length is set to
+                   NODE_LENGTH_MAX_U16 instead of a wrapped-around value; use Get_Length_Wide for such lists.
+*/
+NodeStatus_t Get_Length(Node_t **NodeHead, uint16_t *Length){
+    NodeStatus_t status = NODE_NOK;
+    size_t l_Length = 0; // Local variable to store the full length of the linked list
+    LIST_STATS_ENTER();
+
+    /* Check for NULL pointers in the input parameters */
+    if(NULL == Length){
+        status = NODE_NULL_POINTER;
+    }
+    else{
+        status = Get_Length_Wide(NodeHead, &l_Length);
+        if(NODE_OK == status){
+            if(l_Length > NODE_LENGTH_MAX_U16){
+                *Length = NODE_LENGTH_MAX_U16;  // Saturate instead of wrapping around
+                status = NODE_NOK;
+            }
+            else{
+                *Length = (uint16_t)l_Length;
+            }
+        }
+    }
+    LIST_STATS_EXIT(LIST_OP_GET_LENGTH, status);
+    return status;
+}
+
+/*
+   This function Build_Chain is responsible for turning an array of values into a private chain of malloc'ed nodes.
+   It is shared by the bulk insertions of the raw list, so each of them makes one pass over the values and
+   no pass over the list apart from finding the insertion point.
+
+   Parameters:
+   - Data: A pointer to the values, in list order.
+   - Count: The number of values (at least 1).
+   - FirstNode / LastNode: Double pointers that receive the ends of the chain (the last NodeLink is NULL).
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success or NODE_NOK if memory allocation failed; the nodes built so far are then freed,
+                   so a bulk insertion either adds every value or none.
+
+   The nodes are allocated one by one because Delete_Node and Delete_Node_At_Beginning free nodes one by one;
+   lists with a node pool get a single contiguous block instead (see List_Allocate_Chain).
+*/
+static NodeStatus_t Build_Chain(const uint32_t *Data, size_t Count, Node_t **FirstNode, Node_t **LastNode){
+    NodeStatus_t status = NODE_OK;
+    Node_t *l_First = NULL;
+    Node_t *l_Last = NULL;
+    size_t counter = 0;
+
+    for(counter = 0; (counter < Count) && (NODE_OK == status); counter++){
+        Node_t *NodeList = (Node_t *)malloc(sizeof(Node_t));
+        LIST_STATS_ALLOC(NodeList);
+
+        if(NULL == NodeList){  // Check if memory allocation failed
+            status = NODE_NOK;
+        }
+        else{
+            NodeList->NodeData = Data[counter];
+            NodeList->NodeLink = NULL;
+            if(NULL == l_Last){
+                l_First = NodeList;
+            }
+            else{
+                l_Last->NodeLink = NodeList;
+            }
+            l_Last = NodeList;
+        }
+    }
+    if(NODE_OK != status){
+        while (NULL != l_First)
+        {
+            Node_t *NextNode = l_First->NodeLink;  // Keep the successor before the node is freed
+            free(l_First);
+            LIST_STATS_FREE(1U);
+            l_First = NextNode;
+        }
+    }
+    else{
+        *FirstNode = l_First;
+        *LastNode = l_Last;
+    }
+    return status;
+}
+
+/*
+   This function Insert_Nodes_At_Beginning is the bulk version of Insert_Node_At_Beginning.
+   It takes a double pointer to the head of the linked list (NodeHead), an array of values (Data) and its length (Count).
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success (also for Count = 0), NODE_NULL_POINTER if a pointer is NULL,
+                   or NODE_NOK if memory allocation failed (the list is then unchanged).
+
+   Algorithm:
+   - The values are built into a chain in array order and the whole chain is linked in front of the old head,
+     so afterwards the list starts with Data[0], Data[1], ... (not reversed as with repeated Insert_Node_At_Beginning).
+*/
+NodeStatus_t Insert_Nodes_At_Beginning(Node_t **NodeHead, const uint32_t *Data, size_t Count){
+    NodeStatus_t status = NODE_NOK;
+    Node_t *FirstNode = NULL;
+    Node_t *LastNode = NULL;
+    LIST_STATS_ENTER();
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == NodeHead)||(NULL == Data)){
+        status = NODE_NULL_POINTER;
+    }
+    else if(0U == Count){
+        status = NODE_OK;  // Nothing to insert
+    }
+    else if(NODE_OK == (status = Build_Chain(Data, Count, &FirstNode, &LastNode))){
+        LastNode->NodeLink = *NodeHead;
+        *NodeHead = FirstNode;
+    }
+    else{
+        /* Nothing, status holds the error */
+    }
+    LIST_STATS_EXIT(LIST_OP_INSERT_NODES_AT_BEGINNING, status);
+    return status;
+}
+
+/*
+   This function Insert_Nodes_At_End is the bulk version of Insert_Node_At_End.
+   It takes a double pointer to the head of the linked list (NodeHead), an array of values (Data) and its length (Count).
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success (also for Count = 0), NODE_NULL_POINTER if a pointer is NULL,
+                   or NODE_NOK if memory allocation failed (the list is then unchanged).
+
+   Algorithm:
+   - The list is walked once to find the last node, whatever Count is, and the chain is linked after it.
+*/
+NodeStatus_t Insert_Nodes_At_End(Node_t **NodeHead, const uint32_t *Data, size_t Count){
+    NodeStatus_t status = NODE_NOK;
+    Node_t *FirstNode = NULL;
+    Node_t *LastNode = NULL;
+    LIST_STATS_ENTER();
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == NodeHead)||(NULL == Data)){
+        status = NODE_NULL_POINTER;
+    }
+    else if(0U == Count){
+        status = NODE_OK;  // Nothing to insert
+    }
+    else if(NODE_OK == (status = Build_Chain(Data, Count, &FirstNode, &LastNode))){
+        if(NULL == *NodeHead){  /* If the linked list is empty */
+            *NodeHead = FirstNode;
+        }
+        else{
+            Node_t *NodeHeadCopy = *NodeHead;
+
+            while (NULL != NodeHeadCopy->NodeLink)
+            {
+                NodeHeadCopy = NodeHeadCopy->NodeLink;  // Move to the last node
+                LIST_STATS_STEP();
+            }
+            NodeHeadCopy->NodeLink = FirstNode;
+        }
+    }
+    else{
+        /* Nothing, status holds the error */
+    }
+    LIST_STATS_EXIT(LIST_OP_INSERT_NODES_AT_END, status);
+    return status;
+}
+
+/*
+   This function Insert_Nodes_After is the bulk version of Insert_Node_After_Wide.
+   It takes a double pointer to the head of the linked list (NodeHead), a position (NodePosition),
+   an array of values (Data) and its length (Count).
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success (also for Count = 0), NODE_NULL_POINTER if a pointer is NULL,
+                   or NODE_NOK if the position is out of range or memory allocation failed (the list is then unchanged).
+
+   Algorithm:
+   - As with Insert_Node_After_Wide, inserting into an empty list stores the values whatever the position.
+   - Otherwise the node at NodePosition is located first (one walk that also checks the range), and only then is the chain built
+     and linked after it, so Data[0] ends up at position NodePosition + 1.
+*/
+NodeStatus_t Insert_Nodes_After(Node_t **NodeHead, size_t NodePosition, const uint32_t *Data, size_t Count){
+    NodeStatus_t status = NODE_NOK;
+    Node_t *FirstNode = NULL;
+    Node_t *LastNode = NULL;
+    LIST_STATS_ENTER();
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == NodeHead)||(NULL == Data)){
+        status = NODE_NULL_POINTER;
+    }
+    else if(NULL == *NodeHead){  /* If the linked list is empty */
+        status = Insert_Nodes_At_Beginning(NodeHead, Data, Count);
+    }
+    else{
+        Node_t *NodeHeadCopy = NULL;
+        size_t counter = 1;
+
+        if(0 != NodePosition){
+            NodeHeadCopy = *NodeHead;
+
+            // Traverse to find the node at NodePosition, stopping if the list is shorter
+            while ((NULL != NodeHeadCopy) && (counter < NodePosition))
+            {
+                NodeHeadCopy = NodeHeadCopy->NodeLink;
+                LIST_STATS_STEP();
+                counter++;
+            }
+        }
+        if(NULL == NodeHeadCopy){
+            status = NODE_NOK;  // Position out of range or zero
+        }
+        else if(0U == Count){
+            status = NODE_OK;  // Nothing to insert
+        }
+        else if(NODE_OK == (status = Build_Chain(Data, Count, &FirstNode, &LastNode))){
+            LastNode->NodeLink = NodeHeadCopy->NodeLink;  // Connect the right side connection
+            NodeHeadCopy->NodeLink = FirstNode;          // Connect the left side connection
+        }
+        else{
+            /* Nothing, status holds the error */
+        }
+    }
+    LIST_STATS_EXIT(LIST_OP_INSERT_NODES_AFTER, status);
+    return status;
+}
+
+/*
+   This function Extract_Nodes is responsible for copying the values of a linked list into an array, in list order.
+   It takes a pointer to the head of the linked list (NodeHead), the array (Data), its capacity (Capacity)
+   and a pointer that receives the number of values copied (Count).
+
+   Return value:
+   - NodeStatus_t: NODE_OK if the whole list was copied, NODE_NULL_POINTER if Data or Count is NULL,
+                   NODE_EMPTY if the list is empty (Count = 0), or NODE_NOK if the list is longer than Capacity
+                   (the first Capacity values are copied).
+*/
+NodeStatus_t Extract_Nodes(Node_t *NodeHead, uint32_t *Data, size_t Capacity, size_t *Count){
+    NodeStatus_t status = NODE_NOK;
+    LIST_STATS_ENTER();
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == Data)||(NULL == Count)){
+        status = NODE_NULL_POINTER;
+    }
+    else if(NULL == NodeHead){  /* If the linked list is empty */
+        *Count = 0;
+        status = NODE_EMPTY;
+    }
+    else{
+        Node_t *NodeHeadCopy = NodeHead;
+        size_t counter = 0;
+
+        while ((NULL != NodeHeadCopy) && (counter < Capacity))
+        {
+            Data[counter] = NodeHeadCopy->NodeData;
+            NodeHeadCopy = NodeHeadCopy->NodeLink;  // Move to the next node
+            LIST_STATS_STEP();
+            counter++;
+        }
+        *Count = counter;
+        status = (NULL == NodeHeadCopy) ? NODE_OK : NODE_NOK;
+    }
+    LIST_STATS_EXIT(LIST_OP_EXTRACT_NODES, status);
+    return status;
+}
+
+/*
+   This function Merge_Runs is responsible for merging two sorted, NULL-terminated chains into one sorted chain.
+   It is the building block of Sort_Chain, Merge_Sorted_Nodes and List_Merge_Sorted.
+
+   Parameters:
+   - Left / LeftLast: The head and the last node of the first chain (both NULL for an empty chain).
+   - Right / RightLast: The head and the last node of the second chain (both NULL for an empty chain).
+   - LastNode: A double pointer that receives the last node of the merged chain (NULL if both chains are empty).
+
+   Return value:
+   - Node_t *: The head of the merged chain.
+
+   Algorithm:
+   - The smaller head is relinked after the merged part until one chain runs out; the rest of the other chain is
+     attached as it is, and its known last node is the last node of the result, so nothing is walked twice.
+   - On equal values the node of Left is taken first, so the merge is stable.
+   - No node is allocated or copied; a local anchor node stands in front of the merged chain.
+*/
+static Node_t *Merge_Runs(Node_t *Left, Node_t *LeftLast, Node_t *Right, Node_t *RightLast, Node_t **LastNode){
+    Node_t Anchor;
+    Node_t *l_Last = &Anchor;
+
+    while ((NULL != Left) && (NULL != Right))
+    {
+        if(Right->NodeData < Left->NodeData){
+            l_Last->NodeLink = Right;
+            Right = Right->NodeLink;
+        }
+        else{
+            l_Last->NodeLink = Left;  // Ties take Left first to keep the order stable
+            Left = Left->NodeLink;
+        }
+        l_Last = l_Last->NodeLink;
+        LIST_STATS_STEP();
+    }
+    if(NULL != Left){
+        l_Last->NodeLink = Left;  // Attach what is left of the first chain
+        l_Last = LeftLast;
+    }
+    else if(NULL != Right){
+        l_Last->NodeLink = Right;  // Attach what is left of the second chain
+        l_Last = RightLast;
+    }
+    else{
+        l_Last->NodeLink = NULL;
+    }
+    *LastNode = (&Anchor == l_Last) ? NULL : l_Last;
+    return Anchor.NodeLink;
+}
+
+/*
+   This function Sort_Chain is responsible for sorting a chain by NodeData in ascending order.
+   It is shared by Sort_Nodes and List_Sort.
+
+   Parameters:
+   - NodeHead: A double pointer to the head of the chain; it receives the new head.
+
+   Return value:
+   - Node_t *: The last node of the sorted chain (NULL for an empty chain).
+
+   Algorithm:
+   - Bottom-up merge sort without recursion. Bins[k] holds either nothing or a sorted run of 2^k nodes.
+     Nodes are taken off the chain one at a time; each one is merged with Bins[0], Bins[1], ... while those are full,
+     like a carry in a binary counter, and the result is stored in the first empty bin. At the end the bins are merged
+     from the smallest to the largest.
+   - Only the existing nodes are relinked. The 64 bins are a fixed amount of extra space (enough for 2^64 nodes),
+     so the extra space is O(1) and the time O(n log n) for any input order.
+   - Runs are merged as soon as two of the same size exist, so most merges work on nodes that were just touched and
+     are still in the cache, unlike one full pass over the chain per run size.
+   - Older nodes are always the left side of a merge, so equal values keep their order (stable sort).
+*/
+static Node_t *Sort_Chain(Node_t **NodeHead){
+    Node_t *Bins[SORT_BINS_MAX];
+    Node_t *BinLast[SORT_BINS_MAX];
+    Node_t *Pending = *NodeHead;
+    Node_t *Result = NULL;
+    Node_t *ResultLast = NULL;
+    size_t BinsUsed = 0;
+    size_t counter = 0;
+
+    while (NULL != Pending)
+    {
+        Node_t *Run = Pending;
+        Node_t *RunLast = Pending;
+
+        Pending = Pending->NodeLink;
+        LIST_STATS_STEP();
+        Run->NodeLink = NULL;  // Single node run
+        for(counter = 0; (counter < BinsUsed) && (NULL != Bins[counter]); counter++){
+            Run = Merge_Runs(Bins[counter], BinLast[counter], Run, RunLast, &RunLast);
+            Bins[counter] = NULL;
+        }
+        if(counter == BinsUsed){
+            BinsUsed++;  // First run of this size
+        }
+        Bins[counter] = Run;
+        BinLast[counter] = RunLast;
+    }
+    for(counter = 0; counter < BinsUsed; counter++){
+        if(NULL != Bins[counter]){
+            Result = Merge_Runs(Bins[counter], BinLast[counter], Result, ResultLast, &ResultLast);
+        }
+    }
+    *NodeHead = Result;
+    return ResultLast;
+}
+
+/*
+   This function Sort_Nodes is responsible for sorting a linked list by NodeData in ascending order.
+   It takes a double pointer to the head of the linked list (NodeHead) as input.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if NodeHead is NULL, or NODE_EMPTY if the list is empty.
+
+   Algorithm:
+   - The list is sorted in place with the bottom-up merge sort of Sort_Chain.
+     The nodes are relinked, never copied or reallocated, and equal values keep their order.
+*/
+NodeStatus_t Sort_Nodes(Node_t **NodeHead){
+    NodeStatus_t status = NODE_NOK;
+    LIST_STATS_ENTER();
+
+    /* Check for NULL pointers in the input parameters */
+    if(NULL == NodeHead){
+        status = NODE_NULL_POINTER;
+    }
+    else if(NULL == *NodeHead){  /* If the linked list is empty */
+        status = NODE_EMPTY;
+    }
+    else{
+        (void)Sort_Chain(NodeHead);
+        status = NODE_OK;
+    }
+    LIST_STATS_EXIT(LIST_OP_SORT_NODES, status);
+    return status;
+}
+
+/*
+   This function Insert_Node_Sorted is responsible for inserting a value into a list sorted by NodeData so it stays sorted.
+   It takes a double pointer to the head of the linked list (NodeHead) and a pointer to generic data (Data) as input.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if a pointer is NULL, or NODE_NOK if memory allocation failed.
+
+   Algorithm:
+   - The list is walked up to the last node holding a value <= the new value, and the new node is linked after it,
+     so it goes after any equal values (the same order Sort_Nodes would give). The list must already be sorted.
+*/
+NodeStatus_t Insert_Node_Sorted(Node_t **NodeHead, void *Data){
+    NodeStatus_t status = NODE_NOK;
+    uint32_t *_Data = Data;  // Cast the void pointer Data to uint32_t pointer
+    LIST_STATS_ENTER();
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == NodeHead)||(NULL == Data)){
+        status = NODE_NULL_POINTER;
+    }
+    else if((NULL == *NodeHead)||(*_Data < (*NodeHead)->NodeData)){
+        status = Insert_Node_At_Beginning(NodeHead, Data);  // The value goes in front of the head
+    }
+    else{
+        Node_t *NodeHeadCopy = *NodeHead;
+        Node_t *NodeList = NULL;
+
+        while ((NULL != NodeHeadCopy->NodeLink) && (NodeHeadCopy->NodeLink->NodeData <= *_Data))
+        {
+            NodeHeadCopy = NodeHeadCopy->NodeLink;  // Move past the smaller and equal values
+            LIST_STATS_STEP();
+        }
+        NodeList = (Node_t *)malloc(sizeof(Node_t));
+        LIST_STATS_ALLOC(NodeList);
+        if(NULL == NodeList){  // Check if memory allocation failed
+            status = NODE_NOK;
+        }
+        else{
+            NodeList->NodeData = *_Data;
+            NodeList->NodeLink = NodeHeadCopy->NodeLink;  // Connect the right side connection
+            NodeHeadCopy->NodeLink = NodeList;            // Connect the left side connection
+            status = NODE_OK;
+        }
+    }
+    LIST_STATS_EXIT(LIST_OP_INSERT_NODE_SORTED, status);
+    return status;
+}
+
+/*
+   This function Merge_Sorted_Nodes is responsible for merging a second sorted list into a first one.
+   It takes two double pointers to the heads of the linked lists (NodeHead and OtherHead) as input.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success or NODE_NULL_POINTER if a pointer is NULL.
+
+   Algorithm:
+   - Both lists must be sorted by NodeData. Their nodes are relinked into one sorted list in *NodeHead
+     with a single Merge_Runs pass, and *OtherHead becomes the empty list. Nothing is allocated or freed.
+   - On equal values the nodes of NodeHead come first.
+*/
+NodeStatus_t Merge_Sorted_Nodes(Node_t **NodeHead, Node_t **OtherHead){
+    NodeStatus_t status = NODE_NOK;
+    Node_t *LastNode = NULL;
+    LIST_STATS_ENTER();
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == NodeHead)||(NULL == OtherHead)){
+        status = NODE_NULL_POINTER;
+    }
+    else if(NodeHead == OtherHead){
+        status = NODE_OK;  // Merging a list with itself leaves it as it is
+    }
+    else{
+        *NodeHead = Merge_Runs(*NodeHead, NULL, *OtherHead, NULL, &LastNode);  // The last node is not needed here
+        *OtherHead = NULL;
+        status = NODE_OK;
+    }
+    LIST_STATS_EXIT(LIST_OP_MERGE_SORTED_NODES, status);
+    return status;
+}
+
+/*
+   This function Find_By_Value is responsible for finding the first node that holds a given value.
+   It takes a pointer to the head of the linked list (NodeHead), a pointer to generic data (Data) and a pointer that
+   receives the position (NodePosition).
+
+   Return value:
+   - NodeStatus_t: NODE_OK if the value was found, NODE_NULL_POINTER if Data or NodePosition is NULL,
+                   NODE_EMPTY if the list is empty, or NODE_NOK if no node holds the value.
+
+   Algorithm:
+   - The list is walked once from the head; *NodePosition receives the 1-based position of the first match.
+*/
+NodeStatus_t Find_By_Value(Node_t *NodeHead, void *Data, size_t *NodePosition){
+    NodeStatus_t status = NODE_NOK;
+    uint32_t *_Data = Data;  // Cast the void pointer Data to uint32_t pointer
+    LIST_STATS_ENTER();
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == Data)||(NULL == NodePosition)){
+        status = NODE_NULL_POINTER;
+    }
+    else if(NULL == NodeHead){  /* If the linked list is empty */
+        status = NODE_EMPTY;
+    }
+    else{
+        Node_t *NodeHeadCopy = NodeHead;
+        size_t counter = 1;
+
+        while ((NULL != NodeHeadCopy) && (NodeHeadCopy->NodeData != *_Data))
+        {
+            NodeHeadCopy = NodeHeadCopy->NodeLink;  // Move to the next node
+            LIST_STATS_STEP();
+            counter++;
+        }
+        if(NULL == NodeHeadCopy){
+            status = NODE_NOK;  // Value not in the list
+        }
+        else{
+            *NodePosition = counter;
+            status = NODE_OK;
+        }
+    }
+    LIST_STATS_EXIT(LIST_OP_FIND_BY_VALUE, status);
+    return status;
+}
+
+/*
+   This function Delete_By_Value is responsible for deleting the first node that holds a given value.
+   It takes a double pointer to the head of the linked list (NodeHead) and a pointer to generic data (Data) as input.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if a pointer is NULL,
+                   NODE_EMPTY if the list is empty, or NODE_NOK if no node holds the value.
+
+   Algorithm:
+   - One walk keeps the previous node while it looks for the value, so the node is unlinked and freed where it is found,
+     instead of a Find_By_Value walk followed by a second Delete_Node walk to the same position.
+*/
+NodeStatus_t Delete_By_Value(Node_t **NodeHead, void *Data){
+    NodeStatus_t status = NODE_NOK;
+    uint32_t *_Data = Data;  // Cast the void pointer Data to uint32_t pointer
+    LIST_STATS_ENTER();
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == NodeHead)||(NULL == Data)){
+        status = NODE_NULL_POINTER;
+    }
+    else if(NULL == *NodeHead){  /* If the linked list is empty */
+        status = NODE_EMPTY;
+    }
+    else{
+        Node_t *PrevNode = NULL;
+        Node_t *NodeHeadCopy = *NodeHead;
+
+        while ((NULL != NodeHeadCopy) && (NodeHeadCopy->NodeData != *_Data))
+        {
+            PrevNode = NodeHeadCopy;
+            NodeHeadCopy = NodeHeadCopy->NodeLink;  // Move to the next node
+            LIST_STATS_STEP();
+        }
+        if(NULL == NodeHeadCopy){
+            status = NODE_NOK;  // Value not in the list
+        }
+        else{
+            if(NULL == PrevNode){
+                *NodeHead = NodeHeadCopy->NodeLink;  // The head is removed
+            }
+            else{
+                PrevNode->NodeLink = NodeHeadCopy->NodeLink;  // Bypass the removed node
+            }
+            free(NodeHeadCopy);
+            LIST_STATS_FREE(1U);
+            status = NODE_OK;
+        }
+    }
+    LIST_STATS_EXIT(LIST_OP_DELETE_BY_VALUE, status);
+    return status;
+}
+
+/*
+   This function Get_Fragmentation is responsible for measuring how scattered the nodes of a list are in memory.
+   It takes a pointer to the head of the linked list (NodeHead) and a pointer to the structure that receives the metric.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if Fragmentation is NULL, or NODE_EMPTY if the list is empty.
+                   A list of one node has no links; its metric is all zero.
+
+   Algorithm:
+   - One walk adds up the absolute address distance between every node and its successor, and counts the links
+     that point at most NODE_FRAG_NEAR_BYTES forward. Only addresses are compared; no node is changed.
+*/
+NodeStatus_t Get_Fragmentation(Node_t *NodeHead, ListFragmentation_t *Fragmentation){
+    NodeStatus_t status = NODE_NOK;
+    LIST_STATS_ENTER();
+
+    /* Check for NULL pointers in the input parameters */
+    if(NULL == Fragmentation){
+        status = NODE_NULL_POINTER;
+    }
+    else if(NULL == NodeHead){  /* If the linked list is empty */
+        status = NODE_EMPTY;
+    }
+    else{
+        Node_t *NodeHeadCopy = NodeHead;
+        double TotalDistance = 0.0;
+        size_t Links = 0;
+        size_t NearLinks = 0;
+
+        while (NULL != NodeHeadCopy->NodeLink)
+        {
+            size_t Here = (size_t)NodeHeadCopy;
+            size_t Next = (size_t)NodeHeadCopy->NodeLink;
+
+            if(Next > Here){
+                TotalDistance += (double)(Next - Here);
+                NearLinks += ((Next - Here) <= NODE_FRAG_NEAR_BYTES) ? 1U : 0U;
+            }
+            else{
+                TotalDistance += (double)(Here - Next);
+            }
+            Links++;
+            NodeHeadCopy = NodeHeadCopy->NodeLink;  // Move to the next node
+            LIST_STATS_STEP();
+        }
+        Fragmentation->FragLinks = Links;
+        Fragmentation->FragMeanDistance = (0U == Links) ? 0.0 : (TotalDistance / (double)Links);
+        Fragmentation->FragNearLinks = NearLinks;
+        status = NODE_OK;
+    }
+    LIST_STATS_EXIT(LIST_OP_GET_FRAGMENTATION, status);
+    return status;
+}
+
+/*
+   This function Compare_Node_Addresses is the qsort comparator used by Relinearize_Chain (ascending node address).
+*/
+static int Compare_Node_Addresses(const void *Left, const void *Right){
+    size_t LeftAddress = (size_t)(*(Node_t * const *)Left);
+    size_t RightAddress = (size_t)(*(Node_t * const *)Right);
+
+    return (LeftAddress > RightAddress) - (LeftAddress < RightAddress);
+}
+
+/*
+   This function Relinearize_Chain is responsible for making traversal order match address order without moving any node.
+   It is shared by Relinearize_Nodes and List_Compact.
+
+   Parameters:
+   - NodeHead: A double pointer to the head of a non-empty chain; it receives the node with the lowest address.
+   - NodeCount: The number of nodes in the chain.
+   - LastNode: A double pointer that receives the new last node.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success or NODE_NOK if the temporary arrays could not be allocated (the chain is unchanged).
+
+   Algorithm:
+   - One walk copies the node pointers and the values into two arrays, and the pointers are sorted by address.
+   - The values are written back in their original order into the sorted nodes, which are then linked in address order.
+     The list holds the same sequence, but a traversal now only moves forward in memory, so the hardware prefetcher
+     can follow it. Nodes keep their storage, so this works for malloc'ed nodes as well as pool nodes.
+   - The cost is O(n log n) time and 12 bytes of temporary memory per node.
+*/
+static NodeStatus_t Relinearize_Chain(Node_t **NodeHead, size_t NodeCount, Node_t **LastNode){
+    NodeStatus_t status = NODE_NOK;
+    Node_t **Nodes = (Node_t **)malloc(NodeCount * sizeof(Node_t *));
+    uint32_t *Values = (uint32_t *)malloc(NodeCount * sizeof(uint32_t));
+
+    if((NULL == Nodes) || (NULL == Values)){  // Check if memory allocation failed
+        status = NODE_NOK;
+    }
+    else{
+        Node_t *NodeHeadCopy = *NodeHead;
+        size_t counter = 0;
+
+        for(counter = 0; counter < NodeCount; counter++){
+            Nodes[counter] = NodeHeadCopy;
+            Values[counter] = NodeHeadCopy->NodeData;
+            NodeHeadCopy = NodeHeadCopy->NodeLink;
+            LIST_STATS_STEP();
+        }
+        qsort(Nodes, NodeCount, sizeof(Node_t *), Compare_Node_Addresses);
+        for(counter = 0; counter < NodeCount; counter++){
+            Nodes[counter]->NodeData = Values[counter];
+            Nodes[counter]->NodeLink = ((counter + 1U) < NodeCount) ? Nodes[counter + 1U] : NULL;
+        }
+        *NodeHead = Nodes[0];
+        *LastNode = Nodes[NodeCount - 1U];
+        status = NODE_OK;
+    }
+    free(Nodes);
+    free(Values);
+    return status;
+}
+
+/*
+   This function Relinearize_Nodes is responsible for restoring traversal locality of a list after churn.
+   It takes a double pointer to the head of the linked list (NodeHead) as input.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if NodeHead is NULL, NODE_EMPTY if the list is empty,
+                   or NODE_NOK if the temporary arrays could not be allocated (the list is unchanged).
+
+   Algorithm:
+   - The list is counted, then Relinearize_Chain relinks the nodes in address order and moves the values so the
+     sequence read from the head is unchanged. No node is allocated or freed, but the values no longer live
+     in the same nodes, so pointers to individual nodes must not be kept across the call.
+   - Use Get_Fragmentation to decide whether the O(n log n) pass is worth it.
+*/
+NodeStatus_t Relinearize_Nodes(Node_t **NodeHead){
+    NodeStatus_t status = NODE_NOK;
+    LIST_STATS_ENTER();
+
+    /* Check for NULL pointers in the input parameters */
+    if(NULL == NodeHead){
+        status = NODE_NULL_POINTER;
+    }
+    else if(NULL == *NodeHead){  /* If the linked list is empty */
+        status = NODE_EMPTY;
+    }
+    else{
+        Node_t *NodeHeadCopy = *NodeHead;
+        Node_t *LastNode = NULL;
+        size_t NodeCount = 0;
+
+        while (NULL != NodeHeadCopy)
+        {
+            NodeCount++;
+            NodeHeadCopy = NodeHeadCopy->NodeLink;  // Move to the next node
+            LIST_STATS_STEP();
+        }
+        status = Relinearize_Chain(NodeHead, NodeCount, &LastNode);
+    }
+    LIST_STATS_EXIT(LIST_OP_RELINEARIZE_NODES, status);
+    return status;
+}
+
+/*
+   This function Concat_Nodes is responsible for appending a second list to the end of a first one without copying.
+   It takes two double pointers to the heads of the linked lists (NodeHead and OtherHead) as input.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if a pointer is NULL,
+                   or NODE_NOK if both pointers refer to the same list.
+
+   Algorithm:
+   - The first list is walked once to its last node, whose NodeLink is pointed at the head of the second list,
+     and *OtherHead becomes the empty list. Nothing is allocated or freed.
+   - List_Concat does the same in O(1), since the handle knows its tail.
+*/
+NodeStatus_t Concat_Nodes(Node_t **NodeHead, Node_t **OtherHead){
+    NodeStatus_t status = NODE_NOK;
+    LIST_STATS_ENTER();
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == NodeHead)||(NULL == OtherHead)){
+        status = NODE_NULL_POINTER;
+    }
+    else if(NodeHead == OtherHead){
+        status = NODE_NOK;  // A list cannot be appended to itself
+    }
+    else{
+        if(NULL == *NodeHead){
+            *NodeHead = *OtherHead;  // The first list is empty, it simply takes the second one
+        }
+        else{
+            Node_t *NodeHeadCopy = *NodeHead;
+
+            while (NULL != NodeHeadCopy->NodeLink)
+            {
+                NodeHeadCopy = NodeHeadCopy->NodeLink;  // Move to the next node
+                LIST_STATS_STEP();
+            }
+            NodeHeadCopy->NodeLink = *OtherHead;
+        }
+        *OtherHead = NULL;
+        status = NODE_OK;
+    }
+    LIST_STATS_EXIT(LIST_OP_CONCAT_NODES, status);
+    return status;
+}
+
+/*
+   This function Split_Nodes is responsible for cutting a list in two after a given position without copying.
+   It takes a double pointer to the head of the linked list (NodeHead), a position (NodePosition)
+   and a double pointer that receives the second part (OtherHead).
+
+   Parameters:
+   - NodeHead: A double pointer to the head of the list; it keeps the first NodePosition nodes.
+   - NodePosition: The number of nodes that stay in the first list; 0 moves every node.
+   - OtherHead: A double pointer to an empty list that receives the nodes after NodePosition.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if a pointer is NULL,
+                   or NODE_NOK if *OtherHead is not empty or the list has fewer than NodePosition nodes (nothing changes).
+
+   Algorithm:
+   - One walk reaches the node at NodePosition; its NodeLink becomes the head of the second list and is cleared.
+*/
+NodeStatus_t Split_Nodes(Node_t **NodeHead, size_t NodePosition, Node_t **OtherHead){
+    NodeStatus_t status = NODE_NOK;
+    LIST_STATS_ENTER();
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == NodeHead)||(NULL == OtherHead)){
+        status = NODE_NULL_POINTER;
+    }
+    else if((NodeHead == OtherHead)||(NULL != *OtherHead)){
+        status = NODE_NOK;  // The second part needs an empty list of its own
+    }
+    else if(0U == NodePosition){
+        *OtherHead = *NodeHead;  // Every node moves
+        *NodeHead = NULL;
+        status = NODE_OK;
+    }
+    else{
+        Node_t *NodeHeadCopy = *NodeHead;
+        size_t counter = 1;
+
+        while ((NULL != NodeHeadCopy) && (counter < NodePosition))
+        {
+            NodeHeadCopy = NodeHeadCopy->NodeLink;  // Move to the next node
+            LIST_STATS_STEP();
+            counter++;
+        }
+        if(NULL == NodeHeadCopy){
+            status = NODE_NOK;  // Position out of range
+        }
+        else{
+            *OtherHead = NodeHeadCopy->NodeLink;
+            NodeHeadCopy->NodeLink = NULL;  // The node at NodePosition ends the first list
+            status = NODE_OK;
+        }
+    }
+    LIST_STATS_EXIT(LIST_OP_SPLIT_NODES, status);
+    return status;
+}
+
+/*
+   This function List_Allocate_Node is responsible for providing storage for one new node of a list handle.
+   It is the single place where the List_ functions obtain node memory, so every handle-based insertion shares it.
+   The node comes from the list's pool when one is attached, otherwise from malloc.
+
+   Parameters:
+   - List: A pointer to the list handle the node is allocated for.
+
+   Return value:
+   - Node_t *: A pointer to the new (uninitialized) node, or NULL if the allocation failed.
+*/
+static Node_t *List_Allocate_Node(List_t *List){
+    Node_t *NewNode = NULL;
+
+    if(NULL != List->ListPool){
+        (void)NodePool_Alloc(List->ListPool, &NewNode);  // NewNode stays NULL on failure
+    }
+    else{
+        NewNode = (Node_t *)malloc(sizeof(Node_t));
+    }
+    LIST_STATS_ALLOC(NewNode);
+    return NewNode;
+}
+
+/*
+   This function List_Release_Node is responsible for giving back the storage of one node removed from a list handle.
+   It is the counterpart of List_Allocate_Node.
+
+   Parameters:
+   - List: A pointer to the list handle the node was removed from.
+   - Node: A pointer to the node whose memory is released.
+*/
+static void List_Release_Node(List_t *List, Node_t *Node){
+    if(NULL != List->ListPool){
+        (void)NodePool_Free(List->ListPool, Node);
+    }
+    else{
+        free(Node);
+    }
+    LIST_STATS_FREE(1U);
+}
+
+/*
+   This function List_Allocate_Chain is responsible for providing a whole chain of new nodes for a bulk insertion.
+   It is the bulk counterpart of List_Allocate_Node.
+
+   Parameters:
+   - List: A pointer to the list handle the nodes are allocated for.
+   - Data: A pointer to the values, in list order.
+   - Count: The number of values (at least 1).
+   - FirstNode / LastNode: Double pointers that receive the ends of the chain (the last NodeLink is NULL).
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success or NODE_NOK if the allocation failed (nothing is allocated then).
+
+   Algorithm:
+   - With a pool attached the chain comes already linked from NodePool_Alloc_Chain (one contiguous block when it is
+     carved from fresh slab memory), and the values are copied in with a single pass along the chain.
+   - Without a pool the nodes are malloc'ed one by one with Build_Chain, so List_Release_Node can free each of them later.
+*/
+static NodeStatus_t List_Allocate_Chain(List_t *List, const uint32_t *Data, size_t Count, Node_t **FirstNode, Node_t **LastNode){
+    NodeStatus_t status = NODE_NOK;
+
+    if(NULL != List->ListPool){
+        status = NodePool_Alloc_Chain(List->ListPool, Count, FirstNode, LastNode);
+        LIST_STATS_ALLOC_CHAIN(status, Count);
+        if(NODE_OK == status){
+            Node_t *NodeCopy = *FirstNode;
+            size_t counter = 0;
+
+            for(counter = 0; counter < Count; counter++){
+                NodeCopy->NodeData = Data[counter];
+                NodeCopy = NodeCopy->NodeLink;
+                LIST_STATS_STEP();
+            }
+        }
+    }
+    else{
+        status = Build_Chain(Data, Count, FirstNode, LastNode);
+    }
+    return status;
+}
+
+/* Function to remember a node and its position as the finger of a list handle, until the next structural change */
+static void List_Set_Finger(List_t *List, Node_t *Node, size_t NodePosition){
+    List->ListFinger = Node;
+    List->ListFingerPosition = NodePosition;
+    List->ListFingerVersion = List->ListVersion;
+}
+
+/*
+   This function List_Locate_Node is responsible for finding the node at a 1-based position of a list handle.
+   The caller must have already checked that 1 <= NodePosition <= ListLength.
+
+   Parameters:
+   - List: A pointer to the list handle to search.
+   - NodePosition: The 1-based position of the requested node.
+
+   Return value:
+   - Node_t *: A pointer to the node at NodePosition.
+
+   Algorithm:
+   - If NodePosition is the last position, the tail pointer is returned directly without any traversal.
+   - Otherwise, if the finger is valid and not beyond NodePosition, the chain is walked from the finger
+     (NodePosition - ListFingerPosition) links, else from the head exactly (NodePosition - 1) links.
+   - The node found becomes the new finger.
+*/
+static Node_t *List_Locate_Node(List_t *List, size_t NodePosition){
+    Node_t *NodeHeadCopy = NULL;
+    size_t counter = 1;  // Initialize counter for iteration
+
+    if(NodePosition == List->ListLength){
+        NodeHeadCopy = List->ListTail;  // The last node is known without walking
+    }
+    else{
+        NodeHeadCopy = List->ListHead;
+        if((NULL != List->ListFinger) && (List->ListFingerVersion == List->ListVersion) &&
+           (List->ListFingerPosition <= NodePosition)){
+            NodeHeadCopy = List->ListFinger;  // Resume from the last access
+            counter = List->ListFingerPosition;
+        }
+        while (counter < NodePosition)
+        {
+            NodeHeadCopy = NodeHeadCopy->NodeLink;  // Move to the next node
+            LIST_STATS_STEP();
+            counter++;
+        }
+    }
+    List_Set_Finger(List, NodeHeadCopy, NodePosition);
+    return NodeHeadCopy;
+}
+
+/*
+   This function List_Rebuild_Index is responsible for refilling the index of a list handle from its chain.
+   It is used when an index is attached and after operations that change most predecessors (List_Sort, List_Merge_Sorted).
+
+   Parameters:
+   - List: A pointer to the list handle; nothing is done when no index is attached.
+
+   Algorithm:
+   - The index is emptied, then every node is added with its predecessor in one walk.
+   - If the table cannot grow on the way, the index is left stale and lookups walk the list instead.
+*/
+static void List_Rebuild_Index(List_t *List){
+    if(NULL != List->ListIndex){
+        Node_t *PrevNode = NULL;
+        Node_t *NodeHeadCopy = List->ListHead;
+        NodeStatus_t status = List_Index_Clear(List->ListIndex);
+
+        while ((NULL != NodeHeadCopy) && (NODE_OK == status))
+        {
+            status = List_Index_Add(List->ListIndex, NodeHeadCopy, PrevNode);
+            PrevNode = NodeHeadCopy;
+            NodeHeadCopy = NodeHeadCopy->NodeLink;
+            LIST_STATS_STEP();
+        }
+    }
+}
+
+/*
+   This function List_Init is responsible for initializing a list handle to the empty list.
+   It takes a pointer to the list handle (List) as input.
+
+   Parameters:
+   - List: A pointer to the list handle to be initialized.
+
+   Return value:
+   - NodeStatus_t: It returns NODE_OK on success or NODE_NULL_POINTER if List is NULL.
+
+   Algorithm:
+   - The head and tail pointers are set to NULL, the length and the version are set to zero and no node pool or index is attached.
+   - Any nodes previously referenced by the handle are not freed; use List_Clear for that.
+*/
+NodeStatus_t List_Init(List_t *List){
+    NodeStatus_t status = NODE_NOK;
+    LIST_STATS_ENTER();
+
+    /* Check for NULL pointers in the input parameters */
+    if(NULL == List){
+        status = NODE_NULL_POINTER;  // Set status as NODE_NULL_POINTER if List is NULL
+    }
+    else{
+        List->ListHead = NULL;
+        List->ListTail = NULL;
+        List->ListLength = 0;
+        List->ListPool = NULL;
+        List->ListVersion = 0;
+        List->ListIndex = NULL;
+        List->ListFinger = NULL;
+        List->ListFingerPosition = 0;
+        List->ListFingerVersion = 0;
+        status = NODE_OK;
+    }
+    LIST_STATS_EXIT(LIST_OP_LIST_INIT, status);
+    return status;
+}
+
+/*
+   This function List_Use_Pool is responsible for attaching a node pool to a list handle.
+   From then on every node of the list is allocated from and released to that pool.
+
+   Parameters:
+   - List: A pointer to the list handle.
+   - Pool: A pointer to an initialized node pool, or NULL to go back to malloc/free.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if List is NULL,
+                   or NODE_NOK if the list still holds nodes (they were allocated elsewhere and cannot change owner).
+*/
+NodeStatus_t List_Use_Pool(List_t *List, struct NodePool *Pool){
+    NodeStatus_t status = NODE_NOK;
+    LIST_STATS_ENTER();
+
+    /* Check for NULL pointers in the input parameters */
+    if(NULL == List){
+        status = NODE_NULL_POINTER;
+    }
+    else if(0 != List->ListLength){
+        status = NODE_NOK;  // Only an empty list may change its allocator
+    }
+    else{
+        List->ListPool = Pool;
+        status = NODE_OK;
+    }
+    LIST_STATS_EXIT(LIST_OP_LIST_USE_POOL, status);
+    return status;
+}
+
+/*
+   This function List_Use_Index is responsible for attaching a value index to a list handle.
+   From then on every List_ function keeps the index in sync with the list.
+
+   Parameters:
+   - List: A pointer to the list handle.
+   - Index: A pointer to an initialized index that no other list uses, or NULL to detach the current index.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if List is NULL,
+                   or NODE_NOK if the index could not grow to hold the nodes already in the list (it is attached but stale).
+
+   Algorithm:
+   - Unlike a pool, an index can be attached to a list that already holds nodes: it is emptied and filled in one walk.
+   - A detached index is left as it is; it no longer follows the list.
+*/
+NodeStatus_t List_Use_Index(List_t *List, struct ListIndex *Index){
+    NodeStatus_t status = NODE_NOK;
+    LIST_STATS_ENTER();
+
+    /* Check for NULL pointers in the input parameters */
+    if(NULL == List){
+        status = NODE_NULL_POINTER;
+    }
+    else{
+        List->ListIndex = Index;
+        List_Rebuild_Index(List);
+        status = ((NULL == Index)||(0U == Index->IndexStale)) ? NODE_OK : NODE_NOK;
+    }
+    LIST_STATS_EXIT(LIST_OP_LIST_USE_INDEX, status);
+    return status;
+}
+
+/*
+   This function List_Link_Node_After is responsible for linking an already allocated node into a list handle.
+   It is the only place where the List_ functions add a node to the chain, so head, tail and length are kept consistent here.
+
+   Parameters:
+   - List: A pointer to the list handle.
+   - PrevNode: A pointer to the node after which NewNode is linked, or NULL to link NewNode as the new head.
+   - NewNode: A pointer to the node to be linked. Its NodeData must already be set.
+
+   Return value:
+   - NodeStatus_t: It returns NODE_OK on success or NODE_NULL_POINTER if List or NewNode is NULL.
+
+   Algorithm:
+   - NewNode takes over the successor of PrevNode (or the old head when PrevNode is NULL).
+   - If NewNode ends up last in the chain the tail pointer is moved to it.
+   - The length counter and the version are incremented.
+   - With an index attached, the new node is added to it and its successor's predecessor is updated.
+   - PrevNode must belong to List; this is not verified, so the call is O(1).
+*/
+NodeStatus_t List_Link_Node_After(List_t *List, Node_t *PrevNode, Node_t *NewNode){
+    NodeStatus_t status = NODE_NOK;
+    LIST_STATS_ENTER();
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == List)||(NULL == NewNode)){
+        status = NODE_NULL_POINTER;
+    }
+    else{
+        if(NULL == PrevNode){  /* Link as the new head */
+            NewNode->NodeLink = List->ListHead;
+            List->ListHead = NewNode;
+        }
+        else{
+            NewNode->NodeLink = PrevNode->NodeLink;  // Connect the right side connection
+            PrevNode->NodeLink = NewNode;            // Connect the left side connection
+        }
+        if(NULL == NewNode->NodeLink){
+            List->ListTail = NewNode;  // The new node is the last one
+        }
+        List->ListLength++;
+        List->ListVersion++;
+        if(NULL != List->ListIndex){
+            (void)List_Index_Add(List->ListIndex, NewNode, PrevNode);
+            if(NULL != NewNode->NodeLink){
+                (void)List_Index_Set_Prev(List->ListIndex, NewNode->NodeLink, NewNode);  // The successor has a new predecessor
+            }
+        }
+        status = NODE_OK;
+    }
+    LIST_STATS_EXIT(LIST_OP_LIST_LINK_NODE_AFTER, status);
+    return status;
+}
+
+/*
+   This function List_Unlink_Node_After is responsible for detaching one node from a list handle without freeing it.
+   It is the only place where the List_ functions remove a node from the chain, so head, tail and length are kept consistent here.
+
+   Parameters:
+   - List: A pointer to the list handle.
+   - PrevNode: A pointer to the node whose successor is unlinked, or NULL to unlink the head.
+   - RemovedNode: A double pointer that receives the detached node.
+
+   Return value:
+   - NodeStatus_t: It returns NODE_OK on success, NODE_NULL_POINTER if List or RemovedNode is NULL,
+                   NODE_EMPTY if the list is empty, or NODE_NOK if PrevNode has no successor.
+
+   Algorithm:
+   - The node following PrevNode (or the head when PrevNode is NULL) is bypassed in the chain.
+   - If it was the last node the tail pointer moves back to PrevNode.
+   - The length counter is decremented, the version is incremented and the detached node's NodeLink is cleared.
+   - With an index attached, the node is removed from it and its successor's predecessor is updated.
+*/
+NodeStatus_t List_Unlink_Node_After(List_t *List, Node_t *PrevNode, Node_t **RemovedNode){
+    NodeStatus_t status = NODE_NOK;
+    Node_t *l_Removed = NULL;
+    LIST_STATS_ENTER();
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == List)||(NULL == RemovedNode)){
+        status = NODE_NULL_POINTER;
+    }
+    else if(NULL == List->ListHead){  /* if the linked list is empty */
+        status = NODE_EMPTY;
+    }
+    else{
+        l_Removed = (NULL == PrevNode) ? List->ListHead : PrevNode->NodeLink;
+
+        if(NULL == l_Removed){
+            status = NODE_NOK;  // PrevNode is the last node, there is nothing after it
+        }
+        else{
+            if(NULL == PrevNode){
+                List->ListHead = l_Removed->NodeLink;  // Update the head pointer to the next node
+            }
+            else{
+                PrevNode->NodeLink = l_Removed->NodeLink;  // Bypass the removed node
+            }
+            if(List->ListTail == l_Removed){
+                List->ListTail = PrevNode;  // The previous node becomes the last one (NULL if the list is now empty)
+            }
+            List->ListLength--;
+            List->ListVersion++;
+            if(NULL != List->ListIndex){
+                (void)List_Index_Remove(List->ListIndex, l_Removed);
+                if(NULL != l_Removed->NodeLink){
+                    (void)List_Index_Set_Prev(List->ListIndex, l_Removed->NodeLink, PrevNode);  // The successor moves up
+                }
+            }
+            l_Removed->NodeLink = NULL;  // Detach the removed node from the list
+            *RemovedNode = l_Removed;
+            status = NODE_OK;
+        }
+    }
+    LIST_STATS_EXIT(LIST_OP_LIST_UNLINK_NODE_AFTER, status);
+    return status;
+}
+
+/*
+   This function List_Link_Chain_After is responsible for linking a whole chain of already allocated nodes into a list handle.
+   It is the bulk counterpart of List_Link_Node_After and keeps head, tail, length and version consistent in O(1).
+
+   Parameters:
+   - List: A pointer to the list handle.
+   - PrevNode: A pointer to the node after which the chain is linked, or NULL to link it in front of the head.
+   - FirstNode / LastNode: Pointers to the ends of the chain, already linked from FirstNode to LastNode.
+   - NodeCount: The number of nodes in the chain; it is trusted, not counted.
+
+   Return value:
+   - NodeStatus_t: It returns NODE_OK on success or NODE_NULL_POINTER if List, FirstNode or LastNode is NULL.
+
+   Linking itself is O(1); with an index attached every node of the chain is also added to it, which is O(NodeCount).
+*/
+NodeStatus_t List_Link_Chain_After(List_t *List, Node_t *PrevNode, Node_t *FirstNode, Node_t *LastNode, size_t NodeCount){
+    NodeStatus_t status = NODE_NOK;
+    LIST_STATS_ENTER();
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == List)||(NULL == FirstNode)||(NULL == LastNode)){
+        status = NODE_NULL_POINTER;
+    }
+    else{
+        if(NULL == PrevNode){  /* Link in front of the head */
+            LastNode->NodeLink = List->ListHead;
+            List->ListHead = FirstNode;
+        }
+        else{
+            LastNode->NodeLink = PrevNode->NodeLink;  // Connect the right side connection
+            PrevNode->NodeLink = FirstNode;           // Connect the left side connection
+        }
+        if(NULL == LastNode->NodeLink){
+            List->ListTail = LastNode;  // The chain ends the list
+        }
+        List->ListLength += NodeCount;
+        List->ListVersion++;
+        if(NULL != List->ListIndex){
+            Node_t *IndexPrev = PrevNode;
+            Node_t *NodeCopy = FirstNode;
+
+            while (IndexPrev != LastNode)
+            {
+                (void)List_Index_Add(List->ListIndex, NodeCopy, IndexPrev);
+                IndexPrev = NodeCopy;
+                NodeCopy = NodeCopy->NodeLink;
+                LIST_STATS_STEP();
+            }
+            if(NULL != NodeCopy){
+                (void)List_Index_Set_Prev(List->ListIndex, NodeCopy, LastNode);  // The old successor follows the chain now
+            }
+        }
+        status = NODE_OK;
+    }
+    LIST_STATS_EXIT(LIST_OP_LIST_LINK_CHAIN_AFTER, status);
+    return status;
+}
+
+/*
+   This function List_Insert_Node_At_Beginning is the handle-based version of Insert_Node_At_Beginning.
+   It takes a pointer to the list handle (List) and a pointer to generic data (Data) as input.
+
+   Parameters:
+   - List: A pointer to the list handle where the new node is to be inserted.
+   - Data: A void pointer to the uint32_t value to be stored in the new node.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if a pointer is NULL, or NODE_NOK if memory allocation failed.
+
+   Algorithm:
+   - A new node is allocated, filled with the data and linked as the new head. This is O(1).
+*/
+NodeStatus_t List_Insert_Node_At_Beginning(List_t *List, void *Data){
+    NodeStatus_t status = NODE_NOK;
+    uint32_t *_Data = Data;  // Cast the void pointer Data to uint32_t pointer
+    LIST_STATS_ENTER();
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == List)||(NULL == Data)){
+        status = NODE_NULL_POINTER;
+    }
+    else{
+        Node_t *NodeList = List_Allocate_Node(List);
+
+        if(NULL == NodeList){  // Check if memory allocation failed
+            status = NODE_NOK;
+        }
+        else{
+            NodeList->NodeData = *_Data;  // Assign the data to the NodeData of the new node
+            status = List_Link_Node_After(List, NULL, NodeList);
+        }
+    }
+    LIST_STATS_EXIT(LIST_OP_LIST_INSERT_NODE_AT_BEGINNING, status);
+    return status;
+}
+
+/*
+   This function List_Insert_Node_At_End is the handle-based version of Insert_Node_At_End.
+   It takes a pointer to the list handle (List) and a pointer to generic data (Data) as input.
+
+   Parameters:
+   - List: A pointer to the list handle where the new node is to be inserted.
+   - Data: A void pointer to the uint32_t value to be stored in the new node.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if a pointer is NULL, or NODE_NOK if memory allocation failed.
+
+   Algorithm:
+   - A new node is allocated, filled with the data and linked after the tail node. No traversal is needed, so this is O(1).
+*/
+NodeStatus_t List_Insert_Node_At_End(List_t *List, void *Data){
+    NodeStatus_t status = NODE_NOK;
+    uint32_t *_Data = Data;  // Cast the void pointer Data to uint32_t pointer
+    LIST_STATS_ENTER();
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == List)||(NULL == Data)){
+        status = NODE_NULL_POINTER;
+    }
+    else{
+        Node_t *NodeList = List_Allocate_Node(List);
+
+        if(NULL == NodeList){  // Check if memory allocation failed
+            status = NODE_NOK;
+        }
+        else{
+            NodeList->NodeData = *_Data;  // Assign the data to the NodeData of the new node
+            status = List_Link_Node_After(List, List->ListTail, NodeList);
+        }
+    }
+    LIST_STATS_EXIT(LIST_OP_LIST_INSERT_NODE_AT_END, status);
+    return status;
+}
+
+/*
+   This function List_Insert_Node_After is the handle-based version of Insert_Node_After.
+   It takes a pointer to the list handle (List), a 1-based position (NodePosition) and a pointer to generic data (Data) as input.
+
+   Parameters:
+   - List: A pointer to the list handle where the new node is to be inserted.
+   - NodePosition: The position after which the new node is inserted (the first position = 1).
+   - Data: A void pointer to the uint32_t value to be stored in the new node.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if a pointer is NULL,
+                   or NODE_NOK if the position is out of range or memory allocation failed.
+
+   Algorithm:
+   - As with Insert_Node_After, inserting into an empty list makes the new node the head whatever the position.
+   - Otherwise NodePosition is checked against the cached length before anything is allocated.
+   - The node at NodePosition is located in a single walk (no walk at all for the last position) and the new node is linked after it.
+*/
+NodeStatus_t List_Insert_Node_After(List_t *List, size_t NodePosition, void *Data){
+    NodeStatus_t status = NODE_NOK;
+    uint32_t *_Data = Data;  // Cast the void pointer Data to uint32_t pointer
+    LIST_STATS_ENTER();
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == List)||(NULL == Data)){
+        status = NODE_NULL_POINTER;
+    }
+    else if((0 != List->ListLength) && ((0 == NodePosition)||(NodePosition > List->ListLength))){
+        status = NODE_NOK;  // Position out of range
+    }
+    else{
+        Node_t *NodeList = List_Allocate_Node(List);
+
+        if(NULL == NodeList){  // Check if memory allocation failed
+            status = NODE_NOK;
+        }
+        else{
+            Node_t *PrevNode = NULL;
+
+            if(0 != List->ListLength){
+                PrevNode = List_Locate_Node(List, NodePosition);
+            }
+            NodeList->NodeData = *_Data;  // Assign the data to the NodeData of the new node
+            status = List_Link_Node_After(List, PrevNode, NodeList);
+            List_Set_Finger(List, NodeList, (NULL == PrevNode) ? 1U : (NodePosition + 1U));  // Ready for the next position
+        }
+    }
+    LIST_STATS_EXIT(LIST_OP_LIST_INSERT_NODE_AFTER, status);
+    return status;
+}
+
+/*
+   This function List_Delete_Node_At_Beginning is the handle-based version of Delete_Node_At_Beginning.
+   It takes a pointer to the list handle (List) as input.
+
+   Parameters:
+   - List: A pointer to the list handle from which the first node is deleted.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if List is NULL, or NODE_EMPTY if the list is empty.
+
+   Algorithm:
+   - The head node is unlinked and its memory is released. This is O(1).
+*/
+NodeStatus_t List_Delete_Node_At_Beginning(List_t *List){
+    NodeStatus_t status = NODE_NOK;
+    Node_t *RemovedNode = NULL;
+    LIST_STATS_ENTER();
+
+    status = List_Unlink_Node_After(List, NULL, &RemovedNode);
+    if(NODE_OK == status){
+        List_Release_Node(List, RemovedNode);  // Free the memory allocated for the removed node
+    }
+    LIST_STATS_EXIT(LIST_OP_LIST_DELETE_NODE_AT_BEGINNING, status);
+    return status;
+}
+
+/*
+   This function List_Delete_Node is the handle-based version of Delete_Node.
+   It takes a pointer to the list handle (List) and the 1-based position of the node to be deleted (NodePosition).
+
+   Parameters:
+   - List: A pointer to the list handle from which the node will be deleted.
+   - NodePosition: The position of the node to be deleted (the first position = 1).
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if List is NULL,
+                   NODE_EMPTY if position 1 is requested on an empty list, or NODE_NOK if the position is out of range.
+
+   Algorithm:
+   - Position 1 is handled as List_Delete_Node_At_Beginning.
+   - Otherwise NodePosition is checked against the cached length, the node before it is located in a single walk,
+     and its successor is unlinked and released.
+*/
+NodeStatus_t List_Delete_Node(List_t *List, size_t NodePosition){
+    NodeStatus_t status = NODE_NOK;
+    Node_t *RemovedNode = NULL;
+    LIST_STATS_ENTER();
+
+    /* Check for NULL pointers in the input parameters */
+    if(NULL == List){
+        status = NODE_NULL_POINTER;
+    }
+    else if(1 == NodePosition){
+        status = List_Delete_Node_At_Beginning(List);
+    }
+    else if((0 == NodePosition)||(NodePosition > List->ListLength)){
+        status = NODE_NOK;  // Position out of range or zero
+    }
+    else{
+        Node_t *PrevNode = List_Locate_Node(List, NodePosition - 1);
+
+        status = List_Unlink_Node_After(List, PrevNode, &RemovedNode);
+        if(NODE_OK == status){
+            List_Release_Node(List, RemovedNode);  // Free the memory allocated for the removed node
+            List_Set_Finger(List, PrevNode, NodePosition - 1);  // Still in place after the unlink
+        }
+    }
+    LIST_STATS_EXIT(LIST_OP_LIST_DELETE_NODE, status);
+    return status;
+}
+
+/*
+   This function List_Display_All_Nodes is the handle-based version of Display_All_Nodes.
+   It takes a pointer to the list handle (List) as input and prints the nodes in the same format.
+
+   Parameters:
+   - List: A pointer to the list handle whose node data needs to be displayed.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if List is NULL, or NODE_EMPTY if the list has no nodes.
+*/
+NodeStatus_t List_Display_All_Nodes(List_t *List){
+    NodeStatus_t status = NODE_NOK;
+    LIST_STATS_ENTER();
+
+    /* Check for NULL pointers in the input parameters */
+    if(NULL == List){
+        status = NODE_NULL_POINTER;
+    }
+    else if(NULL == List->ListHead){  /* if the linked list is empty */
+        status = NODE_EMPTY;
+    }
+    else{
+        status = Display_All_Nodes(List->ListHead);
+    }
+    LIST_STATS_EXIT(LIST_OP_LIST_DISPLAY_ALL_NODES, status);
+    return status;
+}
+
+/*
+   This function List_Get_Length is the handle-based version of Get_Length.
+   It takes a pointer to the list handle (List) and a pointer to where the length is stored (Length).
+
+   Parameters:
+   - List: A pointer to the list handle whose length is requested.
+   - Length: A pointer to a size_t where the number of nodes is stored.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success or NODE_NULL_POINTER if a pointer is NULL.
+
+   Algorithm:
+   - The cached length is returned, so no traversal is needed.
+*/
+NodeStatus_t List_Get_Length(List_t *List, size_t *Length){
+    NodeStatus_t status = NODE_NOK;
+    LIST_STATS_ENTER();
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == List)||(NULL == Length)){
+        status = NODE_NULL_POINTER;
+    }
+    else{
+        *Length = List->ListLength;
+        status = NODE_OK;
+    }
+    LIST_STATS_EXIT(LIST_OP_LIST_GET_LENGTH, status);
+    return status;
+}
+
+/*
+   This function List_Clear is responsible for deleting every node of a list handle.
+   It takes a pointer to the list handle (List) as input and leaves the handle empty and ready for reuse.
+
+   Parameters:
+   - List: A pointer to the list handle to be cleared.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success or NODE_NULL_POINTER if List is NULL.
+
+   Algorithm:
+   - For a list attached to a pool the whole chain is handed back with NodePool_Free_Chain, which is O(1).
+   - Otherwise every node is visited and freed.
+   - The attached pool (if any) stays attached and the version is incremented, so existing cursors become stale.
+   - An attached index is emptied, which also makes a stale index follow the list again.
+*/
+NodeStatus_t List_Clear(List_t *List){
+    NodeStatus_t status = NODE_NOK;
+    LIST_STATS_ENTER();
+
+    /* Check for NULL pointers in the input parameters */
+    if(NULL == List){
+        status = NODE_NULL_POINTER;
+    }
+    else if(NULL != List->ListPool){
+        if(NULL != List->ListHead){
+            (void)NodePool_Free_Chain(List->ListPool, List->ListHead, List->ListTail, List->ListLength);
+            LIST_STATS_FREE(List->ListLength);
+        }
+        List->ListHead = NULL;
+        List->ListTail = NULL;
+        List->ListLength = 0;
+        List->ListVersion++;
+        if(NULL != List->ListIndex){
+            (void)List_Index_Clear(List->ListIndex);
+        }
+        status = NODE_OK;
+    }
+    else{
+        Node_t *NodeHeadCopy = List->ListHead;
+
+        while (NULL != NodeHeadCopy)
+        {
+            Node_t *NextNode = NodeHeadCopy->NodeLink;  // Keep the successor before the node is released
+            LIST_STATS_STEP();
+            List_Release_Node(List, NodeHeadCopy);
+            NodeHeadCopy = NextNode;
+        }
+        List->ListHead = NULL;
+        List->ListTail = NULL;
+        List->ListLength = 0;
+        List->ListVersion++;
+        if(NULL != List->ListIndex){
+            (void)List_Index_Clear(List->ListIndex);
+        }
+        status = NODE_OK;
+    }
+    LIST_STATS_EXIT(LIST_OP_LIST_CLEAR, status);
+    return status;
+}
+
+/*
+   This function List_Insert_Values is responsible for the common part of the bulk insertions of a list handle.
+   The caller has already checked the pointers and that NodePosition <= ListLength.
+
+   Parameters:
+   - List: A pointer to the list handle.
+   - NodePosition: The position after which the values are inserted, or 0 to insert them in front of the head.
+   - Data / Count: The values, in list order.
+
+   Algorithm:
+   - The chain is allocated with List_Allocate_Chain (one contiguous block for pooled lists).
+   - The node at NodePosition is located in at most one walk (none for 0 or the last position)
+     and the chain is linked after it with List_Link_Chain_After.
+*/
+static NodeStatus_t List_Insert_Values(List_t *List, size_t NodePosition, const uint32_t *Data, size_t Count){
+    NodeStatus_t status = NODE_NOK;
+    Node_t *FirstNode = NULL;
+    Node_t *LastNode = NULL;
+
+    if(0U == Count){
+        status = NODE_OK;  // Nothing to insert
+    }
+    else if(NODE_OK == (status = List_Allocate_Chain(List, Data, Count, &FirstNode, &LastNode))){
+        Node_t *PrevNode = (0U == NodePosition) ? NULL : List_Locate_Node(List, NodePosition);
+
+        status = List_Link_Chain_After(List, PrevNode, FirstNode, LastNode, Count);
+        List_Set_Finger(List, LastNode, NodePosition + Count);  // Ready to continue after the inserted values
+    }
+    else{
+        /* Nothing, status holds the error */
+    }
+    return status;
+}
+
+/*
+   This function List_Insert_Nodes_At_Beginning is the handle-based version of Insert_Nodes_At_Beginning.
+   Afterwards the list starts with Data[0], Data[1], ... Data[Count - 1].
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success (also for Count = 0), NODE_NULL_POINTER if a pointer is NULL,
+                   or NODE_NOK if memory allocation failed (the list is then unchanged).
+*/
+NodeStatus_t List_Insert_Nodes_At_Beginning(List_t *List, const uint32_t *Data, size_t Count){
+    NodeStatus_t status = NODE_NOK;
+    LIST_STATS_ENTER();
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == List)||(NULL == Data)){
+        status = NODE_NULL_POINTER;
+    }
+    else{
+        status = List_Insert_Values(List, 0U, Data, Count);
+    }
+    LIST_STATS_EXIT(LIST_OP_LIST_INSERT_NODES_AT_BEGINNING, status);
+    return status;
+}
+
+/*
+   This function List_Insert_Nodes_At_End is the handle-based version of Insert_Nodes_At_End.
+   The tail is known, so no traversal is needed at all.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success (also for Count = 0), NODE_NULL_POINTER if a pointer is NULL,
+                   or NODE_NOK if memory allocation failed (the list is then unchanged).
+*/
+NodeStatus_t List_Insert_Nodes_At_End(List_t *List, const uint32_t *Data, size_t Count){
+    NodeStatus_t status = NODE_NOK;
+    LIST_STATS_ENTER();
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == List)||(NULL == Data)){
+        status = NODE_NULL_POINTER;
+    }
+    else{
+        status = List_Insert_Values(List, List->ListLength, Data, Count);
+    }
+    LIST_STATS_EXIT(LIST_OP_LIST_INSERT_NODES_AT_END, status);
+    return status;
+}
+
+/*
+   This function List_Insert_Nodes_After is the handle-based version of Insert_Nodes_After.
+   It takes a pointer to the list handle (List), a position (NodePosition), an array of values (Data) and its length (Count).
+
+   Parameters:
+   - List: A pointer to the list handle.
+   - NodePosition: The position after which the values are inserted (the first position = 1).
+   - Data: A pointer to the values, in list order.
+   - Count: The number of values.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success (also for Count = 0), NODE_NULL_POINTER if a pointer is NULL,
+                   or NODE_NOK if the position is out of range or memory allocation failed (the list is then unchanged).
+
+   Algorithm:
+   - As with List_Insert_Node_After, inserting into an empty list stores the values whatever the position.
+   - Otherwise NodePosition is checked against the cached length before anything is allocated.
+*/
+NodeStatus_t List_Insert_Nodes_After(List_t *List, size_t NodePosition, const uint32_t *Data, size_t Count){
+    NodeStatus_t status = NODE_NOK;
+    LIST_STATS_ENTER();
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == List)||(NULL == Data)){
+        status = NODE_NULL_POINTER;
+    }
+    else if(0 == List->ListLength){
+        status = List_Insert_Values(List, 0U, Data, Count);
+    }
+    else if((0 == NodePosition)||(NodePosition > List->ListLength)){
+        status = NODE_NOK;  // Position out of range or zero
+    }
+    else{
+        status = List_Insert_Values(List, NodePosition, Data, Count);
+    }
+    LIST_STATS_EXIT(LIST_OP_LIST_INSERT_NODES_AFTER, status);
+    return status;
+}
+
+/*
+   This function List_Extract_Nodes is the handle-based version of Extract_Nodes.
+
+   Return value:
+   - NodeStatus_t: NODE_OK if the whole list was copied, NODE_NULL_POINTER if a pointer is NULL,
+                   NODE_EMPTY if the list is empty (Count = 0), or NODE_NOK if the list is longer than Capacity
+                   (the first Capacity values are copied).
+*/
+NodeStatus_t List_Extract_Nodes(List_t *List, uint32_t *Data, size_t Capacity, size_t *Count){
+    NodeStatus_t status = NODE_NOK;
+    LIST_STATS_ENTER();
+
+    /* Check for NULL pointers in the input parameters */
+    if(NULL == List){
+        status = NODE_NULL_POINTER;
+    }
+    else{
+        status = Extract_Nodes(List->ListHead, Data, Capacity, Count);
+    }
+    LIST_STATS_EXIT(LIST_OP_LIST_EXTRACT_NODES, status);
+    return status;
+}
+
+/*
+   This function List_Cursor_Check is responsible for the checks shared by all List_Cursor_ functions.
+
+   Parameters:
+   - Cursor: A pointer to the cursor to check.
+
+   Return value:
+   - NodeStatus_t: NODE_OK if the cursor can be used, NODE_NULL_POINTER if Cursor or its list is NULL,
+                   or NODE_NOK if the list was changed behind the cursor (ListVersion moved on).
+*/
+static NodeStatus_t List_Cursor_Check(const ListCursor_t *Cursor){
+    NodeStatus_t status = NODE_NOK;
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == Cursor)||(NULL == Cursor->CursorList)){
+        status = NODE_NULL_POINTER;
+    }
+    else if(Cursor->CursorVersion != Cursor->CursorList->ListVersion){
+        status = NODE_NOK;  // Stale cursor, its nodes may have been freed
+    }
+    else{
+        status = NODE_OK;
+    }
+    return status;
+}
+
+/*
+   This function List_Cursor_Init is responsible for placing a cursor on the first node of a list handle.
+   It is also how a stale cursor is made usable again.
+
+   Parameters:
+   - Cursor: A pointer to the cursor to set up.
+   - List: A pointer to the initialized list handle to walk.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success or NODE_NULL_POINTER if a pointer is NULL.
+
+   Algorithm:
+   - The cursor takes the head as its current node (NULL for an empty list, i.e. already past the end),
+     position 1, and the current ListVersion.
+*/
+NodeStatus_t List_Cursor_Init(ListCursor_t *Cursor, List_t *List){
+    NodeStatus_t status = NODE_NOK;
+    LIST_STATS_ENTER();
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == Cursor)||(NULL == List)){
+        status = NODE_NULL_POINTER;
+    }
+    else{
+        Cursor->CursorList = List;
+        Cursor->CursorPrev = NULL;
+        Cursor->CursorNode = List->ListHead;
+        Cursor->CursorPosition = 1;
+        Cursor->CursorVersion = List->ListVersion;
+        status = NODE_OK;
+    }
+    LIST_STATS_EXIT(LIST_OP_LIST_CURSOR_INIT, status);
+    return status;
+}
+
+/*
+   This function List_Cursor_Is_Valid is responsible for telling whether a cursor is still in sync with its list.
+
+   Parameters:
+   - Cursor: A pointer to the cursor.
+
+   Return value:
+   - NodeStatus_t: NODE_OK if the cursor can be used, NODE_NULL_POINTER if a pointer is NULL,
+                   or NODE_NOK if the list was changed without going through this cursor.
+*/
+NodeStatus_t List_Cursor_Is_Valid(const ListCursor_t *Cursor){
+    return List_Cursor_Check(Cursor);
+}
+
+/*
+   This function List_Cursor_Next is responsible for advancing a cursor by one node.
+
+   Parameters:
+   - Cursor: A pointer to the cursor to move.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if a pointer is NULL,
+                   NODE_EMPTY if the cursor is already past the last node, or NODE_NOK if the cursor is stale.
+
+   Algorithm:
+   - The current node becomes the predecessor and its successor the current node. This is O(1).
+*/
+NodeStatus_t List_Cursor_Next(ListCursor_t *Cursor){
+    NodeStatus_t status = List_Cursor_Check(Cursor);
+    LIST_STATS_ENTER();
+
+    if(NODE_OK != status){
+        /* Nothing to do, status already reports the problem */
+    }
+    else if(NULL == Cursor->CursorNode){
+        status = NODE_EMPTY;  // Past the end, there is no next node
+    }
+    else{
+        Cursor->CursorPrev = Cursor->CursorNode;
+        Cursor->CursorNode = Cursor->CursorNode->NodeLink;
+        LIST_STATS_STEP();
+        Cursor->CursorPosition++;
+    }
+    LIST_STATS_EXIT(LIST_OP_LIST_CURSOR_NEXT, status);
+    return status;
+}
+
+/*
+   This function List_Cursor_Seek is responsible for moving a cursor forward by several nodes.
+
+   Parameters:
+   - Cursor: A pointer to the cursor to move.
+   - Steps: The number of nodes to move forward; moving exactly past the last node is allowed.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if a pointer is NULL,
+                   or NODE_NOK if the cursor is stale or fewer than Steps nodes are left (the cursor does not move then).
+
+   Algorithm:
+   - The range is checked against the cached length first, then the cursor walks Steps links from where it is,
+     never from the head.
+*/
+NodeStatus_t List_Cursor_Seek(ListCursor_t *Cursor, size_t Steps){
+    NodeStatus_t status = List_Cursor_Check(Cursor);
+    LIST_STATS_ENTER();
+
+    if(NODE_OK != status){
+        /* Nothing to do, status already reports the problem */
+    }
+    else if(Steps > ((Cursor->CursorList->ListLength + 1U) - Cursor->CursorPosition)){
+        status = NODE_NOK;  // Would move beyond the end of the list
+    }
+    else{
+        Cursor->CursorPosition += Steps;
+        while (0U != Steps)
+        {
+            Cursor->CursorPrev = Cursor->CursorNode;
+            Cursor->CursorNode = Cursor->CursorNode->NodeLink;
+            LIST_STATS_STEP();
+            Steps--;
+        }
+    }
+    LIST_STATS_EXIT(LIST_OP_LIST_CURSOR_SEEK, status);
+    return status;
+}
+
+/*
+   This function List_Cursor_Peek is responsible for reading the value of the current node without moving the cursor.
+
+   Parameters:
+   - Cursor: A pointer to the cursor.
+   - Data: A pointer to a uint32_t where the value is stored.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if a pointer is NULL,
+                   NODE_EMPTY if the cursor is past the last node, or NODE_NOK if the cursor is stale.
+*/
+NodeStatus_t List_Cursor_Peek(const ListCursor_t *Cursor, uint32_t *Data){
+    NodeStatus_t status = List_Cursor_Check(Cursor);
+    LIST_STATS_ENTER();
+
+    if(NODE_OK != status){
+        /* Nothing to do, status already reports the problem */
+    }
+    else if(NULL == Data){
+        status = NODE_NULL_POINTER;
+    }
+    else if(NULL == Cursor->CursorNode){
+        status = NODE_EMPTY;  // Past the end, there is no current value
+    }
+    else{
+        *Data = Cursor->CursorNode->NodeData;
+    }
+    LIST_STATS_EXIT(LIST_OP_LIST_CURSOR_PEEK, status);
+    return status;
+}
+
+/*
+   This function List_Cursor_Get_Position is responsible for reporting where a cursor is.
+
+   Parameters:
+   - Cursor: A pointer to the cursor.
+   - Position: A pointer to a size_t that receives the 1-based position of the current node
+               (the list length + 1 when the cursor is past the last node).
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if a pointer is NULL, or NODE_NOK if the cursor is stale.
+*/
+NodeStatus_t List_Cursor_Get_Position(const ListCursor_t *Cursor, size_t *Position){
+    NodeStatus_t status = List_Cursor_Check(Cursor);
+    LIST_STATS_ENTER();
+
+    if(NODE_OK != status){
+        /* Nothing to do, status already reports the problem */
+    }
+    else if(NULL == Position){
+        status = NODE_NULL_POINTER;
+    }
+    else{
+        *Position = Cursor->CursorPosition;
+    }
+    LIST_STATS_EXIT(LIST_OP_LIST_CURSOR_GET_POSITION, status);
+    return status;
+}
+
+/*
+   This function List_Cursor_Insert_After is responsible for inserting a new node right after the current node.
+   The cursor stays on the current node, so the next List_Cursor_Next lands on the new node.
+
+   Parameters:
+   - Cursor: A pointer to the cursor.
+   - Data: A void pointer to the uint32_t value to be stored in the new node.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if a pointer is NULL, NODE_EMPTY if the cursor is past
+                   the last node (use List_Cursor_Insert_Before to append), or NODE_NOK if the cursor is stale
+                   or memory allocation failed.
+
+   Algorithm:
+   - The node is allocated like in List_Insert_Node_After and linked with List_Link_Node_After, which is O(1).
+   - The cursor then takes over the new ListVersion, as the change was made through it.
+*/
+NodeStatus_t List_Cursor_Insert_After(ListCursor_t *Cursor, void *Data){
+    NodeStatus_t status = List_Cursor_Check(Cursor);
+    uint32_t *_Data = Data;  // Cast the void pointer Data to uint32_t pointer
+    LIST_STATS_ENTER();
+
+    if(NODE_OK != status){
+        /* Nothing to do, status already reports the problem */
+    }
+    else if(NULL == Data){
+        status = NODE_NULL_POINTER;
+    }
+    else if(NULL == Cursor->CursorNode){
+        status = NODE_EMPTY;  // Past the end, there is no current node to insert after
+    }
+    else{
+        Node_t *NodeList = List_Allocate_Node(Cursor->CursorList);
+
+        if(NULL == NodeList){  // Check if memory allocation failed
+            status = NODE_NOK;
+        }
+        else{
+            NodeList->NodeData = *_Data;  // Assign the data to the NodeData of the new node
+            status = List_Link_Node_After(Cursor->CursorList, Cursor->CursorNode, NodeList);
+            Cursor->CursorVersion = Cursor->CursorList->ListVersion;
+        }
+    }
+    LIST_STATS_EXIT(LIST_OP_LIST_CURSOR_INSERT_AFTER, status);
+    return status;
+}
+
+/*
+   This function List_Cursor_Insert_Before is responsible for inserting a new node right before the current node.
+   The cursor stays on the current node, whose position grows by one.
+
+   Parameters:
+   - Cursor: A pointer to the cursor.
+   - Data: A void pointer to the uint32_t value to be stored in the new node.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if a pointer is NULL,
+                   or NODE_NOK if the cursor is stale or memory allocation failed.
+
+   Algorithm:
+   - The new node is linked after the remembered predecessor (or as the new head), so no walk is needed.
+   - Past the last node this appends to the list, and on an empty list it inserts the first node.
+*/
+NodeStatus_t List_Cursor_Insert_Before(ListCursor_t *Cursor, void *Data){
+    NodeStatus_t status = List_Cursor_Check(Cursor);
+    uint32_t *_Data = Data;  // Cast the void pointer Data to uint32_t pointer
+    LIST_STATS_ENTER();
+
+    if(NODE_OK != status){
+        /* Nothing to do, status already reports the problem */
+    }
+    else if(NULL == Data){
+        status = NODE_NULL_POINTER;
+    }
+    else{
+        Node_t *NodeList = List_Allocate_Node(Cursor->CursorList);
+
+        if(NULL == NodeList){  // Check if memory allocation failed
+            status = NODE_NOK;
+        }
+        else{
+            NodeList->NodeData = *_Data;  // Assign the data to the NodeData of the new node
+            status = List_Link_Node_After(Cursor->CursorList, Cursor->CursorPrev, NodeList);
+            Cursor->CursorPrev = NodeList;
+            Cursor->CursorPosition++;
+            Cursor->CursorVersion = Cursor->CursorList->ListVersion;
+        }
+    }
+    LIST_STATS_EXIT(LIST_OP_LIST_CURSOR_INSERT_BEFORE, status);
+    return status;
+}
+
+/*
+   This function List_Cursor_Erase is responsible for deleting the current node.
+   The cursor moves on to the node that followed it, at the same position.
+
+   Parameters:
+   - Cursor: A pointer to the cursor.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if a pointer is NULL,
+                   NODE_EMPTY if the cursor is past the last node, or NODE_NOK if the cursor is stale.
+
+   Algorithm:
+   - The current node is unlinked after the remembered predecessor with List_Unlink_Node_After and released. This is O(1),
+     so a filter pass that erases some nodes and skips the others over the whole list is a single linear sweep.
+*/
+NodeStatus_t List_Cursor_Erase(ListCursor_t *Cursor){
+    NodeStatus_t status = List_Cursor_Check(Cursor);
+    Node_t *RemovedNode = NULL;
+    LIST_STATS_ENTER();
+
+    if(NODE_OK != status){
+        /* Nothing to do, status already reports the problem */
+    }
+    else if(NULL == Cursor->CursorNode){
+        status = NODE_EMPTY;  // Past the end, there is no current node to erase
+    }
+    else{
+        Cursor->CursorNode = Cursor->CursorNode->NodeLink;  // Step over the node before it is detached
+        LIST_STATS_STEP();
+        status = List_Unlink_Node_After(Cursor->CursorList, Cursor->CursorPrev, &RemovedNode);
+        if(NODE_OK == status){
+            List_Release_Node(Cursor->CursorList, RemovedNode);  // Free the memory allocated for the removed node
+        }
+        Cursor->CursorVersion = Cursor->CursorList->ListVersion;
+    }
+    LIST_STATS_EXIT(LIST_OP_LIST_CURSOR_ERASE, status);
+    return status;
+}
+
+/*
+   This function List_Sort is the handle-based version of Sort_Nodes.
+
+   Parameters:
+   - List: A pointer to the list handle to be sorted by NodeData in ascending order.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if List is NULL, or NODE_EMPTY if the list is empty.
+
+   Algorithm:
+   - Sort_Chain relinks the nodes and returns the new last node for the tail pointer; the length does not change.
+   - The version is incremented, as existing cursors no longer match the node order, and an attached index is rebuilt
+     since most predecessors have changed.
+*/
+NodeStatus_t List_Sort(List_t *List){
+    NodeStatus_t status = NODE_NOK;
+    LIST_STATS_ENTER();
+
+    /* Check for NULL pointers in the input parameters */
+    if(NULL == List){
+        status = NODE_NULL_POINTER;
+    }
+    else if(NULL == List->ListHead){  /* if the linked list is empty */
+        status = NODE_EMPTY;
+    }
+    else{
+        List->ListTail = Sort_Chain(&List->ListHead);
+        List->ListVersion++;
+        List_Rebuild_Index(List);
+        status = NODE_OK;
+    }
+    LIST_STATS_EXIT(LIST_OP_LIST_SORT, status);
+    return status;
+}
+
+/*
+   This function List_Insert_Node_Sorted is the handle-based version of Insert_Node_Sorted.
+
+   Parameters:
+   - List: A pointer to the list handle, already sorted by NodeData.
+   - Data: A void pointer to the uint32_t value to be stored in the new node.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if a pointer is NULL, or NODE_NOK if memory allocation failed.
+
+   Algorithm:
+   - A value smaller than the head goes in front, and a value not smaller than the tail is appended without any walk,
+     so building a list from ascending input is O(1) per value.
+   - Otherwise the list is walked to the last node holding a value <= the new value and the node is linked after it.
+*/
+NodeStatus_t List_Insert_Node_Sorted(List_t *List, void *Data){
+    NodeStatus_t status = NODE_NOK;
+    uint32_t *_Data = Data;  // Cast the void pointer Data to uint32_t pointer
+    LIST_STATS_ENTER();
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == List)||(NULL == Data)){
+        status = NODE_NULL_POINTER;
+    }
+    else{
+        Node_t *NodeList = List_Allocate_Node(List);
+
+        if(NULL == NodeList){  // Check if memory allocation failed
+            status = NODE_NOK;
+        }
+        else{
+            Node_t *PrevNode = NULL;
+
+            if((NULL == List->ListHead)||(*_Data < List->ListHead->NodeData)){
+                PrevNode = NULL;  // New head
+            }
+            else if(List->ListTail->NodeData <= *_Data){
+                PrevNode = List->ListTail;  // New tail, no walk needed
+            }
+            else{
+                PrevNode = List->ListHead;
+                while (PrevNode->NodeLink->NodeData <= *_Data)
+                {
+                    PrevNode = PrevNode->NodeLink;  // The tail holds a larger value, so the walk stops before it
+                    LIST_STATS_STEP();
+                }
+            }
+            NodeList->NodeData = *_Data;  // Assign the data to the NodeData of the new node
+            status = List_Link_Node_After(List, PrevNode, NodeList);
+        }
+    }
+    LIST_STATS_EXIT(LIST_OP_LIST_INSERT_NODE_SORTED, status);
+    return status;
+}
+
+/*
+   This function List_Merge_Sorted is the handle-based version of Merge_Sorted_Nodes.
+
+   Parameters:
+   - List: A pointer to the list handle that receives all nodes, sorted by NodeData.
+   - Other: A pointer to a second sorted list handle; it is left empty.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if a pointer is NULL,
+                   or NODE_NOK if the two lists use different node pools (their nodes could not be released together).
+
+   Algorithm:
+   - One Merge_Runs pass relinks the nodes of both lists; the new tail is one of the two old tails, so it is known without a walk.
+   - Lengths are added, Other is reset to the empty list (its pool stays attached) and both versions are incremented.
+   - An index attached to List is rebuilt, and one attached to Other is emptied.
+*/
+NodeStatus_t List_Merge_Sorted(List_t *List, List_t *Other){
+    NodeStatus_t status = NODE_NOK;
+    LIST_STATS_ENTER();
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == List)||(NULL == Other)){
+        status = NODE_NULL_POINTER;
+    }
+    else if(List == Other){
+        status = NODE_OK;  // Merging a list with itself leaves it as it is
+    }
+    else if(List->ListPool != Other->ListPool){
+        status = NODE_NOK;  // Nodes must come from the same allocator
+    }
+    else{
+        List->ListHead = Merge_Runs(List->ListHead, List->ListTail, Other->ListHead, Other->ListTail, &List->ListTail);
+        List->ListLength += Other->ListLength;
+        List->ListVersion++;
+        Other->ListHead = NULL;
+        Other->ListTail = NULL;
+        Other->ListLength = 0;
+        Other->ListVersion++;
+        List_Rebuild_Index(List);
+        if(NULL != Other->ListIndex){
+            (void)List_Index_Clear(Other->ListIndex);
+        }
+        status = NODE_OK;
+    }
+    LIST_STATS_EXIT(LIST_OP_LIST_MERGE_SORTED, status);
+    return status;
+}
+
+/*
+   This function List_Find_By_Value is the handle-based version of Find_By_Value.
+
+   Parameters:
+   - List: A pointer to the list handle to search.
+   - Data: A void pointer to the uint32_t value to look for.
+   - FoundNode: A double pointer that receives the node holding the value.
+
+   Return value:
+   - NodeStatus_t: NODE_OK if the value was found, NODE_NULL_POINTER if a pointer is NULL,
+                   NODE_EMPTY if the list is empty, or NODE_NOK if no node holds the value.
+
+   Algorithm:
+   - With an index attached (and not stale) the node comes from List_Index_Find, O(1) on average.
+     Among equal values any one of the nodes may be returned then.
+   - Otherwise the list is walked from the head and the first match is returned.
+   - The node is returned rather than its position, as the index does not know positions.
+*/
+NodeStatus_t List_Find_By_Value(List_t *List, void *Data, Node_t **FoundNode){
+    NodeStatus_t status = NODE_NOK;
+    uint32_t *_Data = Data;  // Cast the void pointer Data to uint32_t pointer
+    LIST_STATS_ENTER();
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == List)||(NULL == Data)||(NULL == FoundNode)){
+        status = NODE_NULL_POINTER;
+    }
+    else if(NULL == List->ListHead){  /* if the linked list is empty */
+        status = NODE_EMPTY;
+    }
+    else{
+        status = (NULL != List->ListIndex) ? List_Index_Find(List->ListIndex, *_Data, FoundNode, NULL) : NODE_EMPTY;
+        if(NODE_EMPTY == status){  /* No usable index, walk the list */
+            Node_t *NodeHeadCopy = List->ListHead;
+
+            while ((NULL != NodeHeadCopy) && (NodeHeadCopy->NodeData != *_Data))
+            {
+                NodeHeadCopy = NodeHeadCopy->NodeLink;  // Move to the next node
+                LIST_STATS_STEP();
+            }
+            if(NULL == NodeHeadCopy){
+                status = NODE_NOK;  // Value not in the list
+            }
+            else{
+                *FoundNode = NodeHeadCopy;
+                status = NODE_OK;
+            }
+        }
+    }
+    LIST_STATS_EXIT(LIST_OP_LIST_FIND_BY_VALUE, status);
+    return status;
+}
+
+/*
+   This function List_Delete_By_Value is the handle-based version of Delete_By_Value.
+
+   Parameters:
+   - List: A pointer to the list handle from which the node will be deleted.
+   - Data: A void pointer to the uint32_t value to remove.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if a pointer is NULL,
+                   NODE_EMPTY if the list is empty, or NODE_NOK if no node holds the value.
+
+   Algorithm:
+   - With an index attached (and not stale) the node and its predecessor come from List_Index_Find, so the removal
+     is O(1) on average. Among equal values any one of the nodes may be removed then.
+   - Otherwise one walk keeps the previous node and stops at the first match.
+   - The node is unlinked with List_Unlink_Node_After (which also updates the index) and released.
+*/
+NodeStatus_t List_Delete_By_Value(List_t *List, void *Data){
+    NodeStatus_t status = NODE_NOK;
+    uint32_t *_Data = Data;  // Cast the void pointer Data to uint32_t pointer
+    Node_t *FoundNode = NULL;
+    Node_t *PrevNode = NULL;
+    Node_t *RemovedNode = NULL;
+    LIST_STATS_ENTER();
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == List)||(NULL == Data)){
+        status = NODE_NULL_POINTER;
+    }
+    else if(NULL == List->ListHead){  /* if the linked list is empty */
+        status = NODE_EMPTY;
+    }
+    else{
+        status = (NULL != List->ListIndex) ? List_Index_Find(List->ListIndex, *_Data, &FoundNode, &PrevNode) : NODE_EMPTY;
+        if(NODE_EMPTY == status){  /* No usable index, walk the list */
+            FoundNode = List->ListHead;
+            while ((NULL != FoundNode) && (FoundNode->NodeData != *_Data))
+            {
+                PrevNode = FoundNode;
+                FoundNode = FoundNode->NodeLink;  // Move to the next node
+                LIST_STATS_STEP();
+            }
+            status = (NULL == FoundNode) ? NODE_NOK : NODE_OK;
+        }
+        if(NODE_OK == status){
+            status = List_Unlink_Node_After(List, PrevNode, &RemovedNode);
+            if(NODE_OK == status){
+                List_Release_Node(List, RemovedNode);  // Free the memory allocated for the removed node
+            }
+        }
+    }
+    LIST_STATS_EXIT(LIST_OP_LIST_DELETE_BY_VALUE, status);
+    return status;
+}
+
+/*
+   This function List_Get_Fragmentation is the handle-based version of Get_Fragmentation.
+
+   Parameters:
+   - List: A pointer to the list handle to measure.
+   - Fragmentation: A pointer to the structure that receives the metric.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if a pointer is NULL, or NODE_EMPTY if the list is empty.
+*/
+NodeStatus_t List_Get_Fragmentation(List_t *List, ListFragmentation_t *Fragmentation){
+    NodeStatus_t status = NODE_NOK;
+    LIST_STATS_ENTER();
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == List)||(NULL == Fragmentation)){
+        status = NODE_NULL_POINTER;
+    }
+    else{
+        status = Get_Fragmentation(List->ListHead, Fragmentation);
+    }
+    LIST_STATS_EXIT(LIST_OP_LIST_GET_FRAGMENTATION, status);
+    return status;
+}
+
+/*
+   This function List_Move_Nodes is responsible for moving the next nodes of a compaction into one contiguous pool run.
+   It is shared by List_Compact and List_Compact_Step; the list must have a pool attached.
+
+   Parameters:
+   - List: A pointer to the list handle being compacted.
+   - State: A pointer to the compaction progress, updated on return.
+   - MaxNodes: The largest number of nodes moved by this call.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success (also when nothing was left to move) or NODE_NOK if the run could not be allocated.
+
+   Algorithm:
+   - If the list changed since the last call, the end of the compacted prefix is found again by position
+     (clamped to the length). The walk only crosses nodes that were already compacted, so it is cheap.
+   - min(MaxNodes, remaining) nodes are taken at once with NodePool_Alloc_Run, so they are adjacent in memory.
+   - Each old node is replaced by the next run node: its value is copied, the old node is unlinked and released,
+     and the new one is linked in its place. Going through List_Unlink_Node_After and List_Link_Node_After keeps
+     tail, length, version and an attached index right.
+*/
+static NodeStatus_t List_Move_Nodes(List_t *List, ListCompactState_t *State, size_t MaxNodes){
+    NodeStatus_t status = NODE_OK;
+    Node_t *RunNode = NULL;
+    Node_t *RunLast = NULL;
+    Node_t *OldNode = NULL;
+    size_t Remaining = 0;
+
+    if(State->CompactVersion != List->ListVersion){  /* The list changed since the last step */
+        if(State->CompactPosition > List->ListLength){
+            State->CompactPosition = List->ListLength;
+        }
+        State->CompactPrev = (0U == State->CompactPosition) ? NULL : List_Locate_Node(List, State->CompactPosition);
+    }
+    Remaining = List->ListLength - State->CompactPosition;
+    if(Remaining > MaxNodes){
+        Remaining = MaxNodes;
+    }
+    if(Remaining > 0U){
+        status = NodePool_Alloc_Run(List->ListPool, Remaining, &RunNode, &RunLast);
+        LIST_STATS_ALLOC_CHAIN(status, Remaining);
+    }
+    while ((NODE_OK == status) && (NULL != RunNode))
+    {
+        Node_t *NextRunNode = RunNode->NodeLink;  // Keep the rest of the run before RunNode is linked
+
+        (void)List_Unlink_Node_After(List, State->CompactPrev, &OldNode);  // There is a node after CompactPrev, it cannot fail
+        RunNode->NodeData = OldNode->NodeData;
+        (void)List_Link_Node_After(List, State->CompactPrev, RunNode);
+        List_Release_Node(List, OldNode);
+        State->CompactPrev = RunNode;
+        State->CompactPosition++;
+        RunNode = NextRunNode;
+        LIST_STATS_STEP();
+    }
+    State->CompactVersion = List->ListVersion;
+    return status;
+}
+
+/*
+   This function List_Compact is responsible for restoring traversal locality of a list handle after churn.
+   Long runs of inserts and deletes leave consecutive nodes far apart in memory, and every step of a walk then misses
+   the cache; after compaction a walk reads memory forward, mostly one cache line after another.
+
+   Parameters:
+   - List: A pointer to the list handle to compact.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if List is NULL, NODE_EMPTY if the list is empty,
+                   or NODE_NOK if memory could not be allocated (the list is unchanged).
+
+   Algorithm:
+   - With a pool attached, all nodes are moved in traversal order into one contiguous run (see List_Move_Nodes),
+     then NodePool_Trim gives the slabs that became empty back to the heap. The peak memory is twice the list.
+   - Without a pool, malloc gives no control over addresses, so Relinearize_Chain relinks the existing nodes in address
+     order instead and moves the values along. The version is incremented and an attached index is rebuilt.
+   - Either way the values stay in the same order but no longer live in the same nodes: node pointers obtained earlier
+     are invalid and cursors become stale.
+*/
+NodeStatus_t List_Compact(List_t *List){
+    NodeStatus_t status = NODE_NOK;
+    ListCompactState_t State = {0};
+    LIST_STATS_ENTER();
+
+    /* Check for NULL pointers in the input parameters */
+    if(NULL == List){
+        status = NODE_NULL_POINTER;
+    }
+    else if(NULL == List->ListHead){  /* if the linked list is empty */
+        status = NODE_EMPTY;
+    }
+    else if(NULL != List->ListPool){
+        State.CompactList = List;
+        State.CompactVersion = List->ListVersion;
+        status = List_Move_Nodes(List, &State, List->ListLength);
+        if(NODE_OK == status){
+            (void)NodePool_Trim(List->ListPool, NULL);
+        }
+    }
+    else{
+        status = Relinearize_Chain(&List->ListHead, List->ListLength, &List->ListTail);
+        if(NODE_OK == status){
+            List->ListVersion++;
+            List_Rebuild_Index(List);
+        }
+    }
+    LIST_STATS_EXIT(LIST_OP_LIST_COMPACT, status);
+    return status;
+}
+
+/*
+   This function List_Compact_Begin is responsible for starting an incremental compaction of a list handle.
+   The work is then done in bounded slices by List_Compact_Step, between other operations on the list,
+   so a long list can be compacted without one long pause.
+
+   Parameters:
+   - List: A pointer to the list handle to compact. It must have a pool attached.
+   - State: A pointer to the progress structure to initialize.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if a pointer is NULL,
+                   or NODE_NOK if no pool is attached (the incremental mode moves nodes into pool memory).
+*/
+NodeStatus_t List_Compact_Begin(List_t *List, ListCompactState_t *State){
+    NodeStatus_t status = NODE_NOK;
+    LIST_STATS_ENTER();
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == List)||(NULL == State)){
+        status = NODE_NULL_POINTER;
+    }
+    else if(NULL == List->ListPool){
+        status = NODE_NOK;
+    }
+    else{
+        State->CompactList = List;
+        State->CompactPrev = NULL;
+        State->CompactPosition = 0;
+        State->CompactVersion = List->ListVersion;
+        status = NODE_OK;
+    }
+    LIST_STATS_EXIT(LIST_OP_LIST_COMPACT_BEGIN, status);
+    return status;
+}
+
+/*
+   This function List_Compact_Step is responsible for moving the next slice of an incremental compaction.
+
+   Parameters:
+   - List: A pointer to the list handle given to List_Compact_Begin.
+   - State: A pointer to the progress structure.
+   - MaxNodes: The largest number of nodes moved by this call (at least 1); it bounds the time of one step.
+   - Done: A pointer that receives 1 once the whole list is compacted, 0 otherwise.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if a pointer is NULL,
+                   or NODE_NOK if State belongs to another list, no pool is attached, MaxNodes is 0 or memory ran out.
+
+   Algorithm:
+   - List_Move_Nodes moves up to MaxNodes nodes after the compacted prefix into a contiguous run.
+   - The list may be changed freely between steps. Nodes inserted into the compacted prefix afterwards are not moved,
+     and every moved node invalidates node pointers and cursors like List_Compact does.
+   - When the prefix covers the whole list, *Done is set and the emptied slabs are given back with NodePool_Trim.
+   - The list handle is not thread-safe, so the steps must run on the thread that owns the list, e.g. once per
+     iteration of its main loop; there is no background thread.
+*/
+NodeStatus_t List_Compact_Step(List_t *List, ListCompactState_t *State, size_t MaxNodes, boolean *Done){
+    NodeStatus_t status = NODE_NOK;
+    LIST_STATS_ENTER();
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == List)||(NULL == State)||(NULL == Done)){
+        status = NODE_NULL_POINTER;
+    }
+    else if((State->CompactList != List)||(NULL == List->ListPool)||(0U == MaxNodes)){
+        status = NODE_NOK;
+    }
+    else{
+        status = List_Move_Nodes(List, State, MaxNodes);
+        *Done = (State->CompactPosition == List->ListLength) ? 1U : 0U;
+        if((NODE_OK == status) && (1U == *Done)){
+            (void)NodePool_Trim(List->ListPool, NULL);
+        }
+    }
+    LIST_STATS_EXIT(LIST_OP_LIST_COMPACT_STEP, status);
+    return status;
+}
+
+/*
+   This function List_Move_Range is responsible for relinking a run of consecutive nodes from one list handle into another.
+   It is shared by List_Concat, List_Split and List_Splice; From and To may be the same list.
+
+   Parameters:
+   - From: A pointer to the list handle the nodes are taken from.
+   - FromPrev: The node before the run in From, or NULL when the run starts at the head.
+   - LastNode: The last node of the run.
+   - NodeCount: The number of nodes in the run; it is trusted, not counted.
+   - To: A pointer to the list handle that receives the run.
+   - ToPrev: The node of To after which the run is linked, or NULL to link it in front of the head.
+             It must not be a node of the run.
+
+   Algorithm:
+   - The run is cut out of From and linked into To by changing four links; tails, lengths and versions of both
+     handles are adjusted. Nothing is allocated or freed, so the cost is O(1).
+   - Only when an index is attached the moved nodes are removed from the index of From and added to the index of To,
+     which costs O(NodeCount), and the nodes now following the cut and the run get their new predecessors.
+*/
+static void List_Move_Range(List_t *From, Node_t *FromPrev, Node_t *LastNode, size_t NodeCount, List_t *To, Node_t *ToPrev){
+    Node_t *FirstNode = (NULL == FromPrev) ? From->ListHead : FromPrev->NodeLink;
+    Node_t *AfterNode = LastNode->NodeLink;
+
+    /* Cut the run out of From */
+    if(NULL == FromPrev){
+        From->ListHead = AfterNode;
+    }
+    else{
+        FromPrev->NodeLink = AfterNode;  // Bypass the run
+    }
+    if(From->ListTail == LastNode){
+        From->ListTail = FromPrev;  // The run was at the end (NULL if From is now empty)
+    }
+    From->ListLength -= NodeCount;
+    From->ListVersion++;
+
+    /* Link the run into To */
+    if(NULL == ToPrev){
+        LastNode->NodeLink = To->ListHead;
+        To->ListHead = FirstNode;
+    }
+    else{
+        LastNode->NodeLink = ToPrev->NodeLink;  // Connect the right side connection
+        ToPrev->NodeLink = FirstNode;           // Connect the left side connection
+    }
+    if(NULL == LastNode->NodeLink){
+        To->ListTail = LastNode;  // The run ends To
+    }
+    To->ListLength += NodeCount;
+    To->ListVersion++;
+
+    if((NULL != From->ListIndex) || (NULL != To->ListIndex)){
+        Node_t *PrevNode = ToPrev;
+        Node_t *NodeCopy = FirstNode;
+        size_t counter = 0;
+
+        if((NULL != From->ListIndex) && (NULL != AfterNode)){
+            (void)List_Index_Set_Prev(From->ListIndex, AfterNode, FromPrev);  // The node after the cut moves up
+        }
+        for(counter = 0; counter < NodeCount; counter++){
+            if(NULL != From->ListIndex){
+                (void)List_Index_Remove(From->ListIndex, NodeCopy);
+            }
+            if(NULL != To->ListIndex){
+                (void)List_Index_Add(To->ListIndex, NodeCopy, PrevNode);
+            }
+            PrevNode = NodeCopy;
+            NodeCopy = NodeCopy->NodeLink;
+            LIST_STATS_STEP();
+        }
+        if((NULL != To->ListIndex) && (NULL != LastNode->NodeLink)){
+            (void)List_Index_Set_Prev(To->ListIndex, LastNode->NodeLink, LastNode);  // The node after the run
+        }
+    }
+}
+
+/*
+   This function List_Concat is the handle-based version of Concat_Nodes.
+
+   Parameters:
+   - List: A pointer to the list handle that receives the nodes at its end.
+   - Other: A pointer to a second list handle; it is left empty.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if a pointer is NULL, or NODE_NOK if both are the same list
+                   or the two lists use different node pools (their nodes could not be released together).
+
+   Algorithm:
+   - The tail of List is linked to the head of Other with List_Move_Range; both tails are known, so no node is visited
+     and the cost is O(1) without an index. Other keeps its pool and index (emptied) and can be reused.
+*/
+NodeStatus_t List_Concat(List_t *List, List_t *Other){
+    NodeStatus_t status = NODE_NOK;
+    LIST_STATS_ENTER();
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == List)||(NULL == Other)){
+        status = NODE_NULL_POINTER;
+    }
+    else if((List == Other)||(List->ListPool != Other->ListPool)){
+        status = NODE_NOK;  // Nodes must come from the same allocator, and a list cannot be appended to itself
+    }
+    else{
+        if(NULL != Other->ListHead){
+            List_Move_Range(Other, NULL, Other->ListTail, Other->ListLength, List, List->ListTail);
+        }
+        status = NODE_OK;
+    }
+    LIST_STATS_EXIT(LIST_OP_LIST_CONCAT, status);
+    return status;
+}
+
+/*
+   This function List_Split is the handle-based version of Split_Nodes.
+
+   Parameters:
+   - List: A pointer to the list handle to cut; it keeps its first NodePosition nodes.
+   - NodePosition: The number of nodes that stay in List (0 to ListLength); 0 moves every node.
+   - Other: A pointer to an empty list handle that receives the nodes after NodePosition.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if a pointer is NULL, or NODE_NOK if Other is not empty,
+                   is List itself, uses a different node pool, or NodePosition is beyond the last node.
+
+   Algorithm:
+   - The node at NodePosition is found with one walk (none for position 0 or the last position); the rest of the list,
+     whose length and last node are known from the handle, is moved to Other with List_Move_Range.
+*/
+NodeStatus_t List_Split(List_t *List, size_t NodePosition, List_t *Other){
+    NodeStatus_t status = NODE_NOK;
+    LIST_STATS_ENTER();
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == List)||(NULL == Other)){
+        status = NODE_NULL_POINTER;
+    }
+    else if((List == Other)||(NULL != Other->ListHead)||(List->ListPool != Other->ListPool)){
+        status = NODE_NOK;  // The second part needs an empty list with the same allocator
+    }
+    else if(NodePosition > List->ListLength){
+        status = NODE_NOK;
+    }
+    else{
+        if(NodePosition < List->ListLength){
+            Node_t *PrevNode = (0U == NodePosition) ? NULL : List_Locate_Node(List, NodePosition);
+
+            List_Move_Range(List, PrevNode, List->ListTail, List->ListLength - NodePosition, Other, NULL);
+        }
+        status = NODE_OK;
+    }
+    LIST_STATS_EXIT(LIST_OP_LIST_SPLIT, status);
+    return status;
+}
+
+/*
+   This function List_Splice is responsible for moving a range of nodes from one list handle into another by relinking.
+
+   Parameters:
+   - List: A pointer to the list handle that receives the nodes.
+   - NodePosition: The position of List after which the range is linked; 0 links it in front of the head.
+   - Other: A pointer to the list handle the range is taken from. It may be List itself, to move a range within a list.
+   - FirstPosition / LastPosition: The 1-based positions in Other of the first and last node of the range.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if a pointer is NULL,
+                   or NODE_NOK if a position is out of range, the lists use different node pools,
+                   or (within one list) the node at NodePosition belongs to the range.
+
+   Algorithm:
+   - Positions refer to the lists as they are before the move.
+   - One walk in Other reaches the node before the range and continues to its last node (the tail is used when
+     the range ends Other), and one walk in List reaches NodePosition. The range is then relinked with
+     List_Move_Range in O(1), whatever its length; nothing is allocated or freed.
+*/
+NodeStatus_t List_Splice(List_t *List, size_t NodePosition, List_t *Other, size_t FirstPosition, size_t LastPosition){
+    NodeStatus_t status = NODE_NOK;
+    LIST_STATS_ENTER();
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == List)||(NULL == Other)){
+        status = NODE_NULL_POINTER;
+    }
+    else if((List->ListPool != Other->ListPool)||(NodePosition > List->ListLength)||(0U == FirstPosition)||
+            (FirstPosition > LastPosition)||(LastPosition > Other->ListLength)){
+        status = NODE_NOK;
+    }
+    else if((List == Other)&&(NodePosition >= FirstPosition)&&(NodePosition <= LastPosition)){
+        status = NODE_NOK;  // The range cannot be linked after one of its own nodes
+    }
+    else{
+        Node_t *FromPrev = (1U == FirstPosition) ? NULL : List_Locate_Node(Other, FirstPosition - 1U);
+        Node_t *ToPrev = (0U == NodePosition) ? NULL : List_Locate_Node(List, NodePosition);
+        Node_t *LastNode = NULL;
+        size_t counter = FirstPosition;
+
+        if(LastPosition == Other->ListLength){
+            LastNode = Other->ListTail;  // The range ends Other
+        }
+        else{
+            LastNode = (NULL == FromPrev) ? Other->ListHead : FromPrev->NodeLink;
+            while (counter < LastPosition)
+            {
+                LastNode = LastNode->NodeLink;  // Move to the next node
+                LIST_STATS_STEP();
+                counter++;
+            }
+        }
+        List_Move_Range(Other, FromPrev, LastNode, (LastPosition - FirstPosition) + 1U, List, ToPrev);
+        status = NODE_OK;
+    }
+    LIST_STATS_EXIT(LIST_OP_LIST_SPLICE, status);
     return status;
 }
\ No newline at end of file
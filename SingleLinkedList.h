@@ -14,6 +14,8 @@
 
 /* Section : Macro Declarations */
 
+#define NODE_LENGTH_MAX_U16 (0xFFFFU)  /* Largest length Get_Length can report, longer lists need Get_Length_Wide */
+#define NODE_FRAG_NEAR_BYTES (64U)     /* A link counts as near when the next node is at most this far ahead (one cache line) */
 
 /* Section : Macro Functions Declarations */
 
@@ -56,6 +58,110 @@ typedef struct Node{
     struct Node *NodeLink;  /* pointer to next node */
 }Node_t; /* end structure Node */
 
+/* 
+   This typedef struct represents a handle to a whole linked list.
+   It contains nine members:
+   - ListHead: a pointer to the first node of the linked list.
+   - ListTail: a pointer to the last node of the linked list.
+   - ListLength: the number of nodes currently linked in the list.
+   - ListPool: the node pool the list allocates from, or NULL to use malloc/free.
+   - ListVersion: a counter of structural changes, used to detect stale cursors.
+   - ListIndex: the hash index from values to nodes, or NULL for none.
+   - ListFinger / ListFingerPosition / ListFingerVersion: the last node reached by position, its position,
+     and the ListVersion it is valid for.
+   List_t is an alias for the struct List.
+
+   Explanation of members:
+   - ListHead: Holds a pointer to the first node, or NULL when the list is empty.
+   - ListTail: Holds a pointer to the last node, or NULL when the list is empty. Keeping it lets
+               List_Insert_Node_At_End append without walking the whole chain.
+   - ListLength: Holds the node count so List_Get_Length and the position range checks are O(1).
+   - ListPool: Set with List_Use_Pool (see NodePool.h). Several lists may share one pool.
+   - ListVersion: Incremented every time a node is linked into or unlinked from the chain (and by List_Clear and
+                  Parallel_For_Each, which change values in place).
+                  A ListCursor_t remembers the value it last saw, so a change made behind its back is detected.
+   - ListIndex: Set with List_Use_Index (see ListIndex.h). While attached it is updated by every link and unlink,
+                so List_Find_By_Value and List_Delete_By_Value do not walk the list.
+   - ListFinger / ListFingerPosition / ListFingerVersion: The finger, a cache of the last positional access.
+                  A walk to a position at or beyond ListFingerPosition starts from ListFinger instead of the head,
+                  so accesses at the same or increasing nearby positions cost O(distance) instead of O(position).
+                  The finger is only used while ListFingerVersion equals ListVersion, so any structural change
+                  not made through the positional functions (which move the finger along) simply drops it.
+
+   A List_t must be initialized with List_Init before use and must only be modified through the List_ functions,
+   otherwise ListTail and ListLength stop matching the chain.
+*/
+typedef struct List{
+    Node_t *ListHead;   /* pointer to the first node */
+    Node_t *ListTail;   /* pointer to the last node */
+    size_t ListLength;  /* number of nodes in the list */
+    struct NodePool *ListPool;  /* node pool, NULL for malloc/free */
+    size_t ListVersion; /* structural change counter */
+    struct ListIndex *ListIndex;  /* value index, NULL for none */
+    Node_t *ListFinger;           /* last node reached by position, NULL for none */
+    size_t ListFingerPosition;    /* position of ListFinger */
+    size_t ListFingerVersion;     /* ListVersion ListFinger is valid for */
+}List_t; /* end structure List */
+
+/* 
+   This typedef struct represents a cursor: a position inside a list handle that can move, read and edit the list
+   without walking from the head again.
+   It contains five members:
+   - CursorList: the list handle the cursor belongs to.
+   - CursorPrev: the node before the current node, or NULL when the current node is the head.
+   - CursorNode: the current node, or NULL when the cursor is past the last node.
+   - CursorPosition: the 1-based position of the current node (ListLength + 1 past the last node).
+   - CursorVersion: the ListVersion the cursor is in sync with.
+   ListCursor_t is an alias for the struct ListCursor.
+
+   Keeping the predecessor is what makes inserting before and erasing the current node O(1) on a singly linked list.
+   Edits made through the cursor keep it valid. Any other change to the list (another cursor or a List_ function)
+   makes it stale, and every List_Cursor_ function then returns NODE_NOK until the cursor is set up again with List_Cursor_Init.
+*/
+typedef struct ListCursor{
+    List_t *CursorList;     /* list handle the cursor walks */
+    Node_t *CursorPrev;     /* node before the current node, NULL at the head */
+    Node_t *CursorNode;     /* current node, NULL past the end */
+    size_t CursorPosition;  /* 1-based position of CursorNode */
+    size_t CursorVersion;   /* ListVersion the cursor is in sync with */
+}ListCursor_t; /* end structure ListCursor */
+
+/* 
+   This typedef struct holds the fragmentation metric of a list, filled by Get_Fragmentation.
+   It describes how far apart in memory consecutive nodes are, which decides how well a traversal uses the cache
+   and the hardware prefetcher.
+
+   Explanation of members:
+   - FragLinks: Number of links measured (length - 1).
+   - FragMeanDistance: Average absolute address distance in bytes between a node and its successor.
+                       A freshly compacted list gives sizeof(Node_t); a list churned through malloc gives kilobytes or more.
+   - FragNearLinks: Number of links whose successor lies after the node and at most NODE_FRAG_NEAR_BYTES ahead.
+*/
+typedef struct{
+    size_t FragLinks;          /* links measured */
+    double FragMeanDistance;   /* mean |address(next) - address(node)| in bytes */
+    size_t FragNearLinks;      /* links to a node at most NODE_FRAG_NEAR_BYTES ahead */
+}ListFragmentation_t;
+
+/* 
+   This typedef struct holds the progress of an incremental compaction started with List_Compact_Begin.
+   It contains four members:
+   - CompactList: the list handle being compacted.
+   - CompactPrev: the last node already moved, or NULL when none has been moved yet.
+   - CompactPosition: the number of nodes already moved (the compacted prefix of the list).
+   - CompactVersion: the ListVersion seen at the end of the last step.
+   ListCompactState_t is an alias for the struct ListCompactState.
+
+   When the list was changed between two steps, CompactPrev may be gone, so List_Compact_Step finds the node at
+   CompactPosition again before it continues.
+*/
+typedef struct ListCompactState{
+    List_t *CompactList;     /* list handle being compacted */
+    Node_t *CompactPrev;     /* last node moved, NULL before the first step */
+    size_t CompactPosition;  /* nodes moved so far */
+    size_t CompactVersion;   /* ListVersion after the last step */
+}ListCompactState_t; /* end structure ListCompactState */
+
 
 /* Section : Functions Declaration */
 
@@ -67,4 +173,70 @@ NodeStatus_t Delete_Node(Node_t **NodeHead, uint16_t NodePosition);
 NodeStatus_t Display_All_Nodes(Node_t *List);
 NodeStatus_t Get_Length(Node_t **NodeHead, uint16_t *Length);
 
+NodeStatus_t Insert_Node_After_Wide(Node_t **NodeHead, size_t NodePosition, void *Data);
+NodeStatus_t Delete_Node_Wide(Node_t **NodeHead, size_t NodePosition);
+NodeStatus_t Get_Length_Wide(Node_t **NodeHead, size_t *Length);
+
+NodeStatus_t Insert_Nodes_At_Beginning(Node_t **NodeHead, const uint32_t *Data, size_t Count);
+NodeStatus_t Insert_Nodes_At_End(Node_t **NodeHead, const uint32_t *Data, size_t Count);
+NodeStatus_t Insert_Nodes_After(Node_t **NodeHead, size_t NodePosition, const uint32_t *Data, size_t Count);
+NodeStatus_t Extract_Nodes(Node_t *NodeHead, uint32_t *Data, size_t Capacity, size_t *Count);
+
+NodeStatus_t Sort_Nodes(Node_t **NodeHead);
+NodeStatus_t Insert_Node_Sorted(Node_t **NodeHead, void *Data);
+NodeStatus_t Merge_Sorted_Nodes(Node_t **NodeHead, Node_t **OtherHead);
+NodeStatus_t Find_By_Value(Node_t *NodeHead, void *Data, size_t *NodePosition);
+NodeStatus_t Delete_By_Value(Node_t **NodeHead, void *Data);
+NodeStatus_t Get_Fragmentation(Node_t *NodeHead, ListFragmentation_t *Fragmentation);
+NodeStatus_t Relinearize_Nodes(Node_t **NodeHead);
+NodeStatus_t Concat_Nodes(Node_t **NodeHead, Node_t **OtherHead);
+NodeStatus_t Split_Nodes(Node_t **NodeHead, size_t NodePosition, Node_t **OtherHead);
+
+NodeStatus_t List_Init(List_t *List);
+NodeStatus_t List_Insert_Node_At_Beginning(List_t *List, void *Data);
+NodeStatus_t List_Insert_Node_At_End(List_t *List, void *Data);
+NodeStatus_t List_Insert_Node_After(List_t *List, size_t NodePosition, void *Data);
+NodeStatus_t List_Delete_Node_At_Beginning(List_t *List);
+NodeStatus_t List_Delete_Node(List_t *List, size_t NodePosition);
+NodeStatus_t List_Display_All_Nodes(List_t *List);
+NodeStatus_t List_Get_Length(List_t *List, size_t *Length);
+NodeStatus_t List_Clear(List_t *List);
+NodeStatus_t List_Use_Pool(List_t *List, struct NodePool *Pool);
+
+NodeStatus_t List_Insert_Nodes_At_Beginning(List_t *List, const uint32_t *Data, size_t Count);
+NodeStatus_t List_Insert_Nodes_At_End(List_t *List, const uint32_t *Data, size_t Count);
+NodeStatus_t List_Insert_Nodes_After(List_t *List, size_t NodePosition, const uint32_t *Data, size_t Count);
+NodeStatus_t List_Extract_Nodes(List_t *List, uint32_t *Data, size_t Capacity, size_t *Count);
+
+NodeStatus_t List_Sort(List_t *List);
+NodeStatus_t List_Insert_Node_Sorted(List_t *List, void *Data);
+NodeStatus_t List_Merge_Sorted(List_t *List, List_t *Other);
+
+NodeStatus_t List_Use_Index(List_t *List, struct ListIndex *Index);
+NodeStatus_t List_Find_By_Value(List_t *List, void *Data, Node_t **FoundNode);
+NodeStatus_t List_Delete_By_Value(List_t *List, void *Data);
+
+NodeStatus_t List_Link_Node_After(List_t *List, Node_t *PrevNode, Node_t *NewNode);
+NodeStatus_t List_Unlink_Node_After(List_t *List, Node_t *PrevNode, Node_t **RemovedNode);
+NodeStatus_t List_Link_Chain_After(List_t *List, Node_t *PrevNode, Node_t *FirstNode, Node_t *LastNode, size_t NodeCount);
+
+NodeStatus_t List_Cursor_Init(ListCursor_t *Cursor, List_t *List);
+NodeStatus_t List_Cursor_Is_Valid(const ListCursor_t *Cursor);
+NodeStatus_t List_Cursor_Next(ListCursor_t *Cursor);
+NodeStatus_t List_Cursor_Seek(ListCursor_t *Cursor, size_t Steps);
+NodeStatus_t List_Cursor_Peek(const ListCursor_t *Cursor, uint32_t *Data);
+NodeStatus_t List_Cursor_Get_Position(const ListCursor_t *Cursor, size_t *Position);
+NodeStatus_t List_Cursor_Insert_After(ListCursor_t *Cursor, void *Data);
+NodeStatus_t List_Cursor_Insert_Before(ListCursor_t *Cursor, void *Data);
+NodeStatus_t List_Cursor_Erase(ListCursor_t *Cursor);
+
+NodeStatus_t List_Get_Fragmentation(List_t *List, ListFragmentation_t *Fragmentation);
+NodeStatus_t List_Compact(List_t *List);
+NodeStatus_t List_Compact_Begin(List_t *List, ListCompactState_t *State);
+NodeStatus_t List_Compact_Step(List_t *List, ListCompactState_t *State, size_t MaxNodes, boolean *Done);
+
+NodeStatus_t List_Concat(List_t *List, List_t *Other);
+NodeStatus_t List_Split(List_t *List, size_t NodePosition, List_t *Other);
+NodeStatus_t List_Splice(List_t *List, size_t NodePosition, List_t *Other, size_t FirstPosition, size_t LastPosition);
+
 #endif  //_SINGLELINKEDLIST_H
\ No newline at end of file
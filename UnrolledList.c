@@ -0,0 +1,489 @@
+/* 
+ * File:   UnrolledList.c
+ * Author: Mohammed Khairallah
+ * linkedin : linkedin.com/in/mohammed-khairallah
+ * Created on October 18, 2026, 11:00 AM
+ */
+#include <string.h>
+#include "UnrolledList.h"
+
+/*
+   This function Unrolled_Allocate_Node is responsible for allocating one empty unrolled node.
+   The node is aligned to UNROLLED_NODE_BYTES so it occupies exactly one cache line.
+
+   Return value:
+   - UnrolledNode_t *: A pointer to the new node (NodeCount = 0, NodeLink = NULL), or NULL if the allocation failed.
+*/
+static UnrolledNode_t *Unrolled_Allocate_Node(void){
+    UnrolledNode_t *NewNode = NULL;
+
+#if defined(_WIN32)
+    NewNode = (UnrolledNode_t *)_aligned_malloc(sizeof(UnrolledNode_t), UNROLLED_NODE_BYTES);
+#else
+    NewNode = (UnrolledNode_t *)aligned_alloc(UNROLLED_NODE_BYTES, sizeof(UnrolledNode_t));
+#endif
+    if(NULL != NewNode){
+        NewNode->NodeLink = NULL;
+        NewNode->NodeCount = 0;
+    }
+    return NewNode;
+}
+
+/*
+   This function Unrolled_Release_Node is responsible for freeing one unrolled node allocated by Unrolled_Allocate_Node.
+*/
+static void Unrolled_Release_Node(UnrolledNode_t *Node){
+#if defined(_WIN32)
+    _aligned_free(Node);
+#else
+    free(Node);
+#endif
+}
+
+/*
+   This function Unrolled_Locate is responsible for finding the node that stores the value at a 0-based index.
+   The caller must have already checked that Index < ListLength.
+
+   Parameters:
+   - List: A pointer to the unrolled list handle.
+   - Index: The 0-based index of the requested value.
+   - Offset: A pointer that receives the position of the value inside the returned node.
+   - PrevNode: A double pointer that receives the node before the returned one (NULL for the head), or NULL if not needed.
+
+   Return value:
+   - UnrolledNode_t *: A pointer to the node holding the value.
+
+   Algorithm:
+   - The walk skips whole nodes by subtracting their NodeCount, so it follows one link per node instead of one per value.
+   - An index inside the last node is answered from the tail pointer without walking (the predecessor is then not known
+     and PrevNode must be NULL).
+*/
+static UnrolledNode_t *Unrolled_Locate(UnrolledList_t *List, size_t Index, size_t *Offset, UnrolledNode_t **PrevNode){
+    UnrolledNode_t *NodeCopy = List->ListHead;
+    UnrolledNode_t *l_Prev = NULL;
+    size_t Remaining = Index;
+
+    if((NULL == PrevNode) && (Index >= (List->ListLength - List->ListTail->NodeCount))){
+        NodeCopy = List->ListTail;  // The value lives in the last node
+        Remaining = Index - (List->ListLength - List->ListTail->NodeCount);
+    }
+    else{
+        while (Remaining >= NodeCopy->NodeCount)
+        {
+            Remaining -= NodeCopy->NodeCount;
+            l_Prev = NodeCopy;
+            NodeCopy = NodeCopy->NodeLink;  // Move to the next node
+        }
+        if(NULL != PrevNode){
+            *PrevNode = l_Prev;
+        }
+    }
+    *Offset = Remaining;
+    return NodeCopy;
+}
+
+/*
+   This function Unrolled_Insert_In_Node is responsible for storing a value at a given offset inside a node.
+   If the node is already full it is split first: the upper half of its values moves to a new node linked right after it.
+
+   Parameters:
+   - List: A pointer to the unrolled list handle.
+   - Node: A pointer to the node that receives the value.
+   - Offset: The position inside Node where the value is inserted (0 to NodeCount).
+   - Value: The value to store.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success or NODE_NOK if the node had to be split and the allocation failed.
+*/
+static NodeStatus_t Unrolled_Insert_In_Node(UnrolledList_t *List, UnrolledNode_t *Node, size_t Offset, uint32_t Value){
+    NodeStatus_t status = NODE_OK;
+    UnrolledNode_t *Target = Node;
+    size_t TargetOffset = Offset;
+
+    if(UNROLLED_NODE_CAPACITY == Node->NodeCount){  /* Node is full, split it in two halves */
+        UnrolledNode_t *NewNode = Unrolled_Allocate_Node();
+        size_t KeepCount = UNROLLED_NODE_CAPACITY / 2U;
+
+        if(NULL == NewNode){  // Check if memory allocation failed
+            status = NODE_NOK;
+        }
+        else{
+            NewNode->NodeCount = (uint32_t)(Node->NodeCount - KeepCount);
+            memcpy(NewNode->NodeData, &Node->NodeData[KeepCount], NewNode->NodeCount * sizeof(uint32_t));
+            Node->NodeCount = (uint32_t)KeepCount;
+
+            NewNode->NodeLink = Node->NodeLink;  // Connect the right side connection
+            Node->NodeLink = NewNode;            // Connect the left side connection
+            if(List->ListTail == Node){
+                List->ListTail = NewNode;
+            }
+            List->ListNodeCount++;
+
+            if(Offset > KeepCount){  /* The insertion point moved to the new node */
+                Target = NewNode;
+                TargetOffset = Offset - KeepCount;
+            }
+        }
+    }
+    if(NODE_OK == status){
+        memmove(&Target->NodeData[TargetOffset + 1U], &Target->NodeData[TargetOffset],
+                (Target->NodeCount - TargetOffset) * sizeof(uint32_t));
+        Target->NodeData[TargetOffset] = Value;
+        Target->NodeCount++;
+        List->ListLength++;
+    }
+    return status;
+}
+
+/*
+   This function Unrolled_Init is responsible for initializing an unrolled list handle to the empty list.
+
+   Parameters:
+   - List: A pointer to the unrolled list handle to be initialized.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success or NODE_NULL_POINTER if List is NULL.
+*/
+NodeStatus_t Unrolled_Init(UnrolledList_t *List){
+    NodeStatus_t status = NODE_NOK;
+
+    /* Check for NULL pointers in the input parameters */
+    if(NULL == List){
+        status = NODE_NULL_POINTER;
+    }
+    else{
+        List->ListHead = NULL;
+        List->ListTail = NULL;
+        List->ListLength = 0;
+        List->ListNodeCount = 0;
+        status = NODE_OK;
+    }
+    return status;
+}
+
+/*
+   This function Unrolled_Insert_Node_At_Beginning is the unrolled version of Insert_Node_At_Beginning.
+
+   Parameters:
+   - List: A pointer to the unrolled list handle.
+   - Data: A void pointer to the uint32_t value to be stored.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if a pointer is NULL, or NODE_NOK if memory allocation failed.
+
+   Algorithm:
+   - If the first node has room the value is shifted in at its front.
+   - Otherwise a new node holding only the value is linked as the new head; following insertions at the beginning fill it up.
+*/
+NodeStatus_t Unrolled_Insert_Node_At_Beginning(UnrolledList_t *List, void *Data){
+    NodeStatus_t status = NODE_NOK;
+    uint32_t *_Data = Data;  // Cast the void pointer Data to uint32_t pointer
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == List)||(NULL == Data)){
+        status = NODE_NULL_POINTER;
+    }
+    else if((NULL != List->ListHead) && (UNROLLED_NODE_CAPACITY != List->ListHead->NodeCount)){
+        status = Unrolled_Insert_In_Node(List, List->ListHead, 0, *_Data);
+    }
+    else{
+        UnrolledNode_t *NewNode = Unrolled_Allocate_Node();
+
+        if(NULL == NewNode){  // Check if memory allocation failed
+            status = NODE_NOK;
+        }
+        else{
+            NewNode->NodeData[0] = *_Data;
+            NewNode->NodeCount = 1;
+            NewNode->NodeLink = List->ListHead;
+            List->ListHead = NewNode;
+            if(NULL == List->ListTail){
+                List->ListTail = NewNode;  // The list was empty
+            }
+            List->ListNodeCount++;
+            List->ListLength++;
+            status = NODE_OK;
+        }
+    }
+    return status;
+}
+
+/*
+   This function Unrolled_Insert_Node_At_End is the unrolled version of Insert_Node_At_End.
+
+   Parameters:
+   - List: A pointer to the unrolled list handle.
+   - Data: A void pointer to the uint32_t value to be stored.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if a pointer is NULL, or NODE_NOK if memory allocation failed.
+
+   Algorithm:
+   - If the last node has room the value is appended to it. This is O(1).
+   - Otherwise a new node is linked after the tail instead of splitting it, so a list built by appending keeps full nodes.
+*/
+NodeStatus_t Unrolled_Insert_Node_At_End(UnrolledList_t *List, void *Data){
+    NodeStatus_t status = NODE_NOK;
+    uint32_t *_Data = Data;  // Cast the void pointer Data to uint32_t pointer
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == List)||(NULL == Data)){
+        status = NODE_NULL_POINTER;
+    }
+    else if((NULL != List->ListTail) && (UNROLLED_NODE_CAPACITY != List->ListTail->NodeCount)){
+        List->ListTail->NodeData[List->ListTail->NodeCount] = *_Data;
+        List->ListTail->NodeCount++;
+        List->ListLength++;
+        status = NODE_OK;
+    }
+    else{
+        UnrolledNode_t *NewNode = Unrolled_Allocate_Node();
+
+        if(NULL == NewNode){  // Check if memory allocation failed
+            status = NODE_NOK;
+        }
+        else{
+            NewNode->NodeData[0] = *_Data;
+            NewNode->NodeCount = 1;
+            if(NULL == List->ListTail){
+                List->ListHead = NewNode;  // The list was empty
+            }
+            else{
+                List->ListTail->NodeLink = NewNode;
+            }
+            List->ListTail = NewNode;
+            List->ListNodeCount++;
+            List->ListLength++;
+            status = NODE_OK;
+        }
+    }
+    return status;
+}
+
+/*
+   This function Unrolled_Insert_Node_After is the unrolled version of Insert_Node_After.
+   Positions count values, not nodes, so they mean exactly the same as for Insert_Node_After.
+
+   Parameters:
+   - List: A pointer to the unrolled list handle.
+   - NodePosition: The position after which the value is inserted (the first position = 1).
+   - Data: A void pointer to the uint32_t value to be stored.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if a pointer is NULL,
+                   or NODE_NOK if the position is out of range or memory allocation failed.
+
+   Algorithm:
+   - Inserting into an empty list stores the value whatever the position, as Insert_Node_After does.
+   - Inserting after the last position is handled as Unrolled_Insert_Node_At_End.
+   - Otherwise the node holding the value at NodePosition is located by skipping whole nodes,
+     and the new value is stored right after it, splitting that node if it is full.
+*/
+NodeStatus_t Unrolled_Insert_Node_After(UnrolledList_t *List, size_t NodePosition, void *Data){
+    NodeStatus_t status = NODE_NOK;
+    uint32_t *_Data = Data;  // Cast the void pointer Data to uint32_t pointer
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == List)||(NULL == Data)){
+        status = NODE_NULL_POINTER;
+    }
+    else if((0 == List->ListLength) || (NodePosition == List->ListLength)){
+        status = Unrolled_Insert_Node_At_End(List, Data);
+    }
+    else if((0 == NodePosition)||(NodePosition > List->ListLength)){
+        status = NODE_NOK;  // Position out of range
+    }
+    else{
+        size_t Offset = 0;
+        UnrolledNode_t *Node = Unrolled_Locate(List, NodePosition - 1U, &Offset, NULL);
+
+        status = Unrolled_Insert_In_Node(List, Node, Offset + 1U, *_Data);
+    }
+    return status;
+}
+
+/*
+   This function Unrolled_Delete_Node_At_Beginning is the unrolled version of Delete_Node_At_Beginning.
+
+   Parameters:
+   - List: A pointer to the unrolled list handle.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if List is NULL, or NODE_EMPTY if the list is empty.
+*/
+NodeStatus_t Unrolled_Delete_Node_At_Beginning(UnrolledList_t *List){
+    return Unrolled_Delete_Node(List, 1U);
+}
+
+/*
+   This function Unrolled_Delete_Node is the unrolled version of Delete_Node.
+   Positions count values, not nodes, so they mean exactly the same as for Delete_Node.
+
+   Parameters:
+   - List: A pointer to the unrolled list handle.
+   - NodePosition: The position of the value to be deleted (the first position = 1).
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if List is NULL,
+                   NODE_EMPTY if position 1 is requested on an empty list, or NODE_NOK if the position is out of range.
+
+   Algorithm:
+   - The node holding the value is located by skipping whole nodes and the value is removed from its array.
+   - A node that becomes empty is unlinked and freed.
+   - A node left with fewer than UNROLLED_NODE_MIN_FILL values is merged with its successor when both fit in one node,
+     otherwise it borrows values from the successor, so nodes stay at least half full.
+*/
+NodeStatus_t Unrolled_Delete_Node(UnrolledList_t *List, size_t NodePosition){
+    NodeStatus_t status = NODE_NOK;
+
+    /* Check for NULL pointers in the input parameters */
+    if(NULL == List){
+        status = NODE_NULL_POINTER;
+    }
+    else if((1U == NodePosition) && (0 == List->ListLength)){
+        status = NODE_EMPTY;
+    }
+    else if((0 == NodePosition)||(NodePosition > List->ListLength)){
+        status = NODE_NOK;  // Position out of range or zero
+    }
+    else{
+        size_t Offset = 0;
+        UnrolledNode_t *PrevNode = NULL;
+        UnrolledNode_t *Node = Unrolled_Locate(List, NodePosition - 1U, &Offset, &PrevNode);
+        UnrolledNode_t *NextNode = Node->NodeLink;
+
+        memmove(&Node->NodeData[Offset], &Node->NodeData[Offset + 1U], (Node->NodeCount - Offset - 1U) * sizeof(uint32_t));
+        Node->NodeCount--;
+        List->ListLength--;
+
+        if(0 == Node->NodeCount){  /* Node became empty, unlink it */
+            if(NULL == PrevNode){
+                List->ListHead = NextNode;
+            }
+            else{
+                PrevNode->NodeLink = NextNode;
+            }
+            if(List->ListTail == Node){
+                List->ListTail = PrevNode;
+            }
+            Unrolled_Release_Node(Node);
+            List->ListNodeCount--;
+        }
+        else if((Node->NodeCount < UNROLLED_NODE_MIN_FILL) && (NULL != NextNode)){
+            if((Node->NodeCount + NextNode->NodeCount) <= UNROLLED_NODE_CAPACITY){  /* Merge the successor into this node */
+                memcpy(&Node->NodeData[Node->NodeCount], NextNode->NodeData, NextNode->NodeCount * sizeof(uint32_t));
+                Node->NodeCount += NextNode->NodeCount;
+                Node->NodeLink = NextNode->NodeLink;
+                if(List->ListTail == NextNode){
+                    List->ListTail = Node;
+                }
+                Unrolled_Release_Node(NextNode);
+                List->ListNodeCount--;
+            }
+            else{  /* Borrow values from the successor until this node is half full */
+                size_t Borrow = UNROLLED_NODE_MIN_FILL - Node->NodeCount;
+
+                memcpy(&Node->NodeData[Node->NodeCount], NextNode->NodeData, Borrow * sizeof(uint32_t));
+                memmove(NextNode->NodeData, &NextNode->NodeData[Borrow], (NextNode->NodeCount - Borrow) * sizeof(uint32_t));
+                Node->NodeCount += (uint32_t)Borrow;
+                NextNode->NodeCount -= (uint32_t)Borrow;
+            }
+        }
+        else{
+            /* Node is still at least half full (or is the last node) */
+        }
+        status = NODE_OK;
+    }
+    return status;
+}
+
+/*
+   This function Unrolled_Display_All_Nodes is the unrolled version of Display_All_Nodes and prints the values in the same format.
+
+   Parameters:
+   - List: A pointer to the unrolled list handle.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if List is NULL, or NODE_EMPTY if the list has no values.
+*/
+NodeStatus_t Unrolled_Display_All_Nodes(UnrolledList_t *List){
+    NodeStatus_t status = NODE_NOK;
+
+    /* Check for NULL pointers in the input parameters */
+    if(NULL == List){
+        status = NODE_NULL_POINTER;
+    }
+    else if(NULL == List->ListHead){  /* if the list is empty */
+        status = NODE_EMPTY;
+    }
+    else{
+        UnrolledNode_t *NodeCopy = List->ListHead;
+
+        while (NULL != NodeCopy)
+        {
+            uint32_t counter = 0;
+
+            for(counter = 0; counter < NodeCopy->NodeCount; counter++){
+                printf("%i -> ", NodeCopy->NodeData[counter]);  // Display the value
+            }
+            NodeCopy = NodeCopy->NodeLink;  // Move to the next node
+        }
+        printf("NULL \n");  // Print "NULL" to indicate the end of the list
+        status = NODE_OK;
+    }
+    return status;
+}
+
+/*
+   This function Unrolled_Get_Length is the unrolled version of Get_Length.
+
+   Parameters:
+   - List: A pointer to the unrolled list handle.
+   - Length: A pointer to a size_t where the number of values is stored.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success or NODE_NULL_POINTER if a pointer is NULL.
+*/
+NodeStatus_t Unrolled_Get_Length(UnrolledList_t *List, size_t *Length){
+    NodeStatus_t status = NODE_NOK;
+
+    /* Check for NULL pointers in the input parameters */
+    if((NULL == List)||(NULL == Length)){
+        status = NODE_NULL_POINTER;
+    }
+    else{
+        *Length = List->ListLength;
+        status = NODE_OK;
+    }
+    return status;
+}
+
+/*
+   This function Unrolled_Clear is responsible for freeing every node of an unrolled list and leaving it empty.
+
+   Parameters:
+   - List: A pointer to the unrolled list handle.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success or NODE_NULL_POINTER if List is NULL.
+*/
+NodeStatus_t Unrolled_Clear(UnrolledList_t *List){
+    NodeStatus_t status = NODE_NOK;
+
+    /* Check for NULL pointers in the input parameters */
+    if(NULL == List){
+        status = NODE_NULL_POINTER;
+    }
+    else{
+        UnrolledNode_t *NodeCopy = List->ListHead;
+
+        while (NULL != NodeCopy)
+        {
+            UnrolledNode_t *NextNode = NodeCopy->NodeLink;  // Keep the successor before the node is freed
+            Unrolled_Release_Node(NodeCopy);
+            NodeCopy = NextNode;
+        }
+        status = Unrolled_Init(List);
+    }
+    return status;
+}
\ No newline at end of file
@@ -0,0 +1,72 @@
+/* 
+ * File:   UnrolledList.h
+ * Author: Mohammed Khairallah
+ * linkedin : linkedin.com/in/mohammed-khairallah
+ * Created on October 18, 2026, 11:00 AM
+ */
+#ifndef _UNROLLEDLIST_H
+#define _UNROLLEDLIST_H
+
+/* Section : Includes */
+#include "SingleLinkedList.h"
+
+/* Section : Macro Declarations */
+
+#define UNROLLED_NODE_BYTES (64U)  /* Size of one unrolled node, one cache line */
+
+/* Number of uint32_t values that fit in one node next to the link and the fill count */
+#define UNROLLED_NODE_CAPACITY ((UNROLLED_NODE_BYTES - sizeof(void *) - sizeof(uint32_t)) / sizeof(uint32_t))
+
+/* A node holding fewer values than this after a deletion is refilled from (or merged with) its successor */
+#define UNROLLED_NODE_MIN_FILL (UNROLLED_NODE_CAPACITY / 2U)
+
+/* Section : Macro Functions Declarations */
+
+
+/* Section : Data type Declarations */
+
+/* 
+   This typedef struct represents a node of an unrolled linked list.
+   Instead of a single value, each node stores a small array of values and is exactly one cache line long,
+   so a traversal touches one cache line and follows one pointer per UNROLLED_NODE_CAPACITY values.
+
+   Explanation of members:
+   - NodeLink: Holds a pointer to the next node in the unrolled list.
+   - NodeCount: Holds the number of used entries at the start of NodeData (1 to UNROLLED_NODE_CAPACITY).
+   - NodeData: Holds the values in list order.
+*/
+typedef struct UnrolledNode{
+    struct UnrolledNode *NodeLink;              /* pointer to next node */
+    uint32_t NodeCount;                         /* number of used entries in NodeData */
+    uint32_t NodeData[UNROLLED_NODE_CAPACITY];  /* values stored in this node */
+}UnrolledNode_t; /* end structure UnrolledNode */
+
+/* 
+   This typedef struct represents a handle to a whole unrolled linked list.
+
+   Explanation of members:
+   - ListHead: Holds a pointer to the first node, or NULL when the list is empty.
+   - ListTail: Holds a pointer to the last node, or NULL when the list is empty.
+   - ListLength: Holds the number of values (not nodes) stored in the list.
+   - ListNodeCount: Holds the number of nodes currently allocated.
+*/
+typedef struct{
+    UnrolledNode_t *ListHead;  /* pointer to the first node */
+    UnrolledNode_t *ListTail;  /* pointer to the last node */
+    size_t ListLength;         /* number of values in the list */
+    size_t ListNodeCount;      /* number of nodes in the list */
+}UnrolledList_t;
+
+/* Section : Functions Declaration */
+
+NodeStatus_t Unrolled_Init(UnrolledList_t *List);
+NodeStatus_t Unrolled_Insert_Node_At_Beginning(UnrolledList_t *List, void *Data);
+NodeStatus_t Unrolled_Insert_Node_At_End(UnrolledList_t *List, void *Data);
+NodeStatus_t Unrolled_Insert_Node_After(UnrolledList_t *List, size_t NodePosition, void *Data);
+NodeStatus_t Unrolled_Delete_Node_At_Beginning(UnrolledList_t *List);
+NodeStatus_t Unrolled_Delete_Node(UnrolledList_t *List, size_t NodePosition);
+NodeStatus_t Unrolled_Display_All_Nodes(UnrolledList_t *List);
+NodeStatus_t Unrolled_Get_Length(UnrolledList_t *List, size_t *Length);
+NodeStatus_t Unrolled_Clear(UnrolledList_t *List);
+
+#endif  //_UNROLLEDLIST_H
\ No newline at end of file
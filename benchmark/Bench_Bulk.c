@@ -0,0 +1,190 @@
+/* 
+ * File:   Bench_Bulk.c
+ * Author: Mohammed Khairallah
+ * linkedin : linkedin.com/in/mohammed-khairallah
+ * Created on October 20, 2026, 10:00 AM
+ */
+
+/*
+   This file is the "bulk" benchmark group: ingesting and extracting an array of 10 ... Config->MaxSize values.
+   One sample moves the whole array; the reported time is per value.
+   - Ingest / loop:   one Insert_Node_At_End (raw, only up to 10^4 values as it walks the list every time)
+                      or List_Insert_Node_At_End call per value.
+   - Ingest / bulk:   one Insert_Nodes_At_End or List_Insert_Nodes_At_End call for the whole array.
+   - Extract / loop:  reading the values back with a walk that stores them one by one.
+   - Extract / bulk:  Extract_Nodes / List_Extract_Nodes.
+   Variants are raw, handle and pooled as in the "list" group.
+*/
+#include "Benchmark.h"
+#include "NodePool.h"
+
+#define BULK_BENCH_MAX_RAW_LOOP (10000U)  /* Largest array ingested with repeated Insert_Node_At_End */
+
+/* 
+   This typedef struct holds the lists and arrays of the bulk group.
+*/
+typedef struct{
+    Node_t *NodeHead;   /* raw list */
+    List_t List;        /* list handle (handle and pooled variants) */
+    uint32_t *Values;   /* values to ingest */
+    uint32_t *Output;   /* extracted values */
+    size_t Size;        /* number of values */
+}BulkBench_t;
+
+static void Bulk_Raw_Ingest_Loop(void *Context, size_t Ops){
+    BulkBench_t *Bench = Context;
+    size_t counter = 0;
+
+    for(counter = 0; counter < Ops; counter++){
+        Insert_Node_At_End(&Bench->NodeHead, &Bench->Values[counter]);
+    }
+}
+
+static void Bulk_Raw_Ingest(void *Context, size_t Ops){
+    BulkBench_t *Bench = Context;
+
+    Insert_Nodes_At_End(&Bench->NodeHead, Bench->Values, Ops);
+}
+
+static void Bulk_Raw_Clear(void *Context, size_t Ops){
+    BulkBench_t *Bench = Context;
+
+    (void)Ops;
+    while (NULL != Bench->NodeHead)
+    {
+        Delete_Node_At_Beginning(&Bench->NodeHead);
+    }
+}
+
+static void Bulk_Raw_Extract_Loop(void *Context, size_t Ops){
+    BulkBench_t *Bench = Context;
+    Node_t *NodeCopy = Bench->NodeHead;
+    size_t counter = 0;
+
+    for(counter = 0; (counter < Ops) && (NULL != NodeCopy); counter++){
+        Bench->Output[counter] = NodeCopy->NodeData;
+        NodeCopy = NodeCopy->NodeLink;
+    }
+}
+
+static void Bulk_Raw_Extract(void *Context, size_t Ops){
+    BulkBench_t *Bench = Context;
+    size_t Count = 0;
+
+    Extract_Nodes(Bench->NodeHead, Bench->Output, Ops, &Count);
+}
+
+static void Bulk_Handle_Ingest_Loop(void *Context, size_t Ops){
+    BulkBench_t *Bench = Context;
+    size_t counter = 0;
+
+    for(counter = 0; counter < Ops; counter++){
+        List_Insert_Node_At_End(&Bench->List, &Bench->Values[counter]);
+    }
+}
+
+static void Bulk_Handle_Ingest(void *Context, size_t Ops){
+    BulkBench_t *Bench = Context;
+
+    List_Insert_Nodes_At_End(&Bench->List, Bench->Values, Ops);
+}
+
+static void Bulk_Handle_Clear(void *Context, size_t Ops){
+    BulkBench_t *Bench = Context;
+
+    (void)Ops;
+    List_Clear(&Bench->List);
+}
+
+static void Bulk_Handle_Extract_Loop(void *Context, size_t Ops){
+    BulkBench_t *Bench = Context;
+    Node_t *NodeCopy = Bench->List.ListHead;
+    size_t counter = 0;
+
+    for(counter = 0; (counter < Ops) && (NULL != NodeCopy); counter++){
+        Bench->Output[counter] = NodeCopy->NodeData;
+        NodeCopy = NodeCopy->NodeLink;
+    }
+}
+
+static void Bulk_Handle_Extract(void *Context, size_t Ops){
+    BulkBench_t *Bench = Context;
+    size_t Count = 0;
+
+    List_Extract_Nodes(&Bench->List, Bench->Output, Ops, &Count);
+}
+
+/* Function to time one case and report it */
+static void Bulk_Bench_Case(BenchConfig_t *Config, const char *CaseName, const char *Variant, BenchRun_t Run,
+                            BenchRestore_t Restore, BulkBench_t *Bench){
+    BenchCase_t Case = {"bulk", CaseName, Variant, Bench->Size, 1U};
+    BenchResult_t Result;
+
+    if(Bench_Case_Enabled(Config, Case.CaseGroup, Case.CaseName)){
+        Bench_Measure(Config, Run, Restore, Bench, Bench->Size, &Result);
+        Bench_Report(Config, &Case, &Result);
+    }
+}
+
+/* Function to run the ingest and extract cases of the handle and pooled variants */
+static void Bulk_Bench_Handle(BenchConfig_t *Config, const char *Variant, BulkBench_t *Bench){
+    Bulk_Bench_Case(Config, "Ingest_Loop", Variant, Bulk_Handle_Ingest_Loop, Bulk_Handle_Clear, Bench);
+    Bulk_Bench_Case(Config, "Ingest_Bulk", Variant, Bulk_Handle_Ingest, Bulk_Handle_Clear, Bench);
+    List_Insert_Nodes_At_End(&Bench->List, Bench->Values, Bench->Size);
+    Bulk_Bench_Case(Config, "Extract_Loop", Variant, Bulk_Handle_Extract_Loop, NULL, Bench);
+    Bulk_Bench_Case(Config, "Extract_Bulk", Variant, Bulk_Handle_Extract, NULL, Bench);
+    List_Clear(&Bench->List);
+}
+
+/*
+   This function Bench_Group_Bulk is the entry point of the "bulk" benchmark group.
+*/
+void Bench_Group_Bulk(BenchConfig_t *Config){
+    BulkBench_t Bench;
+    NodePool_t Pool;
+    size_t Size = 0;
+    size_t counter = 0;
+
+    for(Size = Config->MinSize; Size <= Config->MaxSize; Size *= 10U){
+        Bench.Size = Size;
+        Bench.NodeHead = NULL;
+        Bench.Values = (uint32_t *)malloc(Size * sizeof(uint32_t));
+        Bench.Output = (uint32_t *)malloc(Size * sizeof(uint32_t));
+        if((NULL == Bench.Values)||(NULL == Bench.Output)){
+            printf("bulk: out of memory at %zu values\n", Size);
+            free(Bench.Values);
+            free(Bench.Output);
+            break;
+        }
+        for(counter = 0; counter < Size; counter++){
+            Bench.Values[counter] = (uint32_t)(counter * 2654435761U);
+        }
+
+        /* raw variant */
+        if(Size <= BULK_BENCH_MAX_RAW_LOOP){
+            Bulk_Bench_Case(Config, "Ingest_Loop", "raw", Bulk_Raw_Ingest_Loop, Bulk_Raw_Clear, &Bench);
+        }
+        Bulk_Bench_Case(Config, "Ingest_Bulk", "raw", Bulk_Raw_Ingest, Bulk_Raw_Clear, &Bench);
+        Insert_Nodes_At_End(&Bench.NodeHead, Bench.Values, Size);
+        Bulk_Bench_Case(Config, "Extract_Loop", "raw", Bulk_Raw_Extract_Loop, NULL, &Bench);
+        Bulk_Bench_Case(Config, "Extract_Bulk", "raw", Bulk_Raw_Extract, NULL, &Bench);
+        Bulk_Raw_Clear(&Bench, 0U);
+
+        /* handle variant */
+        List_Init(&Bench.List);
+        Bulk_Bench_Handle(Config, "handle", &Bench);
+
+        /* pooled variant */
+        NodePool_Init(&Pool, 0U);
+        List_Use_Pool(&Bench.List, &Pool);
+        Bulk_Bench_Handle(Config, "pooled", &Bench);
+        List_Use_Pool(&Bench.List, NULL);
+        NodePool_Destroy(&Pool);
+
+        free(Bench.Values);
+        free(Bench.Output);
+        if(Size > (Config->MaxSize / 10U)){
+            break;  // Next power of ten would exceed MaxSize (or overflow)
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,208 @@
+/* 
+ * File:   Bench_CList.c
+ * Author: Mohammed Khairallah
+ * linkedin : linkedin.com/in/mohammed-khairallah
+ * Created on October 24, 2026, 2:00 PM
+ */
+
+/*
+   This file is the "clist" benchmark group: positional operations on one shared list from 1 to Config->MaxThreads threads,
+   for lists of 10 ... min(Config->MaxSize, CLIST_BENCH_MAX_SIZE) nodes.
+   Every thread draws operations at random positions with a fixed mix:
+   - Read90: 90% reads, 5% inserts, 5% deletes.
+   - Read50: 50% reads, 25% inserts, 25% deletes.
+   - Write:  50% inserts, 50% deletes.
+   Variants:
+       fine:   ConcurrentList_t, one lock per node (hand-over-hand), so threads at different positions overlap.
+       mutex:  a List_t behind one global mutex (cursor seek and peek for reads, List_Insert_Node_After and
+               List_Delete_Node for updates), which is how the list is shared today.
+   The list is brought back to Size nodes after every sample, so the length does not drift between samples.
+*/
+#include <pthread.h>
+#include "Benchmark.h"
+#include "ConcurrentList.h"
+
+#define CLIST_BENCH_MAX_SIZE (10000U)          /* Longest shared list (every operation walks half of it on average) */
+#define CLIST_BENCH_STEPS_PER_THREAD (1000000U) /* About this many nodes walked per thread and sample */
+#define CLIST_BENCH_MIN_OPS (100U)              /* Fewest operations per thread and sample */
+
+/* Operation drawn for one step of a worker */
+typedef enum{
+    CLIST_OP_READ = 0,
+    CLIST_OP_INSERT,
+    CLIST_OP_DELETE
+}CListOp_t;
+
+/* 
+   This typedef struct holds the lists shared by the workers.
+*/
+typedef struct{
+    ConcurrentList_t Fine;    /* lock-coupled list */
+    List_t Coarse;            /* mutex-protected list handle */
+    pthread_mutex_t Lock;     /* global lock of Coarse */
+    size_t Size;              /* length restored after every sample */
+    size_t ReadPercent;       /* share of reads in the current mix */
+}CListBench_t;
+
+/* Function to draw the next pseudo-random number of one worker (xorshift64) */
+static uint64_t CList_Bench_Random(uint64_t *Seed){
+    *Seed ^= *Seed << 13;
+    *Seed ^= *Seed >> 7;
+    *Seed ^= *Seed << 17;
+    return *Seed;
+}
+
+/* Function to draw one operation and its position for a list of Length nodes */
+static CListOp_t CList_Bench_Pick(CListBench_t *Bench, uint64_t *Seed, size_t Length, size_t *Position){
+    uint64_t Draw = CList_Bench_Random(Seed);
+    size_t Percent = (size_t)(Draw % 100U);
+    CListOp_t Op = CLIST_OP_READ;
+
+    if(Percent < Bench->ReadPercent){
+        Op = CLIST_OP_READ;
+    }
+    else if(Percent < (Bench->ReadPercent + ((100U - Bench->ReadPercent) / 2U))){
+        Op = CLIST_OP_INSERT;
+    }
+    else{
+        Op = CLIST_OP_DELETE;
+    }
+    if(CLIST_OP_INSERT == Op){
+        *Position = (size_t)((Draw >> 8) % (Length + 1U));  // 0 inserts at the beginning
+    }
+    else{
+        *Position = (0U == Length) ? 1U : (1U + (size_t)((Draw >> 8) % Length));
+    }
+    return Op;
+}
+
+static void CList_Fine_Mix(void *Context, size_t ThreadIndex, size_t Ops){
+    CListBench_t *Bench = Context;
+    uint64_t Seed = 0x9E3779B97F4A7C15ULL * (ThreadIndex + 1U);
+    uint32_t Value = (uint32_t)ThreadIndex;
+    size_t Length = 0;
+    size_t Position = 0;
+    size_t counter = 0;
+
+    for(counter = 0; counter < Ops; counter++){
+        Concurrent_List_Get_Length(&Bench->Fine, &Length);
+        switch(CList_Bench_Pick(Bench, &Seed, Length, &Position)){
+            case CLIST_OP_READ:
+                Concurrent_List_Get(&Bench->Fine, Position, &Value);
+                break;
+            case CLIST_OP_INSERT:
+                Concurrent_List_Insert_After(&Bench->Fine, Position, &Value);
+                break;
+            default:
+                Concurrent_List_Delete_Node(&Bench->Fine, Position);
+                break;
+        }
+    }
+}
+
+static void CList_Mutex_Mix(void *Context, size_t ThreadIndex, size_t Ops){
+    CListBench_t *Bench = Context;
+    uint64_t Seed = 0x9E3779B97F4A7C15ULL * (ThreadIndex + 1U);
+    uint32_t Value = (uint32_t)ThreadIndex;
+    ListCursor_t Cursor;
+    size_t Position = 0;
+    size_t counter = 0;
+
+    for(counter = 0; counter < Ops; counter++){
+        pthread_mutex_lock(&Bench->Lock);
+        switch(CList_Bench_Pick(Bench, &Seed, Bench->Coarse.ListLength, &Position)){
+            case CLIST_OP_READ:
+                List_Cursor_Init(&Cursor, &Bench->Coarse);
+                if(NODE_OK == List_Cursor_Seek(&Cursor, Position - 1U)){
+                    List_Cursor_Peek(&Cursor, &Value);
+                }
+                break;
+            case CLIST_OP_INSERT:
+                if(0U == Position){
+                    List_Insert_Node_At_Beginning(&Bench->Coarse, &Value);
+                }
+                else{
+                    List_Insert_Node_After(&Bench->Coarse, Position, &Value);
+                }
+                break;
+            default:
+                List_Delete_Node(&Bench->Coarse, Position);
+                break;
+        }
+        pthread_mutex_unlock(&Bench->Lock);
+    }
+}
+
+/* Function to bring both lists back to Size nodes */
+static void CList_Restore(void *Context, size_t Ops){
+    CListBench_t *Bench = Context;
+    uint32_t Value = 0;
+    size_t Length = 0;
+
+    (void)Ops;
+    Concurrent_List_Get_Length(&Bench->Fine, &Length);
+    for(; Length > Bench->Size; Length--){
+        Concurrent_List_Delete_Node(&Bench->Fine, 1U);
+    }
+    for(; Length < Bench->Size; Length++){
+        Value = (uint32_t)Length;
+        Concurrent_List_Insert_After(&Bench->Fine, 0U, &Value);
+    }
+    while (Bench->Coarse.ListLength > Bench->Size)
+    {
+        List_Delete_Node_At_Beginning(&Bench->Coarse);
+    }
+    while (Bench->Coarse.ListLength < Bench->Size)
+    {
+        Value = (uint32_t)Bench->Coarse.ListLength;
+        List_Insert_Node_At_Beginning(&Bench->Coarse, &Value);
+    }
+}
+
+/*
+   This function Bench_Group_CList is the entry point of the "clist" benchmark group.
+*/
+void Bench_Group_CList(BenchConfig_t *Config){
+    static const char *MixNames[3] = {"Read90", "Read50", "Write"};
+    static const size_t MixReads[3] = {90U, 50U, 0U};
+    CListBench_t Bench;
+    BenchResult_t Result;
+    size_t Threads = 0;
+    size_t Size = 0;
+    size_t Ops = 0;
+    size_t Mix = 0;
+
+    Concurrent_List_Init(&Bench.Fine);
+    List_Init(&Bench.Coarse);
+    pthread_mutex_init(&Bench.Lock, NULL);
+    for(Size = Config->MinSize; (Size <= Config->MaxSize) && (Size <= CLIST_BENCH_MAX_SIZE); Size *= 10U){
+        Bench.Size = Size;
+        Ops = CLIST_BENCH_STEPS_PER_THREAD / Size;
+        Ops = (Ops < CLIST_BENCH_MIN_OPS) ? CLIST_BENCH_MIN_OPS : Ops;
+        CList_Restore(&Bench, 0U);
+        for(Mix = 0; Mix < 3U; Mix++){
+            Bench.ReadPercent = MixReads[Mix];
+            for(Threads = Bench_Next_Thread_Count(Config, 0U); 0U != Threads; Threads = Bench_Next_Thread_Count(Config, Threads)){
+                BenchCase_t FineCase = {"clist", MixNames[Mix], "fine", Size, Threads};
+                BenchCase_t MutexCase = {"clist", MixNames[Mix], "mutex", Size, Threads};
+
+                if(Bench_Case_Enabled(Config, FineCase.CaseGroup, FineCase.CaseName)){
+                    if(NODE_OK == Bench_Measure_Threads(Config, Threads, CList_Fine_Mix, NULL, CList_Restore, &Bench,
+                                                        Ops, &Result)){
+                        Bench_Report(Config, &FineCase, &Result);
+                    }
+                    if(NODE_OK == Bench_Measure_Threads(Config, Threads, CList_Mutex_Mix, NULL, CList_Restore, &Bench,
+                                                        Ops, &Result)){
+                        Bench_Report(Config, &MutexCase, &Result);
+                    }
+                }
+            }
+        }
+        if(Size > (Config->MaxSize / 10U)){
+            break;  // Next power of ten would exceed MaxSize (or overflow)
+        }
+    }
+    Concurrent_List_Destroy(&Bench.Fine);
+    List_Clear(&Bench.Coarse);
+    pthread_mutex_destroy(&Bench.Lock);
+}
\ No newline at end of file
@@ -0,0 +1,207 @@
+/* 
+ * File:   Bench_Compact.c
+ * Author: Mohammed Khairallah
+ * linkedin : linkedin.com/in/mohammed-khairallah
+ * Created on October 24, 2026, 9:30 AM
+ */
+
+/*
+   This file is the "compact" benchmark group: traversal locality before and after compaction, 10 ... Config->MaxSize nodes.
+   - Walk:    Get_Length_Wide over the whole list, timed per node.
+   - Compact: List_Compact of a churned list, timed per node (the list is churned again between samples).
+   A churned list is built by linking its nodes in a random order, which is what a long run of inserts and deletes
+   at random positions converges to: consecutive nodes end up anywhere in the heap (or the pool).
+   Variants:
+       fresh / churned / compacted:            malloc'ed nodes, linked in allocation order, shuffled, then List_Compact.
+       pool_fresh / pool_churn / pool_comp:    the same with the nodes taken from a NodePool_t.
+       malloc / pool:                          List_Compact on the two kinds of lists.
+       pool_step:                              List_Compact_Begin plus List_Compact_Step slices of COMPACT_BENCH_STEP nodes.
+   The fragmentation metric (mean link distance and near links, see Get_Fragmentation) is printed for every Walk list.
+*/
+#include "Benchmark.h"
+#include "NodePool.h"
+
+#define COMPACT_BENCH_STEP (256U)  /* Nodes moved per List_Compact_Step in the pool_step variant */
+
+/* 
+   This typedef struct holds the list of the compact group and what is needed to churn it again.
+*/
+typedef struct{
+    List_t List;       /* list under test */
+    NodePool_t Pool;   /* pool of the pooled variants */
+    Node_t **Nodes;    /* scratch array used to link nodes in a chosen order */
+    size_t Size;       /* number of nodes */
+    boolean Pooled;    /* 1 when the nodes come from Pool */
+    uint64_t Seed;     /* state of the shuffle generator */
+    uint64_t Sink;     /* results are folded in here so no walk can be skipped */
+}CompactBench_t;
+
+/* Function to draw the next pseudo-random number (xorshift64) */
+static uint64_t Compact_Bench_Random(CompactBench_t *Bench){
+    Bench->Seed ^= Bench->Seed << 13;
+    Bench->Seed ^= Bench->Seed >> 7;
+    Bench->Seed ^= Bench->Seed << 17;
+    return Bench->Seed;
+}
+
+/* Function to rebuild the list with Size new nodes, linked in allocation order or in a random order */
+static NodeStatus_t Compact_Bench_Build(CompactBench_t *Bench, boolean Churned){
+    NodeStatus_t status = NODE_OK;
+    size_t counter = 0;
+
+    List_Clear(&Bench->List);
+    for(counter = 0; (counter < Bench->Size) && (NODE_OK == status); counter++){
+        if(1U == Bench->Pooled){
+            status = NodePool_Alloc(&Bench->Pool, &Bench->Nodes[counter]);
+        }
+        else{
+            Bench->Nodes[counter] = (Node_t *)malloc(sizeof(Node_t));
+            status = (NULL == Bench->Nodes[counter]) ? NODE_NOK : NODE_OK;
+        }
+    }
+    if((NODE_OK != status) && (0U == Bench->Pooled)){  /* counter is one past the failed node; pool nodes go with the pool */
+        while (counter > 1U)
+        {
+            counter--;
+            free(Bench->Nodes[counter - 1U]);
+        }
+    }
+    else if(NODE_OK == status){
+        if(1U == Churned){  /* Fisher-Yates shuffle of the link order */
+            for(counter = Bench->Size - 1U; counter > 0U; counter--){
+                size_t Other = (size_t)(Compact_Bench_Random(Bench) % (counter + 1U));
+                Node_t *Swap = Bench->Nodes[counter];
+                Bench->Nodes[counter] = Bench->Nodes[Other];
+                Bench->Nodes[Other] = Swap;
+            }
+        }
+        for(counter = 0; counter < Bench->Size; counter++){
+            Bench->Nodes[counter]->NodeData = (uint32_t)counter;
+            List_Link_Node_After(&Bench->List, Bench->List.ListTail, Bench->Nodes[counter]);
+        }
+    }
+    return status;
+}
+
+static void Compact_Walk(void *Context, size_t Ops){
+    CompactBench_t *Bench = Context;
+    size_t Length = 0;
+
+    (void)Ops;
+    Get_Length_Wide(&Bench->List.ListHead, &Length);
+    Bench->Sink += Length;
+}
+
+static void Compact_Full(void *Context, size_t Ops){
+    CompactBench_t *Bench = Context;
+
+    (void)Ops;
+    List_Compact(&Bench->List);
+}
+
+static void Compact_Steps(void *Context, size_t Ops){
+    CompactBench_t *Bench = Context;
+    ListCompactState_t State;
+    boolean Done = 0;
+
+    (void)Ops;
+    List_Compact_Begin(&Bench->List, &State);
+    while ((0U == Done) && (NODE_OK == List_Compact_Step(&Bench->List, &State, COMPACT_BENCH_STEP, &Done)))
+    {
+        Bench->Sink++;
+    }
+}
+
+static void Compact_Churn(void *Context, size_t Ops){
+    CompactBench_t *Bench = Context;
+
+    (void)Ops;
+    Compact_Bench_Build(Bench, 1U);
+}
+
+/* Function to time one case and report it */
+static void Compact_Bench_Case(BenchConfig_t *Config, const char *CaseName, const char *Variant, BenchRun_t Run,
+                               BenchRestore_t Restore, CompactBench_t *Bench){
+    BenchCase_t Case = {"compact", CaseName, Variant, Bench->Size, 1U};
+    BenchResult_t Result;
+
+    if(Bench_Case_Enabled(Config, Case.CaseGroup, Case.CaseName)){
+        Bench_Measure(Config, Run, Restore, Bench, Bench->Size, &Result);
+        Bench_Report(Config, &Case, &Result);
+    }
+}
+
+/* Function to time a walk over the current list and print its fragmentation */
+static void Compact_Bench_Walk(BenchConfig_t *Config, const char *Variant, CompactBench_t *Bench){
+    ListFragmentation_t Fragmentation = {0};
+
+    if(Bench_Case_Enabled(Config, "compact", "Walk")){
+        List_Get_Fragmentation(&Bench->List, &Fragmentation);
+        printf("compact: %-10s %zu nodes, mean link distance %.0f B, %zu of %zu links near\n",
+               Variant, Bench->Size, Fragmentation.FragMeanDistance, Fragmentation.FragNearLinks, Fragmentation.FragLinks);
+    }
+    Compact_Bench_Case(Config, "Walk", Variant, Compact_Walk, NULL, Bench);
+}
+
+/* Function to run all cases on one kind of list (malloc or pool) */
+static NodeStatus_t Compact_Bench_Variant(BenchConfig_t *Config, boolean Pooled, CompactBench_t *Bench){
+    NodeStatus_t status = NODE_NOK;
+
+    Bench->Pooled = Pooled;
+    List_Use_Pool(&Bench->List, (1U == Pooled) ? &Bench->Pool : NULL);
+    status = Compact_Bench_Build(Bench, 0U);
+    if(NODE_OK == status){
+        Compact_Bench_Walk(Config, (1U == Pooled) ? "pool_fresh" : "fresh", Bench);
+        status = Compact_Bench_Build(Bench, 1U);
+    }
+    if(NODE_OK == status){
+        Compact_Bench_Walk(Config, (1U == Pooled) ? "pool_churn" : "churned", Bench);
+        status = List_Compact(&Bench->List);
+    }
+    if(NODE_OK == status){
+        Compact_Bench_Walk(Config, (1U == Pooled) ? "pool_comp" : "compacted", Bench);
+        status = Compact_Bench_Build(Bench, 1U);
+    }
+    if(NODE_OK == status){
+        Compact_Bench_Case(Config, "Compact", (1U == Pooled) ? "pool" : "malloc", Compact_Full, Compact_Churn, Bench);
+        if(1U == Pooled){
+            Compact_Bench_Case(Config, "Compact", "pool_step", Compact_Steps, Compact_Churn, Bench);
+        }
+    }
+    List_Clear(&Bench->List);
+    return status;
+}
+
+/*
+   This function Bench_Group_Compact is the entry point of the "compact" benchmark group.
+*/
+void Bench_Group_Compact(BenchConfig_t *Config){
+    CompactBench_t Bench;
+    size_t Size = 0;
+
+    List_Init(&Bench.List);
+    NodePool_Init(&Bench.Pool, 0);
+    Bench.Seed = 0x9E3779B97F4A7C15ULL;
+    Bench.Sink = 0;
+    for(Size = Config->MinSize; Size <= Config->MaxSize; Size *= 10U){
+        Bench.Size = Size;
+        Bench.Nodes = (Node_t **)malloc(Size * sizeof(Node_t *));
+        if((NULL == Bench.Nodes) ||
+           (NODE_OK != Compact_Bench_Variant(Config, 0U, &Bench)) ||
+           (NODE_OK != Compact_Bench_Variant(Config, 1U, &Bench))){
+            printf("compact: out of memory at %zu values\n", Size);
+            free(Bench.Nodes);
+            break;
+        }
+        free(Bench.Nodes);
+        NodePool_Destroy(&Bench.Pool);
+        if(Size > (Config->MaxSize / 10U)){
+            break;  // Next power of ten would exceed MaxSize (or overflow)
+        }
+    }
+    List_Use_Pool(&Bench.List, NULL);
+    NodePool_Destroy(&Bench.Pool);
+    if(0U == Bench.Sink){
+        printf("compact: no nodes walked\n");
+    }
+}
\ No newline at end of file
@@ -0,0 +1,143 @@
+/* 
+ * File:   Bench_Cursor.c
+ * Author: Mohammed Khairallah
+ * linkedin : linkedin.com/in/mohammed-khairallah
+ * Created on October 20, 2026, 2:00 PM
+ */
+
+/*
+   This file is the "cursor" benchmark group: one editing pass over a whole list of 10 ... Config->MaxSize nodes.
+   One sample is the whole pass; the reported time is per node of the original list.
+   - Filter:  delete every node holding an odd value.
+   - Expand:  insert a copy after every node, doubling the list.
+   Variants:
+   - position: List_Delete_Node / List_Insert_Node_After with a running position, each call walking from the head
+               (only up to 10^4 nodes, the pass is quadratic).
+   - cursor:   List_Cursor_Erase / List_Cursor_Insert_After in a single sweep.
+*/
+#include "Benchmark.h"
+
+#define CURSOR_BENCH_MAX_POSITION (10000U)  /* Largest list edited through positions */
+
+/* 
+   This typedef struct holds the list of the cursor group and the values it is rebuilt from.
+*/
+typedef struct{
+    List_t List;        /* list being edited */
+    uint32_t *Values;   /* original contents */
+    size_t Size;        /* number of values */
+}CursorBench_t;
+
+static void Cursor_Filter_Position(void *Context, size_t Ops){
+    CursorBench_t *Bench = Context;
+    size_t Position = 1;
+    size_t counter = 0;
+
+    for(counter = 0; counter < Ops; counter++){
+        if(0U != (Bench->Values[counter] & 1U)){
+            List_Delete_Node(&Bench->List, Position);
+        }
+        else{
+            Position++;
+        }
+    }
+}
+
+static void Cursor_Filter_Cursor(void *Context, size_t Ops){
+    CursorBench_t *Bench = Context;
+    ListCursor_t Cursor;
+    uint32_t Value = 0;
+
+    (void)Ops;
+    List_Cursor_Init(&Cursor, &Bench->List);
+    while (NODE_OK == List_Cursor_Peek(&Cursor, &Value))
+    {
+        if(0U != (Value & 1U)){
+            List_Cursor_Erase(&Cursor);
+        }
+        else{
+            List_Cursor_Next(&Cursor);
+        }
+    }
+}
+
+static void Cursor_Expand_Position(void *Context, size_t Ops){
+    CursorBench_t *Bench = Context;
+    size_t counter = 0;
+
+    for(counter = 0; counter < Ops; counter++){
+        List_Insert_Node_After(&Bench->List, (2U * counter) + 1U, &Bench->Values[counter]);
+    }
+}
+
+static void Cursor_Expand_Cursor(void *Context, size_t Ops){
+    CursorBench_t *Bench = Context;
+    ListCursor_t Cursor;
+    uint32_t Value = 0;
+
+    (void)Ops;
+    List_Cursor_Init(&Cursor, &Bench->List);
+    while (NODE_OK == List_Cursor_Peek(&Cursor, &Value))
+    {
+        List_Cursor_Insert_After(&Cursor, &Value);
+        List_Cursor_Seek(&Cursor, 2U);
+    }
+}
+
+static void Cursor_Rebuild(void *Context, size_t Ops){
+    CursorBench_t *Bench = Context;
+
+    (void)Ops;
+    List_Clear(&Bench->List);
+    List_Insert_Nodes_At_End(&Bench->List, Bench->Values, Bench->Size);
+}
+
+/* Function to time one case and report it */
+static void Cursor_Bench_Case(BenchConfig_t *Config, const char *CaseName, const char *Variant, BenchRun_t Run,
+                              CursorBench_t *Bench){
+    BenchCase_t Case = {"cursor", CaseName, Variant, Bench->Size, 1U};
+    BenchResult_t Result;
+
+    if(Bench_Case_Enabled(Config, Case.CaseGroup, Case.CaseName)){
+        Cursor_Rebuild(Bench, 0U);
+        Bench_Measure(Config, Run, Cursor_Rebuild, Bench, Bench->Size, &Result);
+        Bench_Report(Config, &Case, &Result);
+    }
+}
+
+/*
+   This function Bench_Group_Cursor is the entry point of the "cursor" benchmark group.
+*/
+void Bench_Group_Cursor(BenchConfig_t *Config){
+    CursorBench_t Bench;
+    size_t Size = 0;
+    size_t counter = 0;
+
+    List_Init(&Bench.List);
+    for(Size = Config->MinSize; Size <= Config->MaxSize; Size *= 10U){
+        Bench.Size = Size;
+        Bench.Values = (uint32_t *)malloc(Size * sizeof(uint32_t));
+        if(NULL == Bench.Values){
+            printf("cursor: out of memory at %zu values\n", Size);
+            break;
+        }
+        for(counter = 0; counter < Size; counter++){
+            Bench.Values[counter] = (uint32_t)(counter * 2654435761U) >> 7;
+        }
+
+        if(Size <= CURSOR_BENCH_MAX_POSITION){
+            Cursor_Bench_Case(Config, "Filter", "position", Cursor_Filter_Position, &Bench);
+        }
+        Cursor_Bench_Case(Config, "Filter", "cursor", Cursor_Filter_Cursor, &Bench);
+        if(Size <= CURSOR_BENCH_MAX_POSITION){
+            Cursor_Bench_Case(Config, "Expand", "position", Cursor_Expand_Position, &Bench);
+        }
+        Cursor_Bench_Case(Config, "Expand", "cursor", Cursor_Expand_Cursor, &Bench);
+
+        List_Clear(&Bench.List);
+        free(Bench.Values);
+        if(Size > (Config->MaxSize / 10U)){
+            break;  // Next power of ten would exceed MaxSize (or overflow)
+        }
+    }
+}
\ No newline at end of file
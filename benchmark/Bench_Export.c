@@ -0,0 +1,112 @@
+/* 
+ * File:   Bench_Export.c
+ * Author: Mohammed Khairallah
+ * linkedin : linkedin.com/in/mohammed-khairallah
+ * Created on October 19, 2026, 5:00 PM
+ */
+
+/*
+   This file is the "export" benchmark group: printing a whole list of 10 ... Config->MaxSize values to the null device.
+   One sample prints the list once; the reported time is per value.
+   - Display_All_Nodes / printf: the existing path, one printf per node (stdout redirected to the null device).
+   - Export_Nodes / arrow_fd, arrow_file: the buffered exporter with the same arrow text, to a file descriptor and a FILE *.
+   - Export_Nodes / csv_fd: the buffered exporter with comma separated unsigned values.
+*/
+#include "Benchmark.h"
+#include "ListExport.h"
+
+#if defined(_WIN32)
+#define EXPORT_BENCH_NULL_DEVICE "NUL"
+#else
+#define EXPORT_BENCH_NULL_DEVICE "/dev/null"
+#endif
+
+/* 
+   This typedef struct holds the list and outputs of the export group.
+*/
+typedef struct{
+    Node_t *NodeHead;           /* list being printed */
+    ListExporter_t *Exporter;   /* exporter prepared for the running case */
+}ExportBench_t;
+
+static void Export_Bench_Display(void *Context, size_t Ops){
+    ExportBench_t *Bench = Context;
+
+    (void)Ops;
+    Display_All_Nodes(Bench->NodeHead);
+    fflush(stdout);
+}
+
+static void Export_Bench_Export(void *Context, size_t Ops){
+    ExportBench_t *Bench = Context;
+
+    (void)Ops;
+    Export_Nodes(Bench->Exporter, Bench->NodeHead);
+}
+
+/* Function to time one exporter case and report it */
+static void Export_Bench_Case(BenchConfig_t *Config, const char *Variant, ExportBench_t *Bench, size_t Size){
+    BenchCase_t Case = {"export", "Export_Nodes", Variant, Size, 1U};
+    BenchResult_t Result;
+
+    if(Bench_Case_Enabled(Config, Case.CaseGroup, Case.CaseName)){
+        Bench_Measure(Config, Export_Bench_Export, NULL, Bench, Size, &Result);
+        Bench_Report(Config, &Case, &Result);
+    }
+}
+
+/*
+   This function Bench_Group_Export is the entry point of the "export" benchmark group.
+*/
+void Bench_Group_Export(BenchConfig_t *Config){
+    ExportBench_t Bench;
+    BenchResult_t Result;
+    FILE *NullFile = fopen(EXPORT_BENCH_NULL_DEVICE, "wb");
+    ListExporter_t *Exporter = (ListExporter_t *)malloc(sizeof(ListExporter_t));
+    size_t Size = 0;
+    size_t counter = 0;
+
+    if((NULL == NullFile)||(NULL == Exporter)){
+        printf("export: cannot open %s\n", EXPORT_BENCH_NULL_DEVICE);
+    }
+    else{
+        Bench.NodeHead = NULL;
+        Bench.Exporter = Exporter;
+        for(Size = Config->MinSize; Size <= Config->MaxSize; Size *= 10U){
+            BenchCase_t DisplayCase = {"export", "Display_All_Nodes", "printf", Size, 1U};
+            size_t Length = 0;
+
+            Get_Length_Wide(&Bench.NodeHead, &Length);
+            for(counter = Length; counter < Size; counter++){
+                uint32_t Value = (uint32_t)(counter * 2654435761U);  // Values of every length, half of them "negative" for %i
+
+                Insert_Node_At_Beginning(&Bench.NodeHead, &Value);
+            }
+
+            if(Bench_Case_Enabled(Config, DisplayCase.CaseGroup, DisplayCase.CaseName)){
+                Bench_Silence_Stdout();
+                Bench_Measure(Config, Export_Bench_Display, NULL, &Bench, Size, &Result);
+                Bench_Restore_Stdout();
+                Bench_Report(Config, &DisplayCase, &Result);
+            }
+            Export_Init_Fd(Exporter, fileno(NullFile), &Export_Arrow_Format);
+            Export_Bench_Case(Config, "arrow_fd", &Bench, Size);
+            Export_Init_File(Exporter, NullFile, &Export_Arrow_Format);
+            Export_Bench_Case(Config, "arrow_file", &Bench, Size);
+            Export_Init_Fd(Exporter, fileno(NullFile), &Export_Csv_Format);
+            Export_Bench_Case(Config, "csv_fd", &Bench, Size);
+
+            if(Size > (Config->MaxSize / 10U)){
+                break;  // Next power of ten would exceed MaxSize (or overflow)
+            }
+        }
+        while (NULL != Bench.NodeHead)
+        {
+            Delete_Node_At_Beginning(&Bench.NodeHead);
+        }
+    }
+    if(NULL != NullFile){
+        fclose(NullFile);
+    }
+    free(Exporter);
+}
\ No newline at end of file
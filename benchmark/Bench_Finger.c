@@ -0,0 +1,170 @@
+/* 
+ * File:   Bench_Finger.c
+ * Author: Mohammed Khairallah
+ * linkedin : linkedin.com/in/mohammed-khairallah
+ * Created on October 28, 2026, 9:30 AM
+ */
+
+/*
+   This file is the "finger" benchmark group: positional inserts and deletes on a list handle with local access patterns,
+   for lists of 10 ... min(Config->MaxSize, FINGER_BENCH_MAX_SIZE) nodes. Every case is timed per operation.
+   - Seq_Insert: List_Insert_Node_After at positions Size / 2, Size / 2 + 1, Size / 2 + 2 ...
+   - Seq_Delete: List_Delete_Node at positions Size / 2, Size / 2 + 1, Size / 2 + 2 ... (every other node of a run).
+   - Clustered:  inserts and deletes at random positions within FINGER_BENCH_WINDOW nodes of a center that
+                 starts at Size / 4 and moves one node forward every FINGER_BENCH_DRIFT operations.
+   - Random:     inserts and deletes at positions drawn from the whole list, where no cache can help.
+   Variants:
+       finger:  the list handle as it is, walks start from the finger when the target is at or beyond it.
+       head:    the finger is dropped before every call, so every walk starts from the head (the behavior without it).
+   The list is brought back to Size nodes after every sample.
+*/
+#include "Benchmark.h"
+
+#define FINGER_BENCH_MAX_SIZE (100000U)   /* Longest list (the head variant walks half of it per operation) */
+#define FINGER_BENCH_OPS (1000U)          /* Operations per sample */
+#define FINGER_BENCH_WINDOW (64U)         /* Width of the Clustered window */
+#define FINGER_BENCH_DRIFT (4U)           /* Clustered operations per step of the window */
+
+/* 
+   This typedef struct holds the list of the finger group.
+*/
+typedef struct{
+    List_t List;       /* list under test */
+    size_t Size;       /* length restored after every sample */
+    boolean NoFinger;  /* 1 for the head variant */
+    uint64_t Seed;     /* state of the position generator */
+}FingerBench_t;
+
+/* Function to draw the next pseudo-random number (xorshift64) */
+static uint64_t Finger_Bench_Random(FingerBench_t *Bench){
+    Bench->Seed ^= Bench->Seed << 13;
+    Bench->Seed ^= Bench->Seed >> 7;
+    Bench->Seed ^= Bench->Seed << 17;
+    return Bench->Seed;
+}
+
+/* Function to forget the finger in the head variant */
+static void Finger_Bench_Drop(FingerBench_t *Bench){
+    if(1U == Bench->NoFinger){
+        Bench->List.ListFinger = NULL;
+    }
+}
+
+static void Finger_Seq_Insert(void *Context, size_t Ops){
+    FingerBench_t *Bench = Context;
+    uint32_t Value = 0;
+    size_t counter = 0;
+
+    for(counter = 0; counter < Ops; counter++){
+        Finger_Bench_Drop(Bench);
+        Value = (uint32_t)counter;
+        List_Insert_Node_After(&Bench->List, (Bench->Size / 2U) + counter, &Value);
+    }
+}
+
+static void Finger_Seq_Delete(void *Context, size_t Ops){
+    FingerBench_t *Bench = Context;
+    size_t counter = 0;
+
+    for(counter = 0; counter < Ops; counter++){
+        Finger_Bench_Drop(Bench);
+        List_Delete_Node(&Bench->List, (Bench->Size / 2U) + counter);
+    }
+}
+
+/* Function to insert or delete (one draw decides) at a position of a window starting at Base */
+static void Finger_Bench_Step(FingerBench_t *Bench, size_t Base, size_t Window){
+    uint64_t Draw = Finger_Bench_Random(Bench);
+    size_t Position = Base + (size_t)((Draw >> 1) % ((0U == Window) ? 1U : Window));  // Random may drain a short list
+    uint32_t Value = (uint32_t)Draw;
+
+    Position = (Position > Bench->List.ListLength) ? Bench->List.ListLength : Position;
+    Position = (0U == Position) ? 1U : Position;
+    Finger_Bench_Drop(Bench);
+    if(0U == (Draw & 1U)){
+        List_Insert_Node_After(&Bench->List, Position, &Value);
+    }
+    else{
+        List_Delete_Node(&Bench->List, Position);
+    }
+}
+
+static void Finger_Clustered(void *Context, size_t Ops){
+    FingerBench_t *Bench = Context;
+    size_t counter = 0;
+
+    for(counter = 0; counter < Ops; counter++){
+        Finger_Bench_Step(Bench, (Bench->Size / 4U) + (counter / FINGER_BENCH_DRIFT), FINGER_BENCH_WINDOW);
+    }
+}
+
+static void Finger_Random(void *Context, size_t Ops){
+    FingerBench_t *Bench = Context;
+    size_t counter = 0;
+
+    for(counter = 0; counter < Ops; counter++){
+        Finger_Bench_Step(Bench, 1U, Bench->List.ListLength);
+    }
+}
+
+/* Function to bring the list back to Size nodes (at the end, which needs no walk) */
+static void Finger_Restore(void *Context, size_t Ops){
+    FingerBench_t *Bench = Context;
+    uint32_t Value = 0;
+
+    (void)Ops;
+    while (Bench->List.ListLength > Bench->Size)
+    {
+        List_Delete_Node_At_Beginning(&Bench->List);
+    }
+    while (Bench->List.ListLength < Bench->Size)
+    {
+        Value = (uint32_t)Bench->List.ListLength;
+        List_Insert_Node_At_End(&Bench->List, &Value);
+    }
+}
+
+/* Function to time one case with and without the finger and report both */
+static void Finger_Bench_Case(BenchConfig_t *Config, const char *CaseName, BenchRun_t Run, FingerBench_t *Bench){
+    BenchCase_t FingerCase = {"finger", CaseName, "finger", Bench->Size, 1U};
+    BenchCase_t HeadCase = {"finger", CaseName, "head", Bench->Size, 1U};
+    BenchResult_t Result;
+
+    if(Bench_Case_Enabled(Config, FingerCase.CaseGroup, FingerCase.CaseName)){
+        Bench->NoFinger = 0;
+        Bench_Measure(Config, Run, Finger_Restore, Bench, FINGER_BENCH_OPS, &Result);
+        Bench_Report(Config, &FingerCase, &Result);
+        Bench->NoFinger = 1;
+        Bench_Measure(Config, Run, Finger_Restore, Bench, FINGER_BENCH_OPS, &Result);
+        Bench_Report(Config, &HeadCase, &Result);
+    }
+}
+
+/*
+   This function Bench_Group_Finger is the entry point of the "finger" benchmark group.
+*/
+void Bench_Group_Finger(BenchConfig_t *Config){
+    FingerBench_t Bench;
+    size_t Size = 0;
+
+    List_Init(&Bench.List);
+    Bench.Seed = 0x9E3779B97F4A7C15ULL;
+    for(Size = Config->MinSize; (Size <= Config->MaxSize) && (Size <= FINGER_BENCH_MAX_SIZE); Size *= 10U){
+        Bench.Size = Size;
+        Finger_Restore(&Bench, 0U);
+        if(Bench.List.ListLength != Size){
+            printf("finger: out of memory at %zu values\n", Size);
+            break;
+        }
+        if(Size >= (2U * FINGER_BENCH_OPS)){  /* The sequential runs must fit in the second half of the list */
+            Finger_Bench_Case(Config, "Seq_Insert", Finger_Seq_Insert, &Bench);
+            Finger_Bench_Case(Config, "Seq_Delete", Finger_Seq_Delete, &Bench);
+        }
+        Finger_Bench_Case(Config, "Clustered", Finger_Clustered, &Bench);
+        Finger_Bench_Case(Config, "Random", Finger_Random, &Bench);
+        if(Size > (Config->MaxSize / 10U)){
+            break;  // Next power of ten would exceed MaxSize (or overflow)
+        }
+    }
+    List_Clear(&Bench.List);
+}
\ No newline at end of file
@@ -0,0 +1,182 @@
+/* 
+ * File:   Bench_Generic.c
+ * Author: Mohammed Khairallah
+ * linkedin : linkedin.com/in/mohammed-khairallah
+ * Created on October 25, 2026, 10:00 AM
+ */
+
+/*
+   This file is the "generic" benchmark group: storing elements of different sizes, 10 ... Config->MaxSize elements.
+   - Insert_End: building the list with one append per element (Generic_Clear between samples, not timed).
+   - Sum:        walking the whole list and adding up the first 4 bytes of every element.
+   Variants:
+       list:             List_t and Node_t, the existing uint32_t list.
+       gen_4:            GenericList_t with 4-byte elements, the same data through the generic code (fast path).
+       gen_16 / gen_64:  GenericList_t with 16- and 64-byte records stored inline in the node.
+       gen_24:           a size without its own fast path (run-time memcpy length).
+       ptr_16 / ptr_64:  GenericList_t of pointers to records malloc'ed one by one, the layout needed without inline
+                         payloads: two allocations per element and one more dependent load per step of a walk.
+*/
+#include <string.h>
+#include "Benchmark.h"
+#include "GenericList.h"
+
+#define GENERIC_BENCH_MAX_RECORD (64U)  /* Largest record of the group */
+
+/* 
+   This typedef struct holds the lists of the generic group.
+*/
+typedef struct{
+    List_t List;                                       /* uint32_t list */
+    GenericList_t Generic;                             /* list under test */
+    size_t Size;                                       /* number of elements */
+    size_t RecordSize;                                 /* bytes per record (ptr variants: bytes per pointed-to record) */
+    boolean Indirect;                                  /* 1 when Generic holds pointers to separate records */
+    unsigned char Record[GENERIC_BENCH_MAX_RECORD];    /* element template, the first 4 bytes are the key */
+    uint64_t Sink;                                     /* sums are folded in here so no walk can be skipped */
+}GenericBench_t;
+
+static void Generic_List_Insert(void *Context, size_t Ops){
+    GenericBench_t *Bench = Context;
+    uint32_t counter = 0;
+
+    for(counter = 0; counter < (uint32_t)Ops; counter++){
+        List_Insert_Node_At_End(&Bench->List, &counter);
+    }
+}
+
+static void Generic_List_Clear(void *Context, size_t Ops){
+    GenericBench_t *Bench = Context;
+
+    (void)Ops;
+    List_Clear(&Bench->List);
+}
+
+static void Generic_List_Sum(void *Context, size_t Ops){
+    GenericBench_t *Bench = Context;
+    Node_t *NodeCopy = Bench->List.ListHead;
+    uint64_t Sum = 0;
+
+    (void)Ops;
+    while (NULL != NodeCopy)
+    {
+        Sum += NodeCopy->NodeData;
+        NodeCopy = NodeCopy->NodeLink;
+    }
+    Bench->Sink += Sum;
+}
+
+static void Generic_Insert(void *Context, size_t Ops){
+    GenericBench_t *Bench = Context;
+    uint32_t counter = 0;
+
+    for(counter = 0; counter < (uint32_t)Ops; counter++){
+        memcpy(Bench->Record, &counter, sizeof(uint32_t));
+        if(1U == Bench->Indirect){
+            void *Record = malloc(Bench->RecordSize);
+
+            if(NULL != Record){
+                memcpy(Record, Bench->Record, Bench->RecordSize);
+                Generic_Insert_Node_At_End(&Bench->Generic, &Record);
+            }
+        }
+        else{
+            Generic_Insert_Node_At_End(&Bench->Generic, Bench->Record);
+        }
+    }
+}
+
+static void Generic_Clear_Records(void *Context, size_t Ops){
+    GenericBench_t *Bench = Context;
+    GenericNode_t *NodeCopy = Bench->Generic.ListHead;
+
+    (void)Ops;
+    while ((1U == Bench->Indirect) && (NULL != NodeCopy))
+    {
+        void *Record = NULL;
+
+        memcpy(&Record, NodeCopy->NodePayload, sizeof(void *));
+        free(Record);
+        NodeCopy = NodeCopy->NodeLink;
+    }
+    Generic_Clear(&Bench->Generic);
+}
+
+static void Generic_Sum(void *Context, size_t Ops){
+    GenericBench_t *Bench = Context;
+    GenericNode_t *NodeCopy = Bench->Generic.ListHead;
+    uint64_t Sum = 0;
+    uint32_t Key = 0;
+    void *Record = NULL;
+
+    (void)Ops;
+    while (NULL != NodeCopy)
+    {
+        if(1U == Bench->Indirect){
+            memcpy(&Record, NodeCopy->NodePayload, sizeof(void *));
+            memcpy(&Key, Record, sizeof(uint32_t));
+        }
+        else{
+            memcpy(&Key, NodeCopy->NodePayload, sizeof(uint32_t));
+        }
+        Sum += Key;
+        NodeCopy = NodeCopy->NodeLink;
+    }
+    Bench->Sink += Sum;
+}
+
+/* Function to time one case and report it */
+static void Generic_Bench_Case(BenchConfig_t *Config, const char *CaseName, const char *Variant, BenchRun_t Run,
+                               BenchRestore_t Restore, GenericBench_t *Bench){
+    BenchCase_t Case = {"generic", CaseName, Variant, Bench->Size, 1U};
+    BenchResult_t Result;
+
+    if(Bench_Case_Enabled(Config, Case.CaseGroup, Case.CaseName)){
+        Bench_Measure(Config, Run, Restore, Bench, Bench->Size, &Result);
+        Bench_Report(Config, &Case, &Result);
+    }
+}
+
+/* Function to run both cases on a generic list of RecordSize-byte records, inline or behind a pointer */
+static void Generic_Bench_Variant(BenchConfig_t *Config, const char *Variant, size_t RecordSize, boolean Indirect,
+                                  GenericBench_t *Bench){
+    Bench->RecordSize = RecordSize;
+    Bench->Indirect = Indirect;
+    Generic_Init(&Bench->Generic, (1U == Indirect) ? sizeof(void *) : RecordSize);
+    Generic_Bench_Case(Config, "Insert_End", Variant, Generic_Insert, Generic_Clear_Records, Bench);
+    Generic_Insert(Bench, Bench->Size);
+    Generic_Bench_Case(Config, "Sum", Variant, Generic_Sum, NULL, Bench);
+    Generic_Clear_Records(Bench, 0U);
+}
+
+/*
+   This function Bench_Group_Generic is the entry point of the "generic" benchmark group.
+*/
+void Bench_Group_Generic(BenchConfig_t *Config){
+    GenericBench_t Bench;
+    size_t Size = 0;
+
+    List_Init(&Bench.List);
+    memset(Bench.Record, 0xA5, sizeof(Bench.Record));
+    Bench.Sink = 0;
+    for(Size = Config->MinSize; Size <= Config->MaxSize; Size *= 10U){
+        Bench.Size = Size;
+        Generic_Bench_Case(Config, "Insert_End", "list", Generic_List_Insert, Generic_List_Clear, &Bench);
+        Generic_List_Insert(&Bench, Size);
+        Generic_Bench_Case(Config, "Sum", "list", Generic_List_Sum, NULL, &Bench);
+        List_Clear(&Bench.List);
+
+        Generic_Bench_Variant(Config, "gen_4", 4U, 0U, &Bench);
+        Generic_Bench_Variant(Config, "gen_16", 16U, 0U, &Bench);
+        Generic_Bench_Variant(Config, "gen_24", 24U, 0U, &Bench);
+        Generic_Bench_Variant(Config, "gen_64", 64U, 0U, &Bench);
+        Generic_Bench_Variant(Config, "ptr_16", 16U, 1U, &Bench);
+        Generic_Bench_Variant(Config, "ptr_64", 64U, 1U, &Bench);
+        if(Size > (Config->MaxSize / 10U)){
+            break;  // Next power of ten would exceed MaxSize (or overflow)
+        }
+    }
+    if(0U == Bench.Sink){
+        printf("generic: no elements summed\n");
+    }
+}
\ No newline at end of file
@@ -0,0 +1,453 @@
+/* 
+ * File:   Bench_List.c
+ * Author: Mohammed Khairallah
+ * linkedin : linkedin.com/in/mohammed-khairallah
+ * Created on October 18, 2026, 2:00 PM
+ */
+
+/*
+   This file is the "list" benchmark group: every operation of SingleLinkedList.h, measured on lists of
+   10, 100, ... up to Config->MaxSize nodes, for four variants:
+   - raw:    the Node_t ** functions (the size_t entry points, so every size is addressable),
+   - handle: the List_t functions with malloc/free,
+   - pooled: the List_t functions with a NodePool_t attached,
+   - compact: the CompactList_t functions (8-byte nodes with uint32_t index links in one array).
+   Every sample starts from a list of exactly the given size: the untimed restore step undoes the timed operations.
+*/
+#include "Benchmark.h"
+#include "NodePool.h"
+#include "CompactList.h"
+
+#define LIST_BENCH_CONSTANT_OPS (1000U)      /* Operations per sample for O(1) operations */
+#define LIST_BENCH_LINEAR_BUDGET (100000U)   /* Node visits per sample for O(n) operations */
+
+/* 
+   This typedef struct holds the lists of one variant at one size.
+*/
+typedef struct{
+    Node_t *NodeHead;   /* raw list */
+    List_t List;        /* handle list (handle and pooled variants) */
+    NodePool_t Pool;    /* pool of the pooled variant */
+    CompactList_t Compact;  /* compact list */
+    size_t Size;        /* size every sample starts from */
+    uint32_t Value;     /* value inserted by the timed operations */
+}ListBench_t;
+
+/* 
+   This typedef struct describes one measured operation.
+*/
+typedef struct{
+    const char *OpName;       /* reported operation name */
+    BenchRun_t OpRun;         /* timed part */
+    BenchRestore_t OpRestore; /* untimed part */
+    int OpLinear;             /* non-zero if one operation walks the list */
+    int OpGrows;              /* non-zero if the operation adds nodes */
+    int OpShrinks;            /* non-zero if the operation removes nodes (at most Size / 2 per sample) */
+    int OpPrints;             /* non-zero if the operation writes to stdout */
+}ListBenchOp_t;
+
+/* Function to remove every node after position Size of the raw list in one walk */
+static void Raw_Truncate(ListBench_t *Bench){
+    Node_t *NodeCopy = Bench->NodeHead;
+    Node_t *NextNode = NULL;
+    size_t counter = 1;
+
+    while (counter < Bench->Size)
+    {
+        NodeCopy = NodeCopy->NodeLink;
+        counter++;
+    }
+    NextNode = NodeCopy->NodeLink;
+    NodeCopy->NodeLink = NULL;
+    while (NULL != NextNode)
+    {
+        NodeCopy = NextNode->NodeLink;
+        free(NextNode);
+        NextNode = NodeCopy;
+    }
+}
+
+/* Function to remove every node after position Size of the handle list in one walk */
+static void Handle_Truncate(ListBench_t *Bench){
+    Node_t *NodeCopy = Bench->List.ListHead;
+    Node_t *RemovedNode = NULL;
+    size_t counter = 1;
+
+    while (counter < Bench->Size)
+    {
+        NodeCopy = NodeCopy->NodeLink;
+        counter++;
+    }
+    while (NODE_OK == List_Unlink_Node_After(&Bench->List, NodeCopy, &RemovedNode))
+    {
+        if(NULL != Bench->List.ListPool){
+            NodePool_Free(Bench->List.ListPool, RemovedNode);
+        }
+        else{
+            free(RemovedNode);
+        }
+    }
+}
+
+/* Function to remove every node after position Size of the compact list in one walk */
+static void Compact_Truncate(ListBench_t *Bench){
+    CompactList_t *List = &Bench->Compact;
+    uint32_t Index = List->ListHead;
+    uint32_t NextIndex = COMPACT_NULL_INDEX;
+    size_t counter = 1;
+
+    while (counter < Bench->Size)
+    {
+        Index = List->ListNodes[Index].NodeLink;
+        counter++;
+    }
+    NextIndex = List->ListNodes[Index].NodeLink;
+    List->ListNodes[Index].NodeLink = COMPACT_NULL_INDEX;
+    List->ListTail = Index;
+    while (COMPACT_NULL_INDEX != NextIndex)
+    {
+        Index = NextIndex;
+        NextIndex = List->ListNodes[Index].NodeLink;
+        List->ListNodes[Index].NodeLink = List->ListFree;  // Give the slot back to the free list
+        List->ListFree = Index;
+        List->ListLength--;
+    }
+}
+
+/* ---- raw variant ---- */
+
+static void Raw_Insert_At_Beginning(void *Context, size_t Ops){
+    ListBench_t *Bench = Context;
+    size_t counter = 0;
+
+    for(counter = 0; counter < Ops; counter++){
+        Insert_Node_At_Beginning(&Bench->NodeHead, &Bench->Value);
+    }
+}
+
+static void Raw_Delete_At_Beginning(void *Context, size_t Ops){
+    ListBench_t *Bench = Context;
+    size_t counter = 0;
+
+    for(counter = 0; counter < Ops; counter++){
+        Delete_Node_At_Beginning(&Bench->NodeHead);
+    }
+}
+
+static void Raw_Insert_At_End(void *Context, size_t Ops){
+    ListBench_t *Bench = Context;
+    size_t counter = 0;
+
+    for(counter = 0; counter < Ops; counter++){
+        Insert_Node_At_End(&Bench->NodeHead, &Bench->Value);
+    }
+}
+
+static void Raw_Restore_Truncate(void *Context, size_t Ops){
+    (void)Ops;
+    Raw_Truncate(Context);
+}
+
+static void Raw_Insert_After_Middle(void *Context, size_t Ops){
+    ListBench_t *Bench = Context;
+    size_t counter = 0;
+
+    for(counter = 0; counter < Ops; counter++){
+        Insert_Node_After_Wide(&Bench->NodeHead, Bench->Size / 2U, &Bench->Value);
+    }
+}
+
+static void Raw_Delete_Middle(void *Context, size_t Ops){
+    ListBench_t *Bench = Context;
+    size_t counter = 0;
+
+    for(counter = 0; counter < Ops; counter++){
+        Delete_Node_Wide(&Bench->NodeHead, Bench->Size / 2U);
+    }
+}
+
+static void Raw_Display(void *Context, size_t Ops){
+    ListBench_t *Bench = Context;
+    size_t counter = 0;
+
+    for(counter = 0; counter < Ops; counter++){
+        Display_All_Nodes(Bench->NodeHead);
+    }
+}
+
+static void Raw_Get_Length(void *Context, size_t Ops){
+    ListBench_t *Bench = Context;
+    size_t Length = 0;
+    size_t counter = 0;
+
+    for(counter = 0; counter < Ops; counter++){
+        Get_Length_Wide(&Bench->NodeHead, &Length);
+    }
+}
+
+/* ---- handle and pooled variants ---- */
+
+static void Handle_Insert_At_Beginning(void *Context, size_t Ops){
+    ListBench_t *Bench = Context;
+    size_t counter = 0;
+
+    for(counter = 0; counter < Ops; counter++){
+        List_Insert_Node_At_Beginning(&Bench->List, &Bench->Value);
+    }
+}
+
+static void Handle_Delete_At_Beginning(void *Context, size_t Ops){
+    ListBench_t *Bench = Context;
+    size_t counter = 0;
+
+    for(counter = 0; counter < Ops; counter++){
+        List_Delete_Node_At_Beginning(&Bench->List);
+    }
+}
+
+static void Handle_Insert_At_End(void *Context, size_t Ops){
+    ListBench_t *Bench = Context;
+    size_t counter = 0;
+
+    for(counter = 0; counter < Ops; counter++){
+        List_Insert_Node_At_End(&Bench->List, &Bench->Value);
+    }
+}
+
+static void Handle_Restore_Truncate(void *Context, size_t Ops){
+    (void)Ops;
+    Handle_Truncate(Context);
+}
+
+static void Handle_Insert_After_Middle(void *Context, size_t Ops){
+    ListBench_t *Bench = Context;
+    size_t counter = 0;
+
+    for(counter = 0; counter < Ops; counter++){
+        List_Insert_Node_After(&Bench->List, Bench->Size / 2U, &Bench->Value);
+    }
+}
+
+static void Handle_Delete_Middle(void *Context, size_t Ops){
+    ListBench_t *Bench = Context;
+    size_t counter = 0;
+
+    for(counter = 0; counter < Ops; counter++){
+        List_Delete_Node(&Bench->List, Bench->Size / 2U);
+    }
+}
+
+static void Handle_Display(void *Context, size_t Ops){
+    ListBench_t *Bench = Context;
+    size_t counter = 0;
+
+    for(counter = 0; counter < Ops; counter++){
+        List_Display_All_Nodes(&Bench->List);
+    }
+}
+
+static void Handle_Get_Length(void *Context, size_t Ops){
+    ListBench_t *Bench = Context;
+    size_t Length = 0;
+    size_t counter = 0;
+
+    for(counter = 0; counter < Ops; counter++){
+        List_Get_Length(&Bench->List, &Length);
+    }
+}
+
+/* ---- compact variant ---- */
+
+static void Compact_Insert_At_Beginning(void *Context, size_t Ops){
+    ListBench_t *Bench = Context;
+    size_t counter = 0;
+
+    for(counter = 0; counter < Ops; counter++){
+        Compact_Insert_Node_At_Beginning(&Bench->Compact, &Bench->Value);
+    }
+}
+
+static void Compact_Delete_At_Beginning(void *Context, size_t Ops){
+    ListBench_t *Bench = Context;
+    size_t counter = 0;
+
+    for(counter = 0; counter < Ops; counter++){
+        Compact_Delete_Node_At_Beginning(&Bench->Compact);
+    }
+}
+
+static void Compact_Insert_At_End(void *Context, size_t Ops){
+    ListBench_t *Bench = Context;
+    size_t counter = 0;
+
+    for(counter = 0; counter < Ops; counter++){
+        Compact_Insert_Node_At_End(&Bench->Compact, &Bench->Value);
+    }
+}
+
+static void Compact_Restore_Truncate(void *Context, size_t Ops){
+    (void)Ops;
+    Compact_Truncate(Context);
+}
+
+static void Compact_Insert_After_Middle(void *Context, size_t Ops){
+    ListBench_t *Bench = Context;
+    size_t counter = 0;
+
+    for(counter = 0; counter < Ops; counter++){
+        Compact_Insert_Node_After(&Bench->Compact, Bench->Size / 2U, &Bench->Value);
+    }
+}
+
+static void Compact_Delete_Middle(void *Context, size_t Ops){
+    ListBench_t *Bench = Context;
+    size_t counter = 0;
+
+    for(counter = 0; counter < Ops; counter++){
+        Compact_Delete_Node(&Bench->Compact, Bench->Size / 2U);
+    }
+}
+
+static void Compact_Display(void *Context, size_t Ops){
+    ListBench_t *Bench = Context;
+    size_t counter = 0;
+
+    for(counter = 0; counter < Ops; counter++){
+        Compact_Display_All_Nodes(&Bench->Compact);
+    }
+}
+
+static void Compact_Length(void *Context, size_t Ops){
+    ListBench_t *Bench = Context;
+    size_t Length = 0;
+    size_t counter = 0;
+
+    for(counter = 0; counter < Ops; counter++){
+        Compact_Get_Length(&Bench->Compact, &Length);
+    }
+}
+
+static const ListBenchOp_t RawOps[] = {
+    {"Insert_Node_At_Beginning", Raw_Insert_At_Beginning, Raw_Delete_At_Beginning, 0, 1, 0, 0},
+    {"Insert_Node_At_End",       Raw_Insert_At_End,       Raw_Restore_Truncate,    1, 1, 0, 0},
+    {"Insert_Node_After_Wide",   Raw_Insert_After_Middle, Raw_Restore_Truncate,    1, 1, 0, 0},
+    {"Delete_Node_At_Beginning", Raw_Delete_At_Beginning, Raw_Insert_At_Beginning, 0, 0, 1, 0},
+    {"Delete_Node_Wide",         Raw_Delete_Middle,       Raw_Insert_At_Beginning, 1, 0, 1, 0},
+    {"Display_All_Nodes",        Raw_Display,             NULL,                    1, 0, 0, 1},
+    {"Get_Length_Wide",          Raw_Get_Length,          NULL,                    1, 0, 0, 0},
+};
+
+static const ListBenchOp_t HandleOps[] = {
+    {"List_Insert_Node_At_Beginning", Handle_Insert_At_Beginning, Handle_Delete_At_Beginning, 0, 1, 0, 0},
+    {"List_Insert_Node_At_End",       Handle_Insert_At_End,       Handle_Restore_Truncate,    0, 1, 0, 0},
+    {"List_Insert_Node_After",        Handle_Insert_After_Middle, Handle_Restore_Truncate,    1, 1, 0, 0},
+    {"List_Delete_Node_At_Beginning", Handle_Delete_At_Beginning, Handle_Insert_At_Beginning, 0, 0, 1, 0},
+    {"List_Delete_Node",              Handle_Delete_Middle,       Handle_Insert_At_Beginning, 1, 0, 1, 0},
+    {"List_Display_All_Nodes",        Handle_Display,             NULL,                       1, 0, 0, 1},
+    {"List_Get_Length",               Handle_Get_Length,          NULL,                       0, 0, 0, 0},
+};
+
+static const ListBenchOp_t CompactOps[] = {
+    {"Compact_Insert_Node_At_Beginning", Compact_Insert_At_Beginning, Compact_Delete_At_Beginning, 0, 1, 0, 0},
+    {"Compact_Insert_Node_At_End",       Compact_Insert_At_End,       Compact_Restore_Truncate,    0, 1, 0, 0},
+    {"Compact_Insert_Node_After",        Compact_Insert_After_Middle, Compact_Restore_Truncate,    1, 1, 0, 0},
+    {"Compact_Delete_Node_At_Beginning", Compact_Delete_At_Beginning, Compact_Insert_At_Beginning, 0, 0, 1, 0},
+    {"Compact_Delete_Node",              Compact_Delete_Middle,       Compact_Insert_At_Beginning, 1, 0, 1, 0},
+    {"Compact_Display_All_Nodes",        Compact_Display,             NULL,                        1, 0, 0, 1},
+    {"Compact_Get_Length",               Compact_Length,              NULL,                        0, 0, 0, 0},
+};
+
+/* Function to choose how many operations one sample times */
+static size_t List_Bench_Ops_Per_Sample(const ListBenchOp_t *Op, size_t Size){
+    size_t Ops = Op->OpLinear ? (LIST_BENCH_LINEAR_BUDGET / Size) : LIST_BENCH_CONSTANT_OPS;
+
+    if(Ops > LIST_BENCH_CONSTANT_OPS){
+        Ops = LIST_BENCH_CONSTANT_OPS;
+    }
+    if(Op->OpShrinks && (Ops > (Size / 2U))){
+        Ops = Size / 2U;  // Deleting must not run past the measured position
+    }
+    if(Op->OpLinear && (Op->OpGrows || Op->OpShrinks) && (Ops > (Size / 10U))){
+        Ops = Size / 10U;  // The list may drift by at most 10% of its size during one sample
+    }
+    return (0U == Ops) ? 1U : Ops;
+}
+
+/* Function to run every operation of a table on one variant and one size */
+static void List_Bench_Run_Ops(BenchConfig_t *Config, const char *Variant, const ListBenchOp_t *Ops, size_t OpCount,
+                               ListBench_t *Bench){
+    size_t counter = 0;
+
+    for(counter = 0; counter < OpCount; counter++){
+        BenchCase_t Case = {"list", Ops[counter].OpName, Variant, Bench->Size, 1U};
+        BenchResult_t Result;
+
+        if(Bench_Case_Enabled(Config, Case.CaseGroup, Case.CaseName)){
+            if(Ops[counter].OpPrints){
+                Bench_Silence_Stdout();
+            }
+            Bench_Measure(Config, Ops[counter].OpRun, Ops[counter].OpRestore, Bench,
+                          List_Bench_Ops_Per_Sample(&Ops[counter], Bench->Size), &Result);
+            if(Ops[counter].OpPrints){
+                Bench_Restore_Stdout();
+            }
+            Bench_Report(Config, &Case, &Result);
+        }
+    }
+}
+
+/*
+   This function Bench_Group_List is the entry point of the "list" benchmark group.
+*/
+void Bench_Group_List(BenchConfig_t *Config){
+    ListBench_t Bench;
+    size_t Size = 0;
+    size_t counter = 0;
+
+    Bench.Value = 0x5A5A5A5AU;
+    for(Size = Config->MinSize; Size <= Config->MaxSize; Size *= 10U){
+        Bench.Size = Size;
+
+        /* raw variant */
+        Bench.NodeHead = NULL;
+        for(counter = 0; counter < Size; counter++){
+            Insert_Node_At_Beginning(&Bench.NodeHead, &Bench.Value);
+        }
+        List_Bench_Run_Ops(Config, "raw", RawOps, sizeof(RawOps) / sizeof(RawOps[0]), &Bench);
+        while (NULL != Bench.NodeHead)
+        {
+            Delete_Node_At_Beginning(&Bench.NodeHead);
+        }
+
+        /* handle variant */
+        List_Init(&Bench.List);
+        for(counter = 0; counter < Size; counter++){
+            List_Insert_Node_At_End(&Bench.List, &Bench.Value);
+        }
+        List_Bench_Run_Ops(Config, "handle", HandleOps, sizeof(HandleOps) / sizeof(HandleOps[0]), &Bench);
+        List_Clear(&Bench.List);
+
+        /* pooled variant */
+        NodePool_Init(&Bench.Pool, 0U);
+        List_Use_Pool(&Bench.List, &Bench.Pool);
+        for(counter = 0; counter < Size; counter++){
+            List_Insert_Node_At_End(&Bench.List, &Bench.Value);
+        }
+        List_Bench_Run_Ops(Config, "pooled", HandleOps, sizeof(HandleOps) / sizeof(HandleOps[0]), &Bench);
+        List_Clear(&Bench.List);
+        NodePool_Destroy(&Bench.Pool);
+
+        /* compact variant */
+        Compact_Init(&Bench.Compact);
+        Compact_Reserve(&Bench.Compact, Size);
+        for(counter = 0; counter < Size; counter++){
+            Compact_Insert_Node_At_End(&Bench.Compact, &Bench.Value);
+        }
+        List_Bench_Run_Ops(Config, "compact", CompactOps, sizeof(CompactOps) / sizeof(CompactOps[0]), &Bench);
+        Compact_Clear(&Bench.Compact);
+
+        if(Size > (Config->MaxSize / 10U)){
+            break;  // Next power of ten would exceed MaxSize (or overflow)
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,156 @@
+/* 
+ * File:   Bench_Lookup.c
+ * Author: Mohammed Khairallah
+ * linkedin : linkedin.com/in/mohammed-khairallah
+ * Created on October 21, 2026, 6:00 PM
+ */
+
+/*
+   This file is the "lookup" benchmark group: finding and removing nodes by value in lists of 10 ... Config->MaxSize
+   distinct values. Lookups pick values of the list in a pseudo-random order.
+   - Find:          List_Find_By_Value; walk = no index, indexed = with a ListIndex_t attached.
+   - Delete_Insert: removing a value and appending it again, so the list keeps its size.
+                    position = Find_By_Value then List_Delete_Node (two walks), walk = List_Delete_By_Value without index,
+                    indexed = List_Delete_By_Value with the index.
+   - Insert_At_End: building the list with List_Insert_Node_At_End, plain or indexed, to show what keeping the index costs.
+   Walking variants only run up to 10^5 nodes.
+*/
+#include "Benchmark.h"
+#include "ListIndex.h"
+
+#define LOOKUP_BENCH_OPS (1000U)         /* Lookups per sample */
+#define LOOKUP_BENCH_MAX_WALK (100000U)  /* Largest list searched by walking */
+
+/* 
+   This typedef struct holds the list and values of the lookup group.
+*/
+typedef struct{
+    List_t List;        /* list being searched */
+    ListIndex_t Index;  /* index for the indexed variants */
+    uint32_t *Values;   /* list contents, all distinct */
+    size_t Size;        /* number of values */
+    uint64_t Next;      /* lookup generator state */
+}LookupBench_t;
+
+/* Function to pick the value of the next lookup (xorshift, so moved values do not line up at the head) */
+static uint32_t *Lookup_Next_Value(LookupBench_t *Bench){
+    Bench->Next ^= Bench->Next << 13;
+    Bench->Next ^= Bench->Next >> 7;
+    Bench->Next ^= Bench->Next << 17;
+    return &Bench->Values[Bench->Next % Bench->Size];
+}
+
+static void Lookup_Find(void *Context, size_t Ops){
+    LookupBench_t *Bench = Context;
+    Node_t *FoundNode = NULL;
+    size_t counter = 0;
+
+    for(counter = 0; counter < Ops; counter++){
+        List_Find_By_Value(&Bench->List, Lookup_Next_Value(Bench), &FoundNode);
+    }
+}
+
+static void Lookup_Delete_Position(void *Context, size_t Ops){
+    LookupBench_t *Bench = Context;
+    size_t Position = 0;
+    size_t counter = 0;
+
+    for(counter = 0; counter < Ops; counter++){
+        uint32_t *Value = Lookup_Next_Value(Bench);
+
+        if(NODE_OK == Find_By_Value(Bench->List.ListHead, Value, &Position)){
+            List_Delete_Node(&Bench->List, Position);
+        }
+        List_Insert_Node_At_End(&Bench->List, Value);
+    }
+}
+
+static void Lookup_Delete_Value(void *Context, size_t Ops){
+    LookupBench_t *Bench = Context;
+    size_t counter = 0;
+
+    for(counter = 0; counter < Ops; counter++){
+        uint32_t *Value = Lookup_Next_Value(Bench);
+
+        List_Delete_By_Value(&Bench->List, Value);
+        List_Insert_Node_At_End(&Bench->List, Value);
+    }
+}
+
+static void Lookup_Insert_At_End(void *Context, size_t Ops){
+    LookupBench_t *Bench = Context;
+    size_t counter = 0;
+
+    for(counter = 0; counter < Ops; counter++){
+        List_Insert_Node_At_End(&Bench->List, &Bench->Values[counter]);
+    }
+}
+
+static void Lookup_Clear(void *Context, size_t Ops){
+    LookupBench_t *Bench = Context;
+
+    (void)Ops;
+    List_Clear(&Bench->List);
+}
+
+/* Function to time one case and report it */
+static void Lookup_Bench_Case(BenchConfig_t *Config, const char *CaseName, const char *Variant, BenchRun_t Run,
+                              BenchRestore_t Restore, size_t Ops, LookupBench_t *Bench){
+    BenchCase_t Case = {"lookup", CaseName, Variant, Bench->Size, 1U};
+    BenchResult_t Result;
+
+    if(Bench_Case_Enabled(Config, Case.CaseGroup, Case.CaseName)){
+        Bench_Measure(Config, Run, Restore, Bench, Ops, &Result);
+        Bench_Report(Config, &Case, &Result);
+    }
+}
+
+/* Function to run the cases of one variant: Index is NULL for the walking variants */
+static void Lookup_Bench_Variant(BenchConfig_t *Config, const char *Variant, ListIndex_t *Index, LookupBench_t *Bench){
+    List_Use_Index(&Bench->List, Index);
+    Lookup_Bench_Case(Config, "Insert_At_End", (NULL == Index) ? "plain" : Variant, Lookup_Insert_At_End, Lookup_Clear,
+                      Bench->Size, Bench);
+    List_Insert_Nodes_At_End(&Bench->List, Bench->Values, Bench->Size);
+    if((NULL != Index) || (Bench->Size <= LOOKUP_BENCH_MAX_WALK)){
+        Lookup_Bench_Case(Config, "Find", Variant, Lookup_Find, NULL, LOOKUP_BENCH_OPS, Bench);
+        if(NULL == Index){
+            Lookup_Bench_Case(Config, "Delete_Insert", "position", Lookup_Delete_Position, NULL, LOOKUP_BENCH_OPS, Bench);
+        }
+        Lookup_Bench_Case(Config, "Delete_Insert", Variant, Lookup_Delete_Value, NULL, LOOKUP_BENCH_OPS, Bench);
+    }
+    List_Clear(&Bench->List);
+    List_Use_Index(&Bench->List, NULL);
+}
+
+/*
+   This function Bench_Group_Lookup is the entry point of the "lookup" benchmark group.
+*/
+void Bench_Group_Lookup(BenchConfig_t *Config){
+    LookupBench_t Bench;
+    size_t Size = 0;
+    size_t counter = 0;
+
+    List_Init(&Bench.List);
+    for(Size = Config->MinSize; Size <= Config->MaxSize; Size *= 10U){
+        Bench.Size = Size;
+        Bench.Next = 88172645463325252ULL;
+        Bench.Values = (uint32_t *)malloc(Size * sizeof(uint32_t));
+        if((NULL == Bench.Values)||(NODE_OK != List_Index_Init(&Bench.Index, Size))){
+            printf("lookup: out of memory at %zu values\n", Size);
+            free(Bench.Values);
+            break;
+        }
+        for(counter = 0; counter < Size; counter++){
+            Bench.Values[counter] = (uint32_t)(counter * 2654435761U);  // Distinct, as 2654435761 is odd
+        }
+
+        Lookup_Bench_Variant(Config, "walk", NULL, &Bench);
+        Lookup_Bench_Variant(Config, "indexed", &Bench.Index, &Bench);
+
+        List_Index_Destroy(&Bench.Index);
+        free(Bench.Values);
+        if(Size > (Config->MaxSize / 10U)){
+            break;  // Next power of ten would exceed MaxSize (or overflow)
+        }
+    }
+}
\ No newline at end of file
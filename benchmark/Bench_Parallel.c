@@ -0,0 +1,229 @@
+/* 
+ * File:   Bench_Parallel.c
+ * Author: Mohammed Khairallah
+ * linkedin : linkedin.com/in/mohammed-khairallah
+ * Created on October 26, 2026, 4:30 PM
+ */
+
+/*
+   This file is the "parallel" benchmark group: bulk operations over a list handle on 1 ... Config->MaxThreads threads,
+   10 ... Config->MaxSize nodes (scaling shows from 10^6 nodes on; run with --max-size 10000000 for 10^7).
+   Every case is timed per node.
+   - Sum:       adding up all values (Parallel_Reduce with a sum).
+   - Map:       storing the square of every value in an array (Parallel_Map).
+   - For_Each:  incrementing every value in place (Parallel_For_Each).
+   - Histogram: counting the values in PARALLEL_BENCH_BUCKETS ranges (Parallel_Histogram).
+   Variants:
+       serial:   one thread walking the whole list with a plain loop (Scan_List_Sum for Sum), the baseline.
+       stored:   a ParallelPool_t of the reported number of threads, with segment boundaries taken once and reused.
+       resplit:  the same, with the boundaries taken again by a walk on every call (Sum only), i.e. the cost of
+                 calling after every structural change of the list.
+*/
+#include <string.h>
+#include "Benchmark.h"
+#include "ListScan.h"
+#include "ListParallel.h"
+
+#define PARALLEL_BENCH_BUCKETS (16U)  /* Buckets of the Histogram case */
+
+/* 
+   This typedef struct holds the list and the parallel machinery of the parallel group.
+*/
+typedef struct{
+    List_t List;                               /* list under test */
+    ParallelPool_t Pool;                       /* threads of the current thread count */
+    ListSegments_t Segments;                   /* boundaries, reused between calls */
+    uint32_t *Output;                          /* Map results */
+    uint64_t Counts[PARALLEL_BENCH_BUCKETS];   /* Histogram results */
+    uint64_t Sink;                             /* results are folded in here so no call can be skipped */
+}ParallelBench_t;
+
+static uint64_t Parallel_Bench_Add(uint64_t Partial, uint32_t Data, void *Context){
+    (void)Context;
+    return Partial + Data;
+}
+
+static uint64_t Parallel_Bench_Combine(uint64_t Total, uint64_t Partial, void *Context){
+    (void)Context;
+    return Total + Partial;
+}
+
+static uint32_t Parallel_Bench_Square(uint32_t Data, void *Context){
+    (void)Context;
+    return Data * Data;
+}
+
+static void Parallel_Bench_Increment(uint32_t *Data, void *Context){
+    (void)Context;
+    (*Data)++;
+}
+
+static void Parallel_Sum_Serial(void *Context, size_t Ops){
+    ParallelBench_t *Bench = Context;
+    uint64_t Sum = 0;
+
+    (void)Ops;
+    Scan_List_Sum(&Bench->List, &Sum);
+    Bench->Sink += Sum;
+}
+
+static void Parallel_Sum_Stored(void *Context, size_t Ops){
+    ParallelBench_t *Bench = Context;
+    uint64_t Sum = 0;
+
+    (void)Ops;
+    Parallel_Reduce(&Bench->Pool, &Bench->List, &Bench->Segments, Parallel_Bench_Add, Parallel_Bench_Combine, 0U,
+                    NULL, &Sum);
+    Bench->Sink += Sum;
+}
+
+static void Parallel_Sum_Resplit(void *Context, size_t Ops){
+    ParallelBench_t *Bench = Context;
+
+    Parallel_Segments_Build(&Bench->Segments, &Bench->List);
+    Parallel_Sum_Stored(Context, Ops);
+}
+
+static void Parallel_Map_Serial(void *Context, size_t Ops){
+    ParallelBench_t *Bench = Context;
+    const Node_t *NodeCopy = Bench->List.ListHead;
+    size_t counter = 0;
+
+    (void)Ops;
+    while (NULL != NodeCopy)
+    {
+        Bench->Output[counter] = Parallel_Bench_Square(NodeCopy->NodeData, NULL);
+        NodeCopy = NodeCopy->NodeLink;
+        counter++;
+    }
+    Bench->Sink += Bench->Output[0];
+}
+
+static void Parallel_Map_Stored(void *Context, size_t Ops){
+    ParallelBench_t *Bench = Context;
+
+    Parallel_Map(&Bench->Pool, &Bench->List, &Bench->Segments, Parallel_Bench_Square, NULL, Bench->Output, Ops);
+    Bench->Sink += Bench->Output[0];
+}
+
+static void Parallel_For_Each_Serial(void *Context, size_t Ops){
+    ParallelBench_t *Bench = Context;
+    Node_t *NodeCopy = Bench->List.ListHead;
+
+    (void)Ops;
+    while (NULL != NodeCopy)
+    {
+        Parallel_Bench_Increment(&NodeCopy->NodeData, NULL);
+        NodeCopy = NodeCopy->NodeLink;
+    }
+    Bench->Sink += Bench->List.ListHead->NodeData;
+}
+
+static void Parallel_For_Each_Stored(void *Context, size_t Ops){
+    ParallelBench_t *Bench = Context;
+
+    (void)Ops;
+    Parallel_For_Each(&Bench->Pool, &Bench->List, &Bench->Segments, Parallel_Bench_Increment, NULL);
+    Bench->Sink += Bench->List.ListHead->NodeData;
+}
+
+static void Parallel_Histogram_Serial(void *Context, size_t Ops){
+    ParallelBench_t *Bench = Context;
+    const Node_t *NodeCopy = Bench->List.ListHead;
+
+    (void)Ops;
+    memset(Bench->Counts, 0, sizeof(Bench->Counts));
+    while (NULL != NodeCopy)
+    {
+        size_t Bucket = NodeCopy->NodeData / (0x100000000ULL / PARALLEL_BENCH_BUCKETS);
+
+        Bench->Counts[Bucket]++;
+        NodeCopy = NodeCopy->NodeLink;
+    }
+    Bench->Sink += Bench->Counts[0];
+}
+
+static void Parallel_Histogram_Stored(void *Context, size_t Ops){
+    ParallelBench_t *Bench = Context;
+
+    (void)Ops;
+    Parallel_Histogram(&Bench->Pool, &Bench->List, &Bench->Segments,
+                       (uint32_t)(0x100000000ULL / PARALLEL_BENCH_BUCKETS), PARALLEL_BENCH_BUCKETS, Bench->Counts);
+    Bench->Sink += Bench->Counts[0];
+}
+
+/* Function to time one case and report it */
+static void Parallel_Bench_Case(BenchConfig_t *Config, const char *CaseName, const char *Variant, size_t Threads,
+                                BenchRun_t Run, ParallelBench_t *Bench){
+    BenchCase_t Case = {"parallel", CaseName, Variant, Bench->List.ListLength, Threads};
+    BenchResult_t Result;
+
+    if(Bench_Case_Enabled(Config, Case.CaseGroup, Case.CaseName)){
+        Bench_Measure(Config, Run, NULL, Bench, Bench->List.ListLength, &Result);
+        Bench_Report(Config, &Case, &Result);
+    }
+}
+
+/*
+   This function Bench_Group_Parallel is the entry point of the "parallel" benchmark group.
+*/
+void Bench_Group_Parallel(BenchConfig_t *Config){
+    ParallelBench_t Bench;
+    size_t Size = 0;
+    size_t Threads = 0;
+    size_t counter = 0;
+    uint64_t Seed = 0x9E3779B97F4A7C15ULL;
+
+    List_Init(&Bench.List);
+    Bench.Sink = 0;
+    if(NODE_OK != Parallel_Segments_Init(&Bench.Segments, 0U)){
+        printf("parallel: out of memory at %zu values\n", (size_t)0U);
+        return;
+    }
+    for(Size = Config->MinSize; Size <= Config->MaxSize; Size *= 10U){
+        NodeStatus_t status = NODE_OK;
+
+        Bench.Output = (uint32_t *)malloc(Size * sizeof(uint32_t));
+        status = (NULL == Bench.Output) ? NODE_NOK : NODE_OK;
+        for(counter = 0; (counter < Size) && (NODE_OK == status); counter++){
+            uint32_t Data = 0;
+
+            Seed ^= Seed << 13;  /* xorshift64, values spread over the whole range for the histogram */
+            Seed ^= Seed >> 7;
+            Seed ^= Seed << 17;
+            Data = (uint32_t)(Seed >> 32);
+            status = List_Insert_Node_At_End(&Bench.List, &Data);
+        }
+        if(NODE_OK != status){
+            printf("parallel: out of memory at %zu values\n", Size);
+            free(Bench.Output);
+            break;
+        }
+        Parallel_Bench_Case(Config, "Sum", "serial", 1U, Parallel_Sum_Serial, &Bench);
+        Parallel_Bench_Case(Config, "Map", "serial", 1U, Parallel_Map_Serial, &Bench);
+        Parallel_Bench_Case(Config, "For_Each", "serial", 1U, Parallel_For_Each_Serial, &Bench);
+        Parallel_Bench_Case(Config, "Histogram", "serial", 1U, Parallel_Histogram_Serial, &Bench);
+        for(Threads = Bench_Next_Thread_Count(Config, 0U); 0U != Threads; Threads = Bench_Next_Thread_Count(Config, Threads)){
+            if(NODE_OK != Parallel_Pool_Init(&Bench.Pool, Threads)){
+                printf("parallel: could not start %zu threads\n", Threads);
+                break;
+            }
+            Parallel_Segments_Build(&Bench.Segments, &Bench.List);
+            Parallel_Bench_Case(Config, "Sum", "stored", Threads, Parallel_Sum_Stored, &Bench);
+            Parallel_Bench_Case(Config, "Sum", "resplit", Threads, Parallel_Sum_Resplit, &Bench);
+            Parallel_Bench_Case(Config, "Map", "stored", Threads, Parallel_Map_Stored, &Bench);
+            Parallel_Bench_Case(Config, "For_Each", "stored", Threads, Parallel_For_Each_Stored, &Bench);
+            Parallel_Bench_Case(Config, "Histogram", "stored", Threads, Parallel_Histogram_Stored, &Bench);
+            Parallel_Pool_Destroy(&Bench.Pool);
+        }
+        List_Clear(&Bench.List);
+        free(Bench.Output);
+        if(Size > (Config->MaxSize / 10U)){
+            break;  // Next power of ten would exceed MaxSize (or overflow)
+        }
+    }
+    Parallel_Segments_Destroy(&Bench.Segments);
+    if(0U == Bench.Sink){
+        printf("parallel: no values read\n");
+    }
+}
\ No newline at end of file
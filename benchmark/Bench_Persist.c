@@ -0,0 +1,260 @@
+/* 
+ * File:   Bench_Persist.c
+ * Author: Mohammed Khairallah
+ * linkedin : linkedin.com/in/mohammed-khairallah
+ * Created on October 27, 2026, 3:00 PM
+ */
+
+/*
+   This file is the "persist" benchmark group: readers and writers sharing one list, from 1 to Config->MaxThreads threads,
+   for lists of 10 ... min(Config->MaxSize, PERSIST_BENCH_MAX_SIZE) nodes.
+   Every thread draws operations with a fixed mix:
+   - Read99 / Read90 / Read50: 99%, 90% or 50% reads, the rest split between inserts and deletes at the beginning.
+   A read takes the length and walks the whole list adding up the values (what Get_Length and Display_All_Nodes do).
+   Variants:
+       persistent:  PersistentList_t; a read walks a snapshot without any lock, a write publishes a new version.
+       mutex:       a List_t behind one global mutex, held for the whole walk of a read.
+       rwlock:      the same behind a pthread_rwlock_t, so reads overlap each other but not writes.
+   The lists are brought back to Size nodes after every sample, so the length does not drift between samples.
+*/
+#include <pthread.h>
+#include "Benchmark.h"
+#include "PersistentList.h"
+
+#define PERSIST_BENCH_MAX_SIZE (10000U)            /* Longest shared list (every read walks all of it) */
+#define PERSIST_BENCH_STEPS_PER_THREAD (1000000U)  /* About this many nodes walked per thread and sample */
+#define PERSIST_BENCH_MIN_OPS (100U)               /* Fewest operations per thread and sample */
+
+/* Operation drawn for one step of a worker */
+typedef enum{
+    PERSIST_OP_READ = 0,
+    PERSIST_OP_INSERT,
+    PERSIST_OP_DELETE
+}PersistOp_t;
+
+/* 
+   This typedef struct holds the lists shared by the workers.
+*/
+typedef struct{
+    PersistentList_t Persistent;   /* versioned list */
+    List_t Locked;                 /* list handle of the mutex and rwlock variants */
+    pthread_mutex_t Mutex;         /* global lock of Locked (mutex variant) */
+    pthread_rwlock_t RwLock;       /* global lock of Locked (rwlock variant) */
+    size_t Size;                   /* length restored after every sample */
+    size_t ReadPercent;            /* share of reads in the current mix */
+    uint64_t Sink;                 /* sums are folded in here so no walk can be skipped */
+}PersistBench_t;
+
+/* Function to draw the next operation of one worker (xorshift64) */
+static PersistOp_t Persist_Bench_Pick(PersistBench_t *Bench, uint64_t *Seed){
+    size_t Percent = 0;
+    PersistOp_t Op = PERSIST_OP_READ;
+
+    *Seed ^= *Seed << 13;
+    *Seed ^= *Seed >> 7;
+    *Seed ^= *Seed << 17;
+    Percent = (size_t)(*Seed % 100U);
+    if(Percent < Bench->ReadPercent){
+        Op = PERSIST_OP_READ;
+    }
+    else if(Percent < (Bench->ReadPercent + ((100U - Bench->ReadPercent) / 2U))){
+        Op = PERSIST_OP_INSERT;
+    }
+    else{
+        Op = PERSIST_OP_DELETE;
+    }
+    return Op;
+}
+
+/* Function to add up the values of a list handle (caller holds the lock) */
+static uint64_t Persist_Bench_Walk(const List_t *List){
+    const Node_t *NodeCopy = List->ListHead;
+    uint64_t Sum = List->ListLength;
+
+    while (NULL != NodeCopy)
+    {
+        Sum += NodeCopy->NodeData;
+        NodeCopy = NodeCopy->NodeLink;
+    }
+    return Sum;
+}
+
+static void Persist_Persistent_Mix(void *Context, size_t ThreadIndex, size_t Ops){
+    PersistBench_t *Bench = Context;
+    uint64_t Seed = 0x9E3779B97F4A7C15ULL * (ThreadIndex + 1U);
+    uint32_t Value = (uint32_t)ThreadIndex;
+    uint64_t Sum = 0;
+    size_t counter = 0;
+
+    for(counter = 0; counter < Ops; counter++){
+        switch(Persist_Bench_Pick(Bench, &Seed)){
+            case PERSIST_OP_READ:
+            {
+                PersistentVersion_t *Version = NULL;
+                const PersistentNode_t *NodeCopy = NULL;
+                size_t Length = 0;
+
+                Persistent_List_Snapshot(&Bench->Persistent, &Version);
+                Persistent_Version_Get_Length(Version, &Length);
+                Sum += Length;
+                for(NodeCopy = Version->VersionHead; NULL != NodeCopy; NodeCopy = NodeCopy->NodeLink){
+                    Sum += NodeCopy->NodeData;
+                }
+                Persistent_Version_Release(Version);
+                break;
+            }
+            case PERSIST_OP_INSERT:
+                Persistent_List_Insert_Node_At_Beginning(&Bench->Persistent, &Value);
+                break;
+            default:
+                Persistent_List_Delete_Node_At_Beginning(&Bench->Persistent);
+                break;
+        }
+    }
+    __atomic_add_fetch(&Bench->Sink, Sum, __ATOMIC_RELAXED);
+}
+
+static void Persist_Mutex_Mix(void *Context, size_t ThreadIndex, size_t Ops){
+    PersistBench_t *Bench = Context;
+    uint64_t Seed = 0x9E3779B97F4A7C15ULL * (ThreadIndex + 1U);
+    uint32_t Value = (uint32_t)ThreadIndex;
+    uint64_t Sum = 0;
+    size_t counter = 0;
+
+    for(counter = 0; counter < Ops; counter++){
+        PersistOp_t Op = Persist_Bench_Pick(Bench, &Seed);
+
+        pthread_mutex_lock(&Bench->Mutex);
+        if(PERSIST_OP_READ == Op){
+            Sum += Persist_Bench_Walk(&Bench->Locked);
+        }
+        else if(PERSIST_OP_INSERT == Op){
+            List_Insert_Node_At_Beginning(&Bench->Locked, &Value);
+        }
+        else{
+            List_Delete_Node_At_Beginning(&Bench->Locked);
+        }
+        pthread_mutex_unlock(&Bench->Mutex);
+    }
+    __atomic_add_fetch(&Bench->Sink, Sum, __ATOMIC_RELAXED);
+}
+
+static void Persist_RwLock_Mix(void *Context, size_t ThreadIndex, size_t Ops){
+    PersistBench_t *Bench = Context;
+    uint64_t Seed = 0x9E3779B97F4A7C15ULL * (ThreadIndex + 1U);
+    uint32_t Value = (uint32_t)ThreadIndex;
+    uint64_t Sum = 0;
+    size_t counter = 0;
+
+    for(counter = 0; counter < Ops; counter++){
+        PersistOp_t Op = Persist_Bench_Pick(Bench, &Seed);
+
+        if(PERSIST_OP_READ == Op){
+            pthread_rwlock_rdlock(&Bench->RwLock);
+            Sum += Persist_Bench_Walk(&Bench->Locked);
+        }
+        else{
+            pthread_rwlock_wrlock(&Bench->RwLock);
+            if(PERSIST_OP_INSERT == Op){
+                List_Insert_Node_At_Beginning(&Bench->Locked, &Value);
+            }
+            else{
+                List_Delete_Node_At_Beginning(&Bench->Locked);
+            }
+        }
+        pthread_rwlock_unlock(&Bench->RwLock);
+    }
+    __atomic_add_fetch(&Bench->Sink, Sum, __ATOMIC_RELAXED);
+}
+
+static void Persist_Thread_Exit(void *Context, size_t ThreadIndex){
+    (void)Context;
+    (void)ThreadIndex;
+    Hazard_Thread_Exit();
+}
+
+/* Function to bring both lists back to Size nodes */
+static void Persist_Restore(void *Context, size_t Ops){
+    PersistBench_t *Bench = Context;
+    PersistentVersion_t *Version = NULL;
+    uint32_t Value = 0;
+    size_t Length = 0;
+
+    (void)Ops;
+    Persistent_List_Snapshot(&Bench->Persistent, &Version);
+    Persistent_Version_Get_Length(Version, &Length);
+    Persistent_Version_Release(Version);
+    for(; Length > Bench->Size; Length--){
+        Persistent_List_Delete_Node_At_Beginning(&Bench->Persistent);
+    }
+    for(; Length < Bench->Size; Length++){
+        Value = (uint32_t)Length;
+        Persistent_List_Insert_Node_At_Beginning(&Bench->Persistent, &Value);
+    }
+    while (Bench->Locked.ListLength > Bench->Size)
+    {
+        List_Delete_Node_At_Beginning(&Bench->Locked);
+    }
+    while (Bench->Locked.ListLength < Bench->Size)
+    {
+        Value = (uint32_t)Bench->Locked.ListLength;
+        List_Insert_Node_At_Beginning(&Bench->Locked, &Value);
+    }
+}
+
+/*
+   This function Bench_Group_Persist is the entry point of the "persist" benchmark group.
+*/
+void Bench_Group_Persist(BenchConfig_t *Config){
+    static const char *MixNames[3] = {"Read99", "Read90", "Read50"};
+    static const size_t MixReads[3] = {99U, 90U, 50U};
+    static const char *VariantNames[3] = {"persistent", "mutex", "rwlock"};
+    static const BenchThreadRun_t VariantRuns[3] = {Persist_Persistent_Mix, Persist_Mutex_Mix, Persist_RwLock_Mix};
+    PersistBench_t Bench;
+    BenchResult_t Result;
+    size_t Threads = 0;
+    size_t Size = 0;
+    size_t Ops = 0;
+    size_t Mix = 0;
+    size_t Variant = 0;
+
+    if(NODE_OK != Persistent_List_Init(&Bench.Persistent)){
+        printf("persist: out of memory at %zu values\n", (size_t)0U);
+        return;
+    }
+    List_Init(&Bench.Locked);
+    pthread_mutex_init(&Bench.Mutex, NULL);
+    pthread_rwlock_init(&Bench.RwLock, NULL);
+    Bench.Sink = 0;
+    for(Size = Config->MinSize; (Size <= Config->MaxSize) && (Size <= PERSIST_BENCH_MAX_SIZE); Size *= 10U){
+        Bench.Size = Size;
+        Ops = PERSIST_BENCH_STEPS_PER_THREAD / Size;
+        Ops = (Ops < PERSIST_BENCH_MIN_OPS) ? PERSIST_BENCH_MIN_OPS : Ops;
+        Persist_Restore(&Bench, 0U);
+        for(Mix = 0; Mix < 3U; Mix++){
+            Bench.ReadPercent = MixReads[Mix];
+            for(Threads = Bench_Next_Thread_Count(Config, 0U); 0U != Threads; Threads = Bench_Next_Thread_Count(Config, Threads)){
+                for(Variant = 0; Variant < 3U; Variant++){
+                    BenchCase_t Case = {"persist", MixNames[Mix], VariantNames[Variant], Size, Threads};
+
+                    if(Bench_Case_Enabled(Config, Case.CaseGroup, Case.CaseName) &&
+                       (NODE_OK == Bench_Measure_Threads(Config, Threads, VariantRuns[Variant], Persist_Thread_Exit,
+                                                         Persist_Restore, &Bench, Ops, &Result))){
+                        Bench_Report(Config, &Case, &Result);
+                    }
+                }
+            }
+        }
+        if(Size > (Config->MaxSize / 10U)){
+            break;  // Next power of ten would exceed MaxSize (or overflow)
+        }
+    }
+    Persistent_List_Destroy(&Bench.Persistent);
+    List_Clear(&Bench.Locked);
+    pthread_rwlock_destroy(&Bench.RwLock);
+    pthread_mutex_destroy(&Bench.Mutex);
+    Hazard_Thread_Exit();
+    if(0U == Bench.Sink){
+        printf("persist: no values read\n");
+    }
+}
\ No newline at end of file
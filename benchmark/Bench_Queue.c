@@ -0,0 +1,244 @@
+/* 
+ * File:   Bench_Queue.c
+ * Author: Mohammed Khairallah
+ * linkedin : linkedin.com/in/mohammed-khairallah
+ * Created on October 18, 2026, 6:00 PM
+ */
+
+/*
+   This file is the "queue" benchmark group: FIFO throughput and latency from 1 to Config->MaxThreads threads.
+   Variants:
+   - lockfree:     ConcurrentQueue_t.
+   - mutex:        a Node_t list with Insert_Node_At_End and Delete_Node_At_Beginning behind one global mutex
+                   (the tail walk happens inside the lock).
+   - mutex_list:   a List_t with List_Insert_Node_At_End and List_Delete_Node_At_Beginning behind one global mutex
+                   (O(1) tail, still one lock).
+   Cases:
+   - Enqueue_Dequeue: every thread enqueues and dequeues in turn.
+   - Producer_Consumer: even threads only enqueue, odd threads only dequeue (even thread counts only).
+   - Enqueue_Latency / Dequeue_Latency: every single operation of the Enqueue_Dequeue pattern is timed on its own;
+     the percentiles are over operations (including about one clock read of overhead), not over samples.
+*/
+#include <pthread.h>
+#include "Benchmark.h"
+#include "ConcurrentQueue.h"
+
+#define QUEUE_BENCH_PREFILL (1024U)         /* Values in the queue before each case starts */
+#define QUEUE_BENCH_OPS_PER_THREAD (20000U) /* Operations per thread and sample */
+#define QUEUE_BENCH_LATENCY_OPS (2000U)     /* Timed operation pairs per thread and sample in the latency cases */
+
+/* 
+   This typedef struct holds the queues shared by the workers.
+*/
+typedef struct{
+    ConcurrentQueue_t Queue;   /* lock-free queue */
+    Node_t *NodeHead;          /* mutex-protected raw list */
+    List_t NodeList;           /* mutex-protected list handle */
+    pthread_mutex_t Lock;      /* global lock of NodeHead and NodeList */
+    double *EnqueueNs;         /* per-operation enqueue latencies of the latency cases */
+    double *DequeueNs;         /* per-operation dequeue latencies of the latency cases */
+}QueueBench_t;
+
+/*
+   This typedef struct describes one queue backend: how one thread enqueues and dequeues one value.
+   Dequeue returns NODE_OK when a value was taken and NODE_EMPTY when the queue was empty.
+*/
+typedef struct{
+    const char *BackendName;                                        /* variant column */
+    void (*BackendEnqueue)(QueueBench_t *Bench, uint32_t *Value);   /* enqueue one value */
+    NodeStatus_t (*BackendDequeue)(QueueBench_t *Bench);            /* dequeue one value */
+}QueueBackend_t;
+
+static void Queue_Lockfree_Enqueue(QueueBench_t *Bench, uint32_t *Value){
+    Concurrent_Queue_Enqueue(&Bench->Queue, Value);
+}
+
+static NodeStatus_t Queue_Lockfree_Dequeue(QueueBench_t *Bench){
+    uint32_t Value = 0;
+
+    return Concurrent_Queue_Dequeue(&Bench->Queue, &Value);
+}
+
+static void Queue_Mutex_Enqueue(QueueBench_t *Bench, uint32_t *Value){
+    pthread_mutex_lock(&Bench->Lock);
+    Insert_Node_At_End(&Bench->NodeHead, Value);
+    pthread_mutex_unlock(&Bench->Lock);
+}
+
+static NodeStatus_t Queue_Mutex_Dequeue(QueueBench_t *Bench){
+    NodeStatus_t status = NODE_NOK;
+
+    pthread_mutex_lock(&Bench->Lock);
+    status = (NULL == Bench->NodeHead) ? NODE_EMPTY : Delete_Node_At_Beginning(&Bench->NodeHead);
+    pthread_mutex_unlock(&Bench->Lock);
+    return status;
+}
+
+static void Queue_Handle_Enqueue(QueueBench_t *Bench, uint32_t *Value){
+    pthread_mutex_lock(&Bench->Lock);
+    List_Insert_Node_At_End(&Bench->NodeList, Value);
+    pthread_mutex_unlock(&Bench->Lock);
+}
+
+static NodeStatus_t Queue_Handle_Dequeue(QueueBench_t *Bench){
+    NodeStatus_t status = NODE_NOK;
+
+    pthread_mutex_lock(&Bench->Lock);
+    status = List_Delete_Node_At_Beginning(&Bench->NodeList);
+    pthread_mutex_unlock(&Bench->Lock);
+    return status;
+}
+
+static const QueueBackend_t QueueBackends[] = {
+    {"lockfree", Queue_Lockfree_Enqueue, Queue_Lockfree_Dequeue},
+    {"mutex", Queue_Mutex_Enqueue, Queue_Mutex_Dequeue},
+    {"mutex_list", Queue_Handle_Enqueue, Queue_Handle_Dequeue},
+};
+
+/* Backend used by the running case; the workers only read it */
+static const QueueBackend_t *QueueBackend = NULL;
+
+static void Queue_Enqueue_Dequeue(void *Context, size_t ThreadIndex, size_t Ops){
+    QueueBench_t *Bench = Context;
+    uint32_t Value = (uint32_t)ThreadIndex;
+    size_t counter = 0;
+
+    for(counter = 0; counter < Ops; counter++){
+        QueueBackend->BackendEnqueue(Bench, &Value);
+        QueueBackend->BackendDequeue(Bench);
+    }
+}
+
+static void Queue_Producer_Consumer(void *Context, size_t ThreadIndex, size_t Ops){
+    QueueBench_t *Bench = Context;
+    uint32_t Value = (uint32_t)ThreadIndex;
+    size_t counter = 0;
+
+    if(0U == (ThreadIndex % 2U)){
+        for(counter = 0; counter < Ops; counter++){
+            QueueBackend->BackendEnqueue(Bench, &Value);
+        }
+    }
+    else{
+        /* Every consumer takes exactly as many values as its producer adds, waiting while the queue runs dry */
+        while (counter < Ops)
+        {
+            if(NODE_OK == QueueBackend->BackendDequeue(Bench)){
+                counter++;
+            }
+        }
+    }
+}
+
+static void Queue_Latency(void *Context, size_t ThreadIndex, size_t Ops){
+    QueueBench_t *Bench = Context;
+    uint32_t Value = (uint32_t)ThreadIndex;
+    double *EnqueueNs = &Bench->EnqueueNs[ThreadIndex * Ops];
+    double *DequeueNs = &Bench->DequeueNs[ThreadIndex * Ops];
+    uint64_t Start = 0;
+    uint64_t Middle = 0;
+    size_t counter = 0;
+
+    for(counter = 0; counter < Ops; counter++){
+        Start = Bench_Now_Ns();
+        QueueBackend->BackendEnqueue(Bench, &Value);
+        Middle = Bench_Now_Ns();
+        QueueBackend->BackendDequeue(Bench);
+        DequeueNs[counter] = (double)(Bench_Now_Ns() - Middle);
+        EnqueueNs[counter] = (double)(Middle - Start);
+    }
+}
+
+static void Queue_Thread_Exit(void *Context, size_t ThreadIndex){
+    (void)Context;
+    (void)ThreadIndex;
+    Hazard_Thread_Exit();
+}
+
+/* Function to report the per-operation latencies collected by Queue_Latency */
+static void Queue_Report_Latency(BenchConfig_t *Config, BenchCase_t *Case, double *Samples, size_t SampleCount){
+    BenchResult_t Result;
+
+    if(NODE_OK == Bench_Summarize(Samples, SampleCount, &Result)){
+        Result.OpsPerSample = 1U;
+        Result.AllocsPerOp = -1.0;
+        Bench_Report(Config, Case, &Result);
+    }
+}
+
+/*
+   This function Bench_Group_Queue is the entry point of the "queue" benchmark group.
+*/
+void Bench_Group_Queue(BenchConfig_t *Config){
+    QueueBench_t Bench;
+    BenchResult_t Result;
+    uint32_t Value = 0x5A5A5A5AU;
+    size_t Threads = 0;
+    size_t Backend = 0;
+    size_t counter = 0;
+
+    Bench.NodeHead = NULL;
+    List_Init(&Bench.NodeList);
+    pthread_mutex_init(&Bench.Lock, NULL);
+    if(NODE_OK != Concurrent_Queue_Init(&Bench.Queue)){
+        printf("queue: out of memory\n");
+        return;
+    }
+    for(counter = 0; counter < QUEUE_BENCH_PREFILL; counter++){
+        Concurrent_Queue_Enqueue(&Bench.Queue, &Value);
+        Insert_Node_At_End(&Bench.NodeHead, &Value);
+        List_Insert_Node_At_End(&Bench.NodeList, &Value);
+    }
+    Bench.EnqueueNs = malloc(Config->MaxThreads * QUEUE_BENCH_LATENCY_OPS * sizeof(double));
+    Bench.DequeueNs = malloc(Config->MaxThreads * QUEUE_BENCH_LATENCY_OPS * sizeof(double));
+
+    for(Threads = Bench_Next_Thread_Count(Config, 0U); 0U != Threads; Threads = Bench_Next_Thread_Count(Config, Threads)){
+        for(Backend = 0; Backend < (sizeof(QueueBackends) / sizeof(QueueBackends[0])); Backend++){
+            BenchThreadExit_t Exit = (0U == Backend) ? Queue_Thread_Exit : NULL;
+            BenchCase_t PairCase = {"queue", "Enqueue_Dequeue", NULL, QUEUE_BENCH_PREFILL, Threads};
+            BenchCase_t SplitCase = {"queue", "Producer_Consumer", NULL, QUEUE_BENCH_PREFILL, Threads};
+            BenchCase_t EnqueueCase = {"queue", "Enqueue_Latency", NULL, QUEUE_BENCH_PREFILL, Threads};
+            BenchCase_t DequeueCase = {"queue", "Dequeue_Latency", NULL, QUEUE_BENCH_PREFILL, Threads};
+
+            QueueBackend = &QueueBackends[Backend];
+            PairCase.CaseVariant = QueueBackend->BackendName;
+            SplitCase.CaseVariant = QueueBackend->BackendName;
+            EnqueueCase.CaseVariant = QueueBackend->BackendName;
+            DequeueCase.CaseVariant = QueueBackend->BackendName;
+
+            if(Bench_Case_Enabled(Config, PairCase.CaseGroup, PairCase.CaseName)){
+                if(NODE_OK == Bench_Measure_Threads(Config, Threads, Queue_Enqueue_Dequeue, Exit, NULL, &Bench,
+                                                    QUEUE_BENCH_OPS_PER_THREAD, &Result)){
+                    Bench_Report(Config, &PairCase, &Result);
+                }
+            }
+            if((0U == (Threads % 2U)) && Bench_Case_Enabled(Config, SplitCase.CaseGroup, SplitCase.CaseName)){
+                if(NODE_OK == Bench_Measure_Threads(Config, Threads, Queue_Producer_Consumer, Exit, NULL, &Bench,
+                                                    QUEUE_BENCH_OPS_PER_THREAD, &Result)){
+                    Bench_Report(Config, &SplitCase, &Result);
+                }
+            }
+            if((NULL != Bench.EnqueueNs) && (NULL != Bench.DequeueNs) &&
+               (Bench_Case_Enabled(Config, EnqueueCase.CaseGroup, EnqueueCase.CaseName) ||
+                Bench_Case_Enabled(Config, DequeueCase.CaseGroup, DequeueCase.CaseName))){
+                if(NODE_OK == Bench_Measure_Threads(Config, Threads, Queue_Latency, Exit, NULL, &Bench,
+                                                    QUEUE_BENCH_LATENCY_OPS, &Result)){
+                    Queue_Report_Latency(Config, &EnqueueCase, Bench.EnqueueNs, Threads * QUEUE_BENCH_LATENCY_OPS);
+                    Queue_Report_Latency(Config, &DequeueCase, Bench.DequeueNs, Threads * QUEUE_BENCH_LATENCY_OPS);
+                }
+            }
+        }
+    }
+
+    free(Bench.EnqueueNs);
+    free(Bench.DequeueNs);
+    Concurrent_Queue_Destroy(&Bench.Queue);
+    while (NULL != Bench.NodeHead)
+    {
+        Delete_Node_At_Beginning(&Bench.NodeHead);
+    }
+    List_Clear(&Bench.NodeList);
+    pthread_mutex_destroy(&Bench.Lock);
+    Hazard_Thread_Exit();
+    Hazard_Shutdown();
+}
\ No newline at end of file
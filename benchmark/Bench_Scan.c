@@ -0,0 +1,179 @@
+/* 
+ * File:   Bench_Scan.c
+ * Author: Mohammed Khairallah
+ * linkedin : linkedin.com/in/mohammed-khairallah
+ * Created on October 22, 2026, 2:00 PM
+ */
+
+/*
+   This file is the "scan" benchmark group: whole-list scans over 10 ... Config->MaxSize values, timed per value.
+   - Find:    looking for a value that is not there, so every value is compared.
+   - Count:   counting the values equal to a given one.
+   - Min_Max: smallest and largest value in one pass.
+   - Sum:     64-bit sum of the values.
+   Variants:
+       list:                          List_t, one node per step (Find_By_Value, Scan_List_*), the pointer-chasing baseline.
+       unr_scalar / unr_sse2 / unr_avx2: UnrolledList_t through Scan_Unrolled_*, with the kernels of each level.
+       scalar / sse2 / avx2:          the same values in one array through Scan_*, e.g. a snapshot view.
+   Levels this build or CPU does not support are skipped.
+*/
+#include "Benchmark.h"
+#include "ListScan.h"
+
+#define SCAN_BENCH_ABSENT (0xFFFFFFFFU)  /* Never stored: the values have their top bit clear */
+
+/* Storage a case scans */
+typedef enum{
+    SCAN_TARGET_LIST = 0,
+    SCAN_TARGET_UNROLLED,
+    SCAN_TARGET_ARRAY
+}ScanTarget_t;
+
+/* 
+   This typedef struct holds the three copies of the values scanned by the scan group.
+*/
+typedef struct{
+    List_t List;              /* values as a list handle */
+    UnrolledList_t Unrolled;  /* values as an unrolled list */
+    uint32_t *Values;         /* values as an array */
+    size_t Size;              /* number of values */
+    ScanTarget_t Target;      /* storage of the current case */
+    uint64_t Sink;            /* results are folded in here so no scan can be skipped */
+}ScanBench_t;
+
+static void Scan_Bench_Find(void *Context, size_t Ops){
+    ScanBench_t *Bench = Context;
+    uint32_t Value = SCAN_BENCH_ABSENT;
+    size_t Position = 0;
+
+    if(SCAN_TARGET_LIST == Bench->Target){
+        Find_By_Value(Bench->List.ListHead, &Value, &Position);
+    }
+    else if(SCAN_TARGET_UNROLLED == Bench->Target){
+        Scan_Unrolled_Find(&Bench->Unrolled, Value, &Position);
+    }
+    else{
+        Scan_Find(Bench->Values, Ops, Value, &Position);
+    }
+    Bench->Sink += Position;
+}
+
+static void Scan_Bench_Count(void *Context, size_t Ops){
+    ScanBench_t *Bench = Context;
+    uint32_t Value = Bench->Values[Ops / 2U];
+    size_t Matches = 0;
+
+    if(SCAN_TARGET_LIST == Bench->Target){
+        Scan_List_Count(&Bench->List, Value, &Matches);
+    }
+    else if(SCAN_TARGET_UNROLLED == Bench->Target){
+        Scan_Unrolled_Count(&Bench->Unrolled, Value, &Matches);
+    }
+    else{
+        Scan_Count(Bench->Values, Ops, Value, &Matches);
+    }
+    Bench->Sink += Matches;
+}
+
+static void Scan_Bench_Min_Max(void *Context, size_t Ops){
+    ScanBench_t *Bench = Context;
+    uint32_t Min = 0;
+    uint32_t Max = 0;
+
+    if(SCAN_TARGET_LIST == Bench->Target){
+        Scan_List_Min_Max(&Bench->List, &Min, &Max);
+    }
+    else if(SCAN_TARGET_UNROLLED == Bench->Target){
+        Scan_Unrolled_Min_Max(&Bench->Unrolled, &Min, &Max);
+    }
+    else{
+        Scan_Min_Max(Bench->Values, Ops, &Min, &Max);
+    }
+    Bench->Sink += (uint64_t)Min + Max;
+}
+
+static void Scan_Bench_Sum(void *Context, size_t Ops){
+    ScanBench_t *Bench = Context;
+    uint64_t Sum = 0;
+
+    if(SCAN_TARGET_LIST == Bench->Target){
+        Scan_List_Sum(&Bench->List, &Sum);
+    }
+    else if(SCAN_TARGET_UNROLLED == Bench->Target){
+        Scan_Unrolled_Sum(&Bench->Unrolled, &Sum);
+    }
+    else{
+        Scan_Sum(Bench->Values, Ops, &Sum);
+    }
+    Bench->Sink += Sum;
+}
+
+/* Function to time one case and report it */
+static void Scan_Bench_Case(BenchConfig_t *Config, const char *CaseName, const char *Variant, BenchRun_t Run,
+                            ScanBench_t *Bench){
+    BenchCase_t Case = {"scan", CaseName, Variant, Bench->Size, 1U};
+    BenchResult_t Result;
+
+    if(Bench_Case_Enabled(Config, Case.CaseGroup, Case.CaseName)){
+        Bench_Measure(Config, Run, NULL, Bench, Bench->Size, &Result);
+        Bench_Report(Config, &Case, &Result);
+    }
+}
+
+/* Function to run the four cases on one storage */
+static void Scan_Bench_Variant(BenchConfig_t *Config, const char *Variant, ScanTarget_t Target, ScanBench_t *Bench){
+    Bench->Target = Target;
+    Scan_Bench_Case(Config, "Find", Variant, Scan_Bench_Find, Bench);
+    Scan_Bench_Case(Config, "Count", Variant, Scan_Bench_Count, Bench);
+    Scan_Bench_Case(Config, "Min_Max", Variant, Scan_Bench_Min_Max, Bench);
+    Scan_Bench_Case(Config, "Sum", Variant, Scan_Bench_Sum, Bench);
+}
+
+/*
+   This function Bench_Group_Scan is the entry point of the "scan" benchmark group.
+*/
+void Bench_Group_Scan(BenchConfig_t *Config){
+    static const char *UnrolledVariants[3] = {"unr_scalar", "unr_sse2", "unr_avx2"};
+    static const char *ArrayVariants[3] = {"scalar", "sse2", "avx2"};
+    static const ScanLevel_t Levels[3] = {SCAN_LEVEL_SCALAR, SCAN_LEVEL_SSE2, SCAN_LEVEL_AVX2};
+    ScanBench_t Bench;
+    size_t Size = 0;
+    size_t counter = 0;
+    int Level = 0;
+
+    List_Init(&Bench.List);
+    Unrolled_Init(&Bench.Unrolled);
+    Bench.Sink = 0;
+    for(Size = Config->MinSize; Size <= Config->MaxSize; Size *= 10U){
+        Bench.Size = Size;
+        Bench.Values = (uint32_t *)malloc(Size * sizeof(uint32_t));
+        if(NULL == Bench.Values){
+            printf("scan: out of memory at %zu values\n", Size);
+            break;
+        }
+        for(counter = 0; counter < Size; counter++){
+            Bench.Values[counter] = (uint32_t)(counter * 2654435761U) >> 1;
+            Unrolled_Insert_Node_At_End(&Bench.Unrolled, &Bench.Values[counter]);
+        }
+        List_Insert_Nodes_At_End(&Bench.List, Bench.Values, Size);
+
+        Scan_Bench_Variant(Config, "list", SCAN_TARGET_LIST, &Bench);
+        for(Level = 0; Level < 3; Level++){
+            if(NODE_OK == Scan_Set_Level(Levels[Level])){
+                Scan_Bench_Variant(Config, UnrolledVariants[Level], SCAN_TARGET_UNROLLED, &Bench);
+                Scan_Bench_Variant(Config, ArrayVariants[Level], SCAN_TARGET_ARRAY, &Bench);
+            }
+        }
+        Scan_Set_Level(SCAN_LEVEL_AUTO);
+
+        List_Clear(&Bench.List);
+        Unrolled_Clear(&Bench.Unrolled);
+        free(Bench.Values);
+        if(Size > (Config->MaxSize / 10U)){
+            break;  // Next power of ten would exceed MaxSize (or overflow)
+        }
+    }
+    if(0U == Bench.Sink){
+        printf("scan: no values scanned\n");
+    }
+}
\ No newline at end of file
@@ -0,0 +1,156 @@
+/* 
+ * File:   Bench_Snapshot.c
+ * Author: Mohammed Khairallah
+ * linkedin : linkedin.com/in/mohammed-khairallah
+ * Created on October 19, 2026, 2:00 PM
+ */
+
+/*
+   This file is the "snapshot" benchmark group: saving and restoring lists of 10 ... Config->MaxSize values.
+   One sample saves or loads the whole list; the reported time is per value.
+   - Snapshot_Save_List / Snapshot_Save_Compact: streaming writer over a list handle and a compact list.
+   - Snapshot_Load_List (handle, pooled) / Snapshot_Load_Compact: bulk build from the mapped file.
+   - Snapshot_Map: zero-copy read-only view (map, sum every value, unmap).
+   - Insert_Loop: the baseline, rebuilding the list with one List_Insert_Node_At_End call per value.
+*/
+#include "Benchmark.h"
+#include "NodePool.h"
+#include "ListSnapshot.h"
+
+#define SNAPSHOT_BENCH_FILE "bench_snapshot.bin"  /* Temporary file, removed at the end of the group */
+
+/* 
+   This typedef struct holds the lists of the snapshot group at one size.
+*/
+typedef struct{
+    List_t List;            /* list handle (handle and pooled variants) */
+    NodePool_t Pool;        /* pool of the pooled variant */
+    CompactList_t Compact;  /* compact list */
+    uint32_t *Values;       /* values of the list, used by Insert_Loop */
+    volatile uint32_t Sum;  /* keeps the Snapshot_Map reads from being optimized away */
+}SnapshotBench_t;
+
+static void Snapshot_Bench_Save_List(void *Context, size_t Ops){
+    SnapshotBench_t *Bench = Context;
+
+    (void)Ops;
+    Snapshot_Save_List(&Bench->List, SNAPSHOT_BENCH_FILE);
+}
+
+static void Snapshot_Bench_Save_Compact(void *Context, size_t Ops){
+    SnapshotBench_t *Bench = Context;
+
+    (void)Ops;
+    Snapshot_Save_Compact(&Bench->Compact, SNAPSHOT_BENCH_FILE);
+}
+
+static void Snapshot_Bench_Load_List(void *Context, size_t Ops){
+    SnapshotBench_t *Bench = Context;
+
+    (void)Ops;
+    Snapshot_Load_List(&Bench->List, SNAPSHOT_BENCH_FILE);
+}
+
+static void Snapshot_Bench_Load_Compact(void *Context, size_t Ops){
+    SnapshotBench_t *Bench = Context;
+
+    (void)Ops;
+    Snapshot_Load_Compact(&Bench->Compact, SNAPSHOT_BENCH_FILE);
+}
+
+static void Snapshot_Bench_Map(void *Context, size_t Ops){
+    SnapshotBench_t *Bench = Context;
+    SnapshotView_t View;
+    uint32_t Sum = 0;
+    uint64_t counter = 0;
+
+    (void)Ops;
+    if(NODE_OK == Snapshot_Map(&View, SNAPSHOT_BENCH_FILE)){
+        for(counter = 0; counter < View.ViewCount; counter++){
+            Sum += View.ViewData[counter];
+        }
+        Snapshot_Unmap(&View);
+    }
+    Bench->Sum = Sum;
+}
+
+static void Snapshot_Bench_Insert_Loop(void *Context, size_t Ops){
+    SnapshotBench_t *Bench = Context;
+    size_t counter = 0;
+
+    for(counter = 0; counter < Ops; counter++){
+        List_Insert_Node_At_End(&Bench->List, &Bench->Values[counter]);
+    }
+}
+
+static void Snapshot_Bench_Clear_List(void *Context, size_t Ops){
+    SnapshotBench_t *Bench = Context;
+
+    (void)Ops;
+    List_Clear(&Bench->List);
+}
+
+/* Function to time one case and report it */
+static void Snapshot_Bench_Case(BenchConfig_t *Config, const char *CaseName, const char *Variant, BenchRun_t Run,
+                                BenchRestore_t Restore, SnapshotBench_t *Bench, size_t Size){
+    BenchCase_t Case = {"snapshot", CaseName, Variant, Size, 1U};
+    BenchResult_t Result;
+
+    if(Bench_Case_Enabled(Config, Case.CaseGroup, Case.CaseName)){
+        Bench_Measure(Config, Run, Restore, Bench, Size, &Result);
+        Bench_Report(Config, &Case, &Result);
+    }
+}
+
+/*
+   This function Bench_Group_Snapshot is the entry point of the "snapshot" benchmark group.
+*/
+void Bench_Group_Snapshot(BenchConfig_t *Config){
+    SnapshotBench_t Bench;
+    size_t Size = 0;
+    size_t counter = 0;
+
+    for(Size = Config->MinSize; Size <= Config->MaxSize; Size *= 10U){
+        Bench.Values = (uint32_t *)malloc(Size * sizeof(uint32_t));
+        if(NULL == Bench.Values){
+            printf("snapshot: out of memory at %zu values\n", Size);
+            break;
+        }
+        List_Init(&Bench.List);
+        Compact_Init(&Bench.Compact);
+        Compact_Reserve(&Bench.Compact, Size);
+        for(counter = 0; counter < Size; counter++){
+            Bench.Values[counter] = (uint32_t)(counter * 2654435761U);
+            List_Insert_Node_At_End(&Bench.List, &Bench.Values[counter]);
+            Compact_Insert_Node_At_End(&Bench.Compact, &Bench.Values[counter]);
+        }
+
+        Snapshot_Bench_Case(Config, "Snapshot_Save_List", "handle", Snapshot_Bench_Save_List, NULL, &Bench, Size);
+        Snapshot_Bench_Case(Config, "Snapshot_Save_Compact", "compact", Snapshot_Bench_Save_Compact, NULL, &Bench, Size);
+        Snapshot_Save_Compact(&Bench.Compact, SNAPSHOT_BENCH_FILE);  // The load cases need the file whatever the filter
+
+        List_Clear(&Bench.List);
+        Snapshot_Bench_Case(Config, "Snapshot_Load_List", "handle", Snapshot_Bench_Load_List, Snapshot_Bench_Clear_List,
+                            &Bench, Size);
+        Snapshot_Bench_Case(Config, "Insert_Loop", "handle", Snapshot_Bench_Insert_Loop, Snapshot_Bench_Clear_List,
+                            &Bench, Size);
+        NodePool_Init(&Bench.Pool, 0U);
+        List_Use_Pool(&Bench.List, &Bench.Pool);
+        Snapshot_Bench_Case(Config, "Snapshot_Load_List", "pooled", Snapshot_Bench_Load_List, Snapshot_Bench_Clear_List,
+                            &Bench, Size);
+        Snapshot_Bench_Case(Config, "Insert_Loop", "pooled", Snapshot_Bench_Insert_Loop, Snapshot_Bench_Clear_List,
+                            &Bench, Size);
+        List_Clear(&Bench.List);
+        List_Use_Pool(&Bench.List, NULL);
+        NodePool_Destroy(&Bench.Pool);
+        Snapshot_Bench_Case(Config, "Snapshot_Load_Compact", "compact", Snapshot_Bench_Load_Compact, NULL, &Bench, Size);
+        Snapshot_Bench_Case(Config, "Snapshot_Map", "view", Snapshot_Bench_Map, NULL, &Bench, Size);
+
+        Compact_Clear(&Bench.Compact);
+        free(Bench.Values);
+        if(Size > (Config->MaxSize / 10U)){
+            break;  // Next power of ten would exceed MaxSize (or overflow)
+        }
+    }
+    remove(SNAPSHOT_BENCH_FILE);
+}
\ No newline at end of file
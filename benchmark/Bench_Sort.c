@@ -0,0 +1,179 @@
+/* 
+ * File:   Bench_Sort.c
+ * Author: Mohammed Khairallah
+ * linkedin : linkedin.com/in/mohammed-khairallah
+ * Created on October 21, 2026, 10:00 AM
+ */
+
+/*
+   This file is the "sort" benchmark group, for lists of 10 ... Config->MaxSize values (10^7 with --max-size 10000000).
+   The reported time is per value.
+   - Sort_Random / Sort_Sorted / Sort_Reversed: ordering the whole list, for random, ascending and descending input.
+       merge:      List_Sort, the in-place bottom-up merge sort.
+       copy_qsort: copying the values out with List_Extract_Nodes, qsort, and rebuilding the list with List_Clear
+                   and List_Insert_Nodes_At_End (the best a caller could do before List_Sort).
+   - Insert_Sorted: building a sorted list from random values with List_Insert_Node_Sorted (only up to 10^4 values,
+                    each insertion walks the list).
+   - Merge: List_Merge_Sorted of two sorted lists of Size / 2 values each.
+*/
+#include "Benchmark.h"
+
+#define SORT_BENCH_MAX_INSERT (10000U)  /* Largest list built with List_Insert_Node_Sorted */
+
+/* 
+   This typedef struct holds the lists and arrays of the sort group.
+*/
+typedef struct{
+    List_t List;        /* list being sorted, or first list of a merge */
+    List_t Other;       /* second list of a merge */
+    uint32_t *Values;   /* input order of the current case */
+    uint32_t *Scratch;  /* copy used by copy_qsort */
+    size_t Size;        /* number of values */
+}SortBench_t;
+
+static int Sort_Compare(const void *Left, const void *Right){
+    uint32_t LeftValue = *(const uint32_t *)Left;
+    uint32_t RightValue = *(const uint32_t *)Right;
+
+    return (LeftValue > RightValue) - (LeftValue < RightValue);
+}
+
+static void Sort_Merge(void *Context, size_t Ops){
+    SortBench_t *Bench = Context;
+
+    (void)Ops;
+    List_Sort(&Bench->List);
+}
+
+static void Sort_Copy_Qsort(void *Context, size_t Ops){
+    SortBench_t *Bench = Context;
+    size_t Count = 0;
+
+    List_Extract_Nodes(&Bench->List, Bench->Scratch, Ops, &Count);
+    qsort(Bench->Scratch, Count, sizeof(uint32_t), Sort_Compare);
+    List_Clear(&Bench->List);
+    List_Insert_Nodes_At_End(&Bench->List, Bench->Scratch, Count);
+}
+
+static void Sort_Rebuild(void *Context, size_t Ops){
+    SortBench_t *Bench = Context;
+
+    (void)Ops;
+    List_Clear(&Bench->List);
+    List_Insert_Nodes_At_End(&Bench->List, Bench->Values, Bench->Size);
+}
+
+static void Sort_Insert_Sorted(void *Context, size_t Ops){
+    SortBench_t *Bench = Context;
+    size_t counter = 0;
+
+    for(counter = 0; counter < Ops; counter++){
+        List_Insert_Node_Sorted(&Bench->List, &Bench->Values[counter]);
+    }
+}
+
+static void Sort_Clear(void *Context, size_t Ops){
+    SortBench_t *Bench = Context;
+
+    (void)Ops;
+    List_Clear(&Bench->List);
+}
+
+static void Sort_Merge_Lists(void *Context, size_t Ops){
+    SortBench_t *Bench = Context;
+
+    (void)Ops;
+    List_Merge_Sorted(&Bench->List, &Bench->Other);
+}
+
+/* Restore for Merge: Values holds the even values 0, 2, 4, ... and Scratch the odd values 1, 3, 5, ... */
+static void Sort_Split_Lists(void *Context, size_t Ops){
+    SortBench_t *Bench = Context;
+
+    (void)Ops;
+    List_Clear(&Bench->List);
+    List_Clear(&Bench->Other);
+    List_Insert_Nodes_At_End(&Bench->List, Bench->Values, Bench->Size / 2U);
+    List_Insert_Nodes_At_End(&Bench->Other, Bench->Scratch, Bench->Size - (Bench->Size / 2U));
+}
+
+/* Function to time one case and report it; Restore also builds the starting state */
+static void Sort_Bench_Case(BenchConfig_t *Config, const char *CaseName, const char *Variant, BenchRun_t Run,
+                            BenchRestore_t Restore, SortBench_t *Bench){
+    BenchCase_t Case = {"sort", CaseName, Variant, Bench->Size, 1U};
+    BenchResult_t Result;
+
+    if(Bench_Case_Enabled(Config, Case.CaseGroup, Case.CaseName)){
+        Restore(Bench, Bench->Size);
+        Bench_Measure(Config, Run, Restore, Bench, Bench->Size, &Result);
+        Bench_Report(Config, &Case, &Result);
+    }
+}
+
+/* Function to fill Values for one input order: 0 random, 1 ascending, 2 descending */
+static void Sort_Fill(SortBench_t *Bench, int Order){
+    size_t counter = 0;
+
+    for(counter = 0; counter < Bench->Size; counter++){
+        if(0 == Order){
+            Bench->Values[counter] = (uint32_t)(counter * 2654435761U) >> 3;
+        }
+        else if(1 == Order){
+            Bench->Values[counter] = (uint32_t)counter;
+        }
+        else{
+            Bench->Values[counter] = (uint32_t)(Bench->Size - counter);
+        }
+    }
+}
+
+/*
+   This function Bench_Group_Sort is the entry point of the "sort" benchmark group.
+*/
+void Bench_Group_Sort(BenchConfig_t *Config){
+    static const char *SortCases[3] = {"Sort_Random", "Sort_Sorted", "Sort_Reversed"};
+    SortBench_t Bench;
+    size_t Size = 0;
+    size_t counter = 0;
+    int Order = 0;
+
+    List_Init(&Bench.List);
+    List_Init(&Bench.Other);
+    for(Size = Config->MinSize; Size <= Config->MaxSize; Size *= 10U){
+        Bench.Size = Size;
+        Bench.Values = (uint32_t *)malloc(Size * sizeof(uint32_t));
+        Bench.Scratch = (uint32_t *)malloc(Size * sizeof(uint32_t));
+        if((NULL == Bench.Values)||(NULL == Bench.Scratch)){
+            printf("sort: out of memory at %zu values\n", Size);
+            free(Bench.Values);
+            free(Bench.Scratch);
+            break;
+        }
+
+        for(Order = 0; Order < 3; Order++){
+            Sort_Fill(&Bench, Order);
+            Sort_Bench_Case(Config, SortCases[Order], "merge", Sort_Merge, Sort_Rebuild, &Bench);
+            Sort_Bench_Case(Config, SortCases[Order], "copy_qsort", Sort_Copy_Qsort, Sort_Rebuild, &Bench);
+        }
+        List_Clear(&Bench.List);
+
+        Sort_Fill(&Bench, 0);
+        if(Size <= SORT_BENCH_MAX_INSERT){
+            Sort_Bench_Case(Config, "Insert_Sorted", "handle", Sort_Insert_Sorted, Sort_Clear, &Bench);
+        }
+
+        for(counter = 0; counter < Size; counter++){
+            Bench.Values[counter] = (uint32_t)(2U * counter);
+            Bench.Scratch[counter] = (uint32_t)((2U * counter) + 1U);
+        }
+        Sort_Bench_Case(Config, "Merge", "handle", Sort_Merge_Lists, Sort_Split_Lists, &Bench);
+        List_Clear(&Bench.List);
+        List_Clear(&Bench.Other);
+
+        free(Bench.Values);
+        free(Bench.Scratch);
+        if(Size > (Config->MaxSize / 10U)){
+            break;  // Next power of ten would exceed MaxSize (or overflow)
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,160 @@
+/* 
+ * File:   Bench_Splice.c
+ * Author: Mohammed Khairallah
+ * linkedin : linkedin.com/in/mohammed-khairallah
+ * Created on October 26, 2026, 9:15 AM
+ */
+
+/*
+   This file is the "splice" benchmark group: moving nodes between two list handles, 10 ... Config->MaxSize nodes in total.
+   Every case is timed per call, i.e. per whole move, and is undone (untimed) before the next sample.
+   - Split:  the second half of a list of Size nodes moved to an empty list.
+   - Concat: a list of Size / 2 nodes appended to another one of Size / 2 nodes.
+   - Splice: the middle half of one list of Size / 2 nodes moved to the middle of the other one (relink only).
+   Variants:
+       relink:  List_Split, List_Concat and List_Splice, which only change links.
+       copy:    the same moves with the rest of the API, one node at a time: a cursor erases each node of the
+                source after it is appended to the destination (Split), or the head of the source is appended
+                and deleted until it is empty (Concat). One allocation and one free per node.
+*/
+#include "Benchmark.h"
+
+/* 
+   This typedef struct holds the two lists of the splice group.
+*/
+typedef struct{
+    List_t List;     /* list that keeps the first half / receives the nodes */
+    List_t Other;    /* list that receives the second half / gives the nodes */
+    size_t Size;     /* total number of nodes in both lists */
+    uint64_t Sink;   /* lengths are folded in here so no move can be skipped */
+}SpliceBench_t;
+
+static void Splice_Split_Relink(void *Context, size_t Ops){
+    SpliceBench_t *Bench = Context;
+
+    (void)Ops;
+    List_Split(&Bench->List, Bench->Size / 2U, &Bench->Other);
+    Bench->Sink += Bench->Other.ListLength;
+}
+
+static void Splice_Split_Copy(void *Context, size_t Ops){
+    SpliceBench_t *Bench = Context;
+    ListCursor_t Cursor;
+    uint32_t Data = 0;
+
+    (void)Ops;
+    List_Cursor_Init(&Cursor, &Bench->List);
+    List_Cursor_Seek(&Cursor, Bench->Size / 2U);
+    while (NODE_OK == List_Cursor_Peek(&Cursor, &Data))
+    {
+        List_Insert_Node_At_End(&Bench->Other, &Data);
+        List_Cursor_Erase(&Cursor);
+    }
+    Bench->Sink += Bench->Other.ListLength;
+}
+
+static void Splice_Split_Undo(void *Context, size_t Ops){
+    SpliceBench_t *Bench = Context;
+
+    (void)Ops;
+    List_Concat(&Bench->List, &Bench->Other);
+}
+
+static void Splice_Concat_Relink(void *Context, size_t Ops){
+    SpliceBench_t *Bench = Context;
+
+    (void)Ops;
+    List_Concat(&Bench->List, &Bench->Other);
+    Bench->Sink += Bench->List.ListLength;
+}
+
+static void Splice_Concat_Copy(void *Context, size_t Ops){
+    SpliceBench_t *Bench = Context;
+
+    (void)Ops;
+    while (NULL != Bench->Other.ListHead)
+    {
+        List_Insert_Node_At_End(&Bench->List, &Bench->Other.ListHead->NodeData);
+        List_Delete_Node_At_Beginning(&Bench->Other);
+    }
+    Bench->Sink += Bench->List.ListLength;
+}
+
+static void Splice_Concat_Undo(void *Context, size_t Ops){
+    SpliceBench_t *Bench = Context;
+
+    (void)Ops;
+    List_Split(&Bench->List, Bench->Size / 2U, &Bench->Other);
+}
+
+static void Splice_Range_Relink(void *Context, size_t Ops){
+    SpliceBench_t *Bench = Context;
+    size_t Half = Bench->Size / 2U;
+
+    (void)Ops;
+    List_Splice(&Bench->List, Half / 2U, &Bench->Other, (Half / 4U) + 1U, (Half / 4U) + (Half / 2U));
+    Bench->Sink += Bench->List.ListLength;
+}
+
+static void Splice_Range_Undo(void *Context, size_t Ops){
+    SpliceBench_t *Bench = Context;
+    size_t Half = Bench->Size / 2U;
+
+    (void)Ops;
+    List_Splice(&Bench->Other, Half / 4U, &Bench->List, (Half / 2U) + 1U, (Half / 2U) + (Half / 2U));
+}
+
+/* Function to time one case and report it */
+static void Splice_Bench_Case(BenchConfig_t *Config, const char *CaseName, const char *Variant, BenchRun_t Run,
+                              BenchRestore_t Restore, SpliceBench_t *Bench){
+    BenchCase_t Case = {"splice", CaseName, Variant, Bench->Size, 1U};
+    BenchResult_t Result;
+
+    if(Bench_Case_Enabled(Config, Case.CaseGroup, Case.CaseName)){
+        Bench_Measure(Config, Run, Restore, Bench, 1U, &Result);
+        Bench_Report(Config, &Case, &Result);
+    }
+}
+
+/*
+   This function Bench_Group_Splice is the entry point of the "splice" benchmark group.
+*/
+void Bench_Group_Splice(BenchConfig_t *Config){
+    SpliceBench_t Bench;
+    size_t Size = 0;
+    size_t counter = 0;
+
+    List_Init(&Bench.List);
+    List_Init(&Bench.Other);
+    Bench.Sink = 0;
+    for(Size = Config->MinSize; Size <= Config->MaxSize; Size *= 10U){
+        NodeStatus_t status = NODE_OK;
+
+        Bench.Size = Size;
+        for(counter = 0; (counter < Size) && (NODE_OK == status); counter++){
+            uint32_t Data = (uint32_t)counter;
+            status = List_Insert_Node_At_End(&Bench.List, &Data);
+        }
+        if(NODE_OK != status){
+            printf("splice: out of memory at %zu values\n", Size);
+            break;
+        }
+        /* The list holds all Size nodes and Other is empty */
+        Splice_Bench_Case(Config, "Split", "relink", Splice_Split_Relink, Splice_Split_Undo, &Bench);
+        Splice_Bench_Case(Config, "Split", "copy", Splice_Split_Copy, Splice_Split_Undo, &Bench);
+        /* Each list holds half of the nodes */
+        Splice_Concat_Undo(&Bench, 1U);
+        Splice_Bench_Case(Config, "Concat", "relink", Splice_Concat_Relink, Splice_Concat_Undo, &Bench);
+        Splice_Bench_Case(Config, "Concat", "copy", Splice_Concat_Copy, Splice_Concat_Undo, &Bench);
+        Splice_Bench_Case(Config, "Splice", "relink", Splice_Range_Relink, Splice_Range_Undo, &Bench);
+        List_Clear(&Bench.List);
+        List_Clear(&Bench.Other);
+        if(Size > (Config->MaxSize / 10U)){
+            break;  // Next power of ten would exceed MaxSize (or overflow)
+        }
+    }
+    List_Clear(&Bench.List);
+    if(0U == Bench.Sink){
+        printf("splice: no nodes moved\n");
+    }
+}
\ No newline at end of file
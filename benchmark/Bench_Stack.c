@@ -0,0 +1,158 @@
+/* 
+ * File:   Bench_Stack.c
+ * Author: Mohammed Khairallah
+ * linkedin : linkedin.com/in/mohammed-khairallah
+ * Created on October 18, 2026, 3:00 PM
+ */
+
+/*
+   This file is the "stack" benchmark group: LIFO work-stack throughput from 1 to Config->MaxThreads threads.
+   - Push_Pop / lockfree: every thread pushes and pops on a shared ConcurrentStack_t.
+   - Push_Pop / mutex:    the same on a Node_t list with Insert_Node_At_Beginning and Delete_Node_At_Beginning
+                          behind one global mutex, which is how the list is shared today.
+   - Drain / pop, pop_all: one thread empties a stack of Size nodes one node at a time or with Concurrent_Stack_Pop_All.
+*/
+#include <pthread.h>
+#include "Benchmark.h"
+#include "ConcurrentStack.h"
+
+#define STACK_BENCH_PREFILL (1024U)        /* Nodes on the stack before the push/pop cases start */
+#define STACK_BENCH_OPS_PER_THREAD (20000U) /* Push/pop pairs per thread and sample */
+#define STACK_BENCH_MAX_DRAIN (1000000UL)  /* Largest stack drained by the drain cases */
+
+/* 
+   This typedef struct holds the stacks shared by the workers.
+*/
+typedef struct{
+    ConcurrentStack_t Stack;     /* lock-free stack */
+    Node_t *NodeHead;            /* mutex-protected list */
+    pthread_mutex_t Lock;        /* global lock of NodeHead */
+    uint32_t Value;              /* pushed value */
+}StackBench_t;
+
+static void Stack_Lockfree_Push_Pop(void *Context, size_t ThreadIndex, size_t Ops){
+    StackBench_t *Bench = Context;
+    uint32_t Value = (uint32_t)ThreadIndex;
+    uint32_t Popped = 0;
+    size_t counter = 0;
+
+    for(counter = 0; counter < Ops; counter++){
+        Concurrent_Stack_Push(&Bench->Stack, &Value);
+        Concurrent_Stack_Pop(&Bench->Stack, &Popped);
+    }
+}
+
+static void Stack_Mutex_Push_Pop(void *Context, size_t ThreadIndex, size_t Ops){
+    StackBench_t *Bench = Context;
+    uint32_t Value = (uint32_t)ThreadIndex;
+    size_t counter = 0;
+
+    for(counter = 0; counter < Ops; counter++){
+        pthread_mutex_lock(&Bench->Lock);
+        Insert_Node_At_Beginning(&Bench->NodeHead, &Value);
+        pthread_mutex_unlock(&Bench->Lock);
+        pthread_mutex_lock(&Bench->Lock);
+        Delete_Node_At_Beginning(&Bench->NodeHead);
+        pthread_mutex_unlock(&Bench->Lock);
+    }
+}
+
+static void Stack_Thread_Exit(void *Context, size_t ThreadIndex){
+    (void)Context;
+    (void)ThreadIndex;
+    Hazard_Thread_Exit();
+}
+
+static void Stack_Fill(void *Context, size_t Ops){
+    StackBench_t *Bench = Context;
+    size_t counter = 0;
+
+    for(counter = 0; counter < Ops; counter++){
+        Concurrent_Stack_Push(&Bench->Stack, &Bench->Value);
+    }
+}
+
+static void Stack_Drain_Pop(void *Context, size_t Ops){
+    StackBench_t *Bench = Context;
+    uint32_t Popped = 0;
+
+    (void)Ops;
+    while (NODE_OK == Concurrent_Stack_Pop(&Bench->Stack, &Popped))
+    {
+        /* Pop until empty */
+    }
+}
+
+static void Stack_Drain_Pop_All(void *Context, size_t Ops){
+    StackBench_t *Bench = Context;
+    Node_t *Chain = NULL;
+
+    (void)Ops;
+    if(NODE_OK == Concurrent_Stack_Pop_All(&Bench->Stack, &Chain)){
+        Concurrent_Stack_Release_Chain(Chain);
+    }
+}
+
+/*
+   This function Bench_Group_Stack is the entry point of the "stack" benchmark group.
+*/
+void Bench_Group_Stack(BenchConfig_t *Config){
+    StackBench_t Bench;
+    BenchResult_t Result;
+    size_t Threads = 0;
+    size_t Size = 0;
+    size_t counter = 0;
+
+    Bench.Value = 0x5A5A5A5AU;
+    Bench.NodeHead = NULL;
+    pthread_mutex_init(&Bench.Lock, NULL);
+    Concurrent_Stack_Init(&Bench.Stack);
+    Stack_Fill(&Bench, STACK_BENCH_PREFILL);
+    for(counter = 0; counter < STACK_BENCH_PREFILL; counter++){
+        Insert_Node_At_Beginning(&Bench.NodeHead, &Bench.Value);
+    }
+
+    for(Threads = Bench_Next_Thread_Count(Config, 0U); 0U != Threads; Threads = Bench_Next_Thread_Count(Config, Threads)){
+        BenchCase_t LockfreeCase = {"stack", "Push_Pop", "lockfree", STACK_BENCH_PREFILL, Threads};
+        BenchCase_t MutexCase = {"stack", "Push_Pop", "mutex", STACK_BENCH_PREFILL, Threads};
+
+        if(Bench_Case_Enabled(Config, LockfreeCase.CaseGroup, LockfreeCase.CaseName)){
+            if(NODE_OK == Bench_Measure_Threads(Config, Threads, Stack_Lockfree_Push_Pop, Stack_Thread_Exit, NULL, &Bench,
+                                                STACK_BENCH_OPS_PER_THREAD, &Result)){
+                Bench_Report(Config, &LockfreeCase, &Result);
+            }
+            if(NODE_OK == Bench_Measure_Threads(Config, Threads, Stack_Mutex_Push_Pop, NULL, NULL, &Bench,
+                                                STACK_BENCH_OPS_PER_THREAD, &Result)){
+                Bench_Report(Config, &MutexCase, &Result);
+            }
+        }
+    }
+
+    /* Drain cases start from an empty stack that the restore step refills */
+    Stack_Drain_Pop(&Bench, 0U);
+    for(Size = Config->MinSize; (Size <= Config->MaxSize) && (Size <= STACK_BENCH_MAX_DRAIN); Size *= 10U){
+        BenchCase_t PopCase = {"stack", "Drain", "pop", Size, 1U};
+        BenchCase_t PopAllCase = {"stack", "Drain", "pop_all", Size, 1U};
+
+        if(Bench_Case_Enabled(Config, PopCase.CaseGroup, PopCase.CaseName)){
+            Stack_Fill(&Bench, Size);
+            Bench_Measure(Config, Stack_Drain_Pop, Stack_Fill, &Bench, Size, &Result);
+            Bench_Report(Config, &PopCase, &Result);
+            Stack_Drain_Pop(&Bench, 0U);
+
+            Stack_Fill(&Bench, Size);
+            Bench_Measure(Config, Stack_Drain_Pop_All, Stack_Fill, &Bench, Size, &Result);
+            Bench_Report(Config, &PopAllCase, &Result);
+            Stack_Drain_Pop(&Bench, 0U);
+        }
+    }
+
+    Concurrent_Stack_Destroy(&Bench.Stack);
+    while (NULL != Bench.NodeHead)
+    {
+        Delete_Node_At_Beginning(&Bench.NodeHead);
+    }
+    pthread_mutex_destroy(&Bench.Lock);
+    Hazard_Thread_Exit();
+    Hazard_Shutdown();
+}
\ No newline at end of file
@@ -0,0 +1,453 @@
+/* 
+ * File:   Benchmark.c
+ * Author: Mohammed Khairallah
+ * linkedin : linkedin.com/in/mohammed-khairallah
+ * Created on October 18, 2026, 2:00 PM
+ */
+
+/*
+   This file holds the measuring and reporting code shared by all benchmark groups:
+   a monotonic clock, heap allocation counting, repetition/warmup handling, percentile statistics,
+   and the table, CSV and JSON reporters.
+*/
+#include <string.h>
+#include <time.h>
+#include <fcntl.h>
+#if defined(_WIN32)
+#include <windows.h>
+#include <io.h>
+#define BENCH_NULL_DEVICE "NUL"
+#define Bench_Dup _dup
+#define Bench_Dup2 _dup2
+#define Bench_Open _open
+#define Bench_Close _close
+#else
+#include <unistd.h>
+#include <sched.h>
+#define BENCH_NULL_DEVICE "/dev/null"
+#define Bench_Dup dup
+#define Bench_Dup2 dup2
+#define Bench_Open open
+#define Bench_Close close
+#endif
+#include <pthread.h>
+#include "Benchmark.h"
+
+/* 
+   This typedef struct holds the state shared by the workers of one multi-threaded sample.
+*/
+typedef struct{
+    BenchThreadRun_t Run;      /* timed part */
+    BenchThreadExit_t Exit;    /* untimed per-thread cleanup, may be NULL */
+    void *Context;             /* state of the case */
+    size_t Ops;                /* operations per thread */
+    size_t Ready;              /* workers waiting for the start signal */
+    int Go;                    /* start signal */
+    uint64_t Finish[BENCH_MAX_THREADS];  /* time each worker finished its timed part */
+}BenchThreadShared_t;
+
+/* 
+   This typedef struct is the argument of one worker thread.
+*/
+typedef struct{
+    BenchThreadShared_t *Shared;  /* state shared by all workers */
+    size_t Index;                 /* worker index, 0 to Threads - 1 */
+}BenchThreadArg_t;
+
+static uint64_t BenchAllocs = 0;     /* Heap allocations seen by the allocator wrappers */
+static int BenchSavedStdout = -1;    /* Descriptor of the real stdout while it is silenced */
+static double BenchSamples[BENCH_MAX_SAMPLES];  /* Per-operation time of every timed sample */
+
+/*
+   When the benchmark is linked with -Wl,--wrap=malloc (and calloc, realloc, aligned_alloc), every heap allocation
+   made by the library goes through these functions first, so allocations per operation can be reported.
+   The counter is updated atomically because multi-threaded groups allocate from several threads.
+*/
+#if defined(BENCH_WRAP_ALLOCATOR)
+void *__real_malloc(size_t Size);
+void *__real_calloc(size_t Count, size_t Size);
+void *__real_realloc(void *Pointer, size_t Size);
+void *__real_aligned_alloc(size_t Alignment, size_t Size);
+
+void *__wrap_malloc(size_t Size){
+    __atomic_fetch_add(&BenchAllocs, 1U, __ATOMIC_RELAXED);
+    return __real_malloc(Size);
+}
+
+void *__wrap_calloc(size_t Count, size_t Size){
+    __atomic_fetch_add(&BenchAllocs, 1U, __ATOMIC_RELAXED);
+    return __real_calloc(Count, Size);
+}
+
+void *__wrap_realloc(void *Pointer, size_t Size){
+    __atomic_fetch_add(&BenchAllocs, 1U, __ATOMIC_RELAXED);
+    return __real_realloc(Pointer, Size);
+}
+
+void *__wrap_aligned_alloc(size_t Alignment, size_t Size){
+    __atomic_fetch_add(&BenchAllocs, 1U, __ATOMIC_RELAXED);
+    return __real_aligned_alloc(Alignment, Size);
+}
+#endif
+
+/* Function to compare two samples for qsort */
+static int Bench_Compare_Samples(const void *Left, const void *Right){
+    double l_Left = *(const double *)Left;
+    double l_Right = *(const double *)Right;
+
+    return (l_Left > l_Right) - (l_Left < l_Right);
+}
+
+/* Function to read the nearest-rank percentile (0 < Percent <= 100) of sorted samples */
+static double Bench_Percentile(double *Sorted, size_t SampleCount, double Percent){
+    size_t Rank = (size_t)((Percent / 100.0) * (double)SampleCount + 0.999999);
+
+    if(Rank < 1U){
+        Rank = 1U;
+    }
+    if(Rank > SampleCount){
+        Rank = SampleCount;
+    }
+    return Sorted[Rank - 1U];
+}
+
+/* Function to give up the processor while spinning, so spinning workers do not starve the others on small machines */
+static void Bench_Yield(void){
+#if defined(_WIN32)
+    SwitchToThread();
+#else
+    sched_yield();
+#endif
+}
+
+/* Worker thread of Bench_Measure_Threads: waits for the start signal, runs its share and records when it finished */
+static void *Bench_Thread_Main(void *Argument){
+    BenchThreadArg_t *Arg = Argument;
+    BenchThreadShared_t *Shared = Arg->Shared;
+
+    __atomic_fetch_add(&Shared->Ready, 1U, __ATOMIC_ACQ_REL);
+    while (0 == __atomic_load_n(&Shared->Go, __ATOMIC_ACQUIRE))
+    {
+        Bench_Yield();
+    }
+    Shared->Run(Shared->Context, Arg->Index, Shared->Ops);
+    Shared->Finish[Arg->Index] = Bench_Now_Ns();
+    if(NULL != Shared->Exit){
+        Shared->Exit(Shared->Context, Arg->Index);
+    }
+    return NULL;
+}
+
+/* Function to read a monotonic clock in nanoseconds */
+uint64_t Bench_Now_Ns(void){
+#if defined(_WIN32)
+    LARGE_INTEGER Counter;
+    LARGE_INTEGER Frequency;
+
+    QueryPerformanceCounter(&Counter);
+    QueryPerformanceFrequency(&Frequency);
+    return (uint64_t)((double)Counter.QuadPart * (1e9 / (double)Frequency.QuadPart));
+#else
+    struct timespec Now;
+
+    clock_gettime(CLOCK_MONOTONIC, &Now);
+    return ((uint64_t)Now.tv_sec * 1000000000ULL) + (uint64_t)Now.tv_nsec;
+#endif
+}
+
+/* Function to read the number of heap allocations made so far (always 0 when allocations are not counted) */
+uint64_t Bench_Alloc_Count(void){
+    return __atomic_load_n(&BenchAllocs, __ATOMIC_RELAXED);
+}
+
+/* Function to tell whether the allocator wrappers are linked in */
+int Bench_Alloc_Counting(void){
+#if defined(BENCH_WRAP_ALLOCATOR)
+    return 1;
+#else
+    return 0;
+#endif
+}
+
+/* Function to tell whether a case passes the --filter option */
+int Bench_Case_Enabled(BenchConfig_t *Config, const char *CaseGroup, const char *CaseName){
+    return (NULL == Config->Filter) || (NULL != strstr(CaseGroup, Config->Filter)) || (NULL != strstr(CaseName, Config->Filter));
+}
+
+/*
+   This function Bench_Summarize is responsible for turning per-operation samples into a BenchResult_t.
+   The samples are sorted in place. Reps, the time statistics and OpsPerSec are filled in; the other members are left as they are.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if a pointer is NULL, or NODE_EMPTY if there are no samples.
+*/
+NodeStatus_t Bench_Summarize(double *Samples, size_t SampleCount, BenchResult_t *Result){
+    NodeStatus_t status = NODE_NOK;
+    double Sum = 0.0;
+    size_t counter = 0;
+
+    if((NULL == Samples)||(NULL == Result)){
+        status = NODE_NULL_POINTER;
+    }
+    else if(0U == SampleCount){
+        status = NODE_EMPTY;
+    }
+    else{
+        qsort(Samples, SampleCount, sizeof(double), Bench_Compare_Samples);
+        for(counter = 0; counter < SampleCount; counter++){
+            Sum += Samples[counter];
+        }
+        Result->Reps = SampleCount;
+        Result->MeanNs = Sum / (double)SampleCount;
+        Result->MinNs = Samples[0];
+        Result->MaxNs = Samples[SampleCount - 1U];
+        Result->P50Ns = Bench_Percentile(Samples, SampleCount, 50.0);
+        Result->P90Ns = Bench_Percentile(Samples, SampleCount, 90.0);
+        Result->P99Ns = Bench_Percentile(Samples, SampleCount, 99.0);
+        Result->OpsPerSec = (Result->MeanNs > 0.0) ? (1e9 / Result->MeanNs) : 0.0;
+        status = NODE_OK;
+    }
+    return status;
+}
+
+/*
+   This function Bench_Measure is responsible for timing one single-threaded case.
+
+   Parameters:
+   - Config: The benchmark configuration (warmup, repetitions and time budget).
+   - Run: The timed function, called with OpsPerSample operations per sample.
+   - Restore: The untimed function that brings Context back to its starting state after each sample (may be NULL).
+   - Context: The state passed to Run and Restore.
+   - OpsPerSample: Number of operations timed together; larger values hide the clock overhead of fast operations.
+   - Result: Receives the statistics.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success or NODE_NULL_POINTER if a pointer is NULL.
+
+   Algorithm:
+   - Config->Warmup samples are run and discarded to warm the caches and the allocator.
+   - Up to Config->MaxReps samples are timed. Once Config->MinReps samples are taken, the loop stops early
+     if the case has used up Config->BudgetNs, so the largest sizes still finish in reasonable time.
+   - Heap allocations are counted during the timed part only.
+*/
+NodeStatus_t Bench_Measure(BenchConfig_t *Config, BenchRun_t Run, BenchRestore_t Restore, void *Context,
+                           size_t OpsPerSample, BenchResult_t *Result){
+    NodeStatus_t status = NODE_NOK;
+    size_t counter = 0;
+    size_t Reps = 0;
+    uint64_t Allocs = 0;
+    uint64_t CaseStart = 0;
+
+    if((NULL == Config)||(NULL == Run)||(NULL == Result)){
+        status = NODE_NULL_POINTER;
+    }
+    else{
+        if(0U == OpsPerSample){
+            OpsPerSample = 1U;
+        }
+        for(counter = 0; counter < Config->Warmup; counter++){
+            Run(Context, OpsPerSample);
+            if(NULL != Restore){
+                Restore(Context, OpsPerSample);
+            }
+        }
+
+        CaseStart = Bench_Now_Ns();
+        for(Reps = 0; Reps < Config->MaxReps; ){
+            uint64_t AllocsBefore = Bench_Alloc_Count();
+            uint64_t Start = Bench_Now_Ns();
+
+            Run(Context, OpsPerSample);
+            BenchSamples[Reps] = (double)(Bench_Now_Ns() - Start) / (double)OpsPerSample;
+            Allocs += Bench_Alloc_Count() - AllocsBefore;
+            Reps++;
+            if(NULL != Restore){
+                Restore(Context, OpsPerSample);
+            }
+            if((Reps >= Config->MinReps) && ((Bench_Now_Ns() - CaseStart) > Config->BudgetNs)){
+                break;  // Slow case, enough samples taken
+            }
+        }
+
+        status = Bench_Summarize(BenchSamples, Reps, Result);
+        Result->OpsPerSample = OpsPerSample;
+        Result->AllocsPerOp = Bench_Alloc_Counting() ? ((double)Allocs / (double)(Reps * OpsPerSample)) : -1.0;
+    }
+    return status;
+}
+
+/*
+   This function Bench_Measure_Threads is responsible for timing one multi-threaded case.
+
+   Parameters:
+   - Config: The benchmark configuration (warmup, repetitions and time budget).
+   - Threads: Number of worker threads (1 to BENCH_MAX_THREADS).
+   - Run: The timed function, called by every worker with OpsPerThread operations.
+   - Exit: Untimed cleanup called by every worker after its timed part (may be NULL).
+   - Restore: Untimed function run by the calling thread after each sample, with the total operation count (may be NULL).
+   - Context: The state passed to the callbacks.
+   - OpsPerThread: Number of operations per worker and sample.
+   - Result: Receives the statistics.
+
+   Return value:
+   - NodeStatus_t: NODE_OK on success, NODE_NULL_POINTER if a pointer is NULL, or NODE_NOK if a thread could not be created.
+
+   Algorithm:
+   - For every sample, the workers are created and wait for a common start signal so thread creation is not timed.
+   - The sample time is from the start signal until the last worker finished its timed part, divided by the
+     operations of all workers.
+   - Warmup, repetitions and the time budget work as in Bench_Measure.
+*/
+NodeStatus_t Bench_Measure_Threads(BenchConfig_t *Config, size_t Threads, BenchThreadRun_t Run, BenchThreadExit_t Exit,
+                                   BenchRestore_t Restore, void *Context, size_t OpsPerThread, BenchResult_t *Result){
+    NodeStatus_t status = NODE_OK;
+    static BenchThreadShared_t Shared;
+    BenchThreadArg_t Args[BENCH_MAX_THREADS];
+    pthread_t Workers[BENCH_MAX_THREADS];
+    size_t Sample = 0;
+    size_t Reps = 0;
+    size_t counter = 0;
+    size_t Created = 0;
+    uint64_t Allocs = 0;
+    uint64_t CaseStart = 0;
+
+    if((NULL == Config)||(NULL == Run)||(NULL == Result)){
+        status = NODE_NULL_POINTER;
+    }
+    else{
+        if(Threads > BENCH_MAX_THREADS){
+            Threads = BENCH_MAX_THREADS;
+        }
+        if(0U == Threads){
+            Threads = 1U;
+        }
+        if(0U == OpsPerThread){
+            OpsPerThread = 1U;
+        }
+        CaseStart = Bench_Now_Ns();
+        for(Sample = 0; (Sample < (Config->Warmup + Config->MaxReps)) && (NODE_OK == status); Sample++){
+            uint64_t AllocsBefore = 0;
+            uint64_t Start = 0;
+            uint64_t End = 0;
+
+            Shared.Run = Run;
+            Shared.Exit = Exit;
+            Shared.Context = Context;
+            Shared.Ops = OpsPerThread;
+            Shared.Ready = 0U;
+            Shared.Go = 0;
+            for(Created = 0; Created < Threads; Created++){
+                Args[Created].Shared = &Shared;
+                Args[Created].Index = Created;
+                if(0 != pthread_create(&Workers[Created], NULL, Bench_Thread_Main, &Args[Created])){
+                    status = NODE_NOK;
+                    break;
+                }
+            }
+            while (__atomic_load_n(&Shared.Ready, __ATOMIC_ACQUIRE) < Created)
+            {
+                Bench_Yield();
+            }
+            AllocsBefore = Bench_Alloc_Count();
+            Start = Bench_Now_Ns();
+            __atomic_store_n(&Shared.Go, 1, __ATOMIC_RELEASE);
+            for(counter = 0; counter < Created; counter++){
+                pthread_join(Workers[counter], NULL);
+                if(Shared.Finish[counter] > End){
+                    End = Shared.Finish[counter];
+                }
+            }
+            if((NODE_OK == status) && (Sample >= Config->Warmup)){
+                BenchSamples[Reps] = (double)(End - Start) / (double)(Threads * OpsPerThread);
+                Allocs += Bench_Alloc_Count() - AllocsBefore;
+                Reps++;
+            }
+            if(NULL != Restore){
+                Restore(Context, Threads * OpsPerThread);
+            }
+            if((Reps >= Config->MinReps) && ((Bench_Now_Ns() - CaseStart) > Config->BudgetNs)){
+                break;  // Slow case, enough samples taken
+            }
+        }
+        if(0U != Reps){
+            (void)Bench_Summarize(BenchSamples, Reps, Result);
+            Result->OpsPerSample = Threads * OpsPerThread;
+            Result->AllocsPerOp = Bench_Alloc_Counting() ? ((double)Allocs / (double)(Reps * Threads * OpsPerThread)) : -1.0;
+        }
+        else{
+            status = NODE_NOK;
+        }
+    }
+    return status;
+}
+
+/* Function to step through thread counts 1, 2, 4, ... up to Config->MaxThreads (always included); returns 0 after the last */
+size_t Bench_Next_Thread_Count(BenchConfig_t *Config, size_t Threads){
+    size_t Next = 0U;
+
+    if(0U == Threads){
+        Next = 1U;
+    }
+    else if(Threads < Config->MaxThreads){
+        Next = (2U * Threads < Config->MaxThreads) ? (2U * Threads) : Config->MaxThreads;
+    }
+    else{
+        Next = 0U;
+    }
+    return Next;
+}
+
+/*
+   This function Bench_Report is responsible for printing one result row and appending it to the CSV and JSON files.
+*/
+void Bench_Report(BenchConfig_t *Config, BenchCase_t *Case, BenchResult_t *Result){
+    printf("%-8s %-34s %-10s %9zu %3zu %5zu %7zu %12.1f %12.1f %12.1f %12.1f %9.3f\n",
+           Case->CaseGroup, Case->CaseName, Case->CaseVariant, Case->CaseSize, Case->CaseThreads,
+           Result->Reps, Result->OpsPerSample, Result->MeanNs, Result->P50Ns, Result->P90Ns, Result->P99Ns, Result->AllocsPerOp);
+    fflush(stdout);
+
+    if(NULL != Config->CsvFile){
+        fprintf(Config->CsvFile, "%s,%s,%s,%zu,%zu,%zu,%zu,%.2f,%.2f,%.2f,%.2f,%.2f,%.2f,%.1f,%.4f\n",
+                Case->CaseGroup, Case->CaseName, Case->CaseVariant, Case->CaseSize, Case->CaseThreads,
+                Result->Reps, Result->OpsPerSample, Result->MeanNs, Result->MinNs, Result->P50Ns, Result->P90Ns,
+                Result->P99Ns, Result->MaxNs, Result->OpsPerSec, Result->AllocsPerOp);
+        fflush(Config->CsvFile);
+    }
+    if(NULL != Config->JsonFile){
+        fprintf(Config->JsonFile,
+                "%s    {\"group\": \"%s\", \"name\": \"%s\", \"variant\": \"%s\", \"size\": %zu, \"threads\": %zu, "
+                "\"reps\": %zu, \"ops_per_sample\": %zu, \"mean_ns\": %.2f, \"min_ns\": %.2f, \"p50_ns\": %.2f, "
+                "\"p90_ns\": %.2f, \"p99_ns\": %.2f, \"max_ns\": %.2f, \"ops_per_sec\": %.1f, \"allocs_per_op\": %.4f}",
+                (0U == Config->JsonCount) ? "" : ",\n",
+                Case->CaseGroup, Case->CaseName, Case->CaseVariant, Case->CaseSize, Case->CaseThreads,
+                Result->Reps, Result->OpsPerSample, Result->MeanNs, Result->MinNs, Result->P50Ns, Result->P90Ns,
+                Result->P99Ns, Result->MaxNs, Result->OpsPerSec, Result->AllocsPerOp);
+        fflush(Config->JsonFile);
+        Config->JsonCount++;
+    }
+}
+
+/* Function to send stdout to the null device, used while timing Display_All_Nodes */
+void Bench_Silence_Stdout(void){
+    int NullDevice = -1;
+
+    fflush(stdout);
+    if(-1 == BenchSavedStdout){
+        NullDevice = Bench_Open(BENCH_NULL_DEVICE, O_WRONLY);
+        if(-1 != NullDevice){
+            BenchSavedStdout = Bench_Dup(1);
+            Bench_Dup2(NullDevice, 1);
+            Bench_Close(NullDevice);
+        }
+    }
+}
+
+/* Function to bring stdout back after Bench_Silence_Stdout */
+void Bench_Restore_Stdout(void){
+    fflush(stdout);
+    if(-1 != BenchSavedStdout){
+        Bench_Dup2(BenchSavedStdout, 1);
+        Bench_Close(BenchSavedStdout);
+        BenchSavedStdout = -1;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,144 @@
+/* 
+ * File:   Benchmark.h
+ * Author: Mohammed Khairallah
+ * linkedin : linkedin.com/in/mohammed-khairallah
+ * Created on October 18, 2026, 2:00 PM
+ */
+#ifndef _BENCHMARK_H
+#define _BENCHMARK_H
+
+/* Section : Includes */
+#include "SingleLinkedList.h"
+
+/* Section : Macro Declarations */
+
+#define BENCH_MAX_SAMPLES (101U)          /* Upper bound of timed repetitions per case */
+#define BENCH_DEFAULT_REPS (21U)          /* Timed repetitions per case */
+#define BENCH_DEFAULT_MIN_REPS (5U)       /* Repetitions kept even when the time budget is exceeded */
+#define BENCH_DEFAULT_WARMUP (2U)         /* Untimed repetitions per case */
+#define BENCH_DEFAULT_BUDGET_MS (400U)    /* Time budget per case used to reduce the repetitions of slow cases */
+#define BENCH_DEFAULT_MIN_SIZE (10UL)     /* Smallest list size */
+#define BENCH_DEFAULT_MAX_SIZE (10000000UL)  /* Largest list size, 10^7 */
+#define BENCH_MAX_THREADS (256U)          /* Upper bound of worker threads per case */
+
+/* Section : Macro Functions Declarations */
+
+
+/* Section : Data type Declarations */
+
+/* 
+   This typedef struct holds the command line configuration shared by all benchmark groups.
+
+   Explanation of members:
+   - Warmup / MaxReps / MinReps: Untimed repetitions, and bounds of timed repetitions per case.
+   - BudgetNs: Time allowed per case; slow cases run fewer repetitions (but at least MinReps).
+   - MinSize / MaxSize: Range of list sizes; groups step through powers of ten in this range.
+   - MaxThreads: Highest thread count used by multi-threaded groups (0 = number of online processors).
+   - Filter: Only cases whose group or name contains this text are run (NULL = all).
+   - CsvFile / JsonFile: Optional result files, NULL when not requested.
+   - JsonCount: Number of results already written to JsonFile.
+*/
+typedef struct{
+    size_t Warmup;       /* untimed repetitions */
+    size_t MaxReps;      /* timed repetitions */
+    size_t MinReps;      /* timed repetitions kept for slow cases */
+    uint64_t BudgetNs;   /* time budget per case */
+    size_t MinSize;      /* smallest list size */
+    size_t MaxSize;      /* largest list size */
+    size_t MaxThreads;   /* highest thread count for multi-threaded groups */
+    const char *Filter;  /* case filter, NULL for all */
+    FILE *CsvFile;       /* CSV output, NULL if not requested */
+    FILE *JsonFile;      /* JSON output, NULL if not requested */
+    size_t JsonCount;    /* results written to JsonFile */
+}BenchConfig_t;
+
+/* 
+   This typedef struct identifies one benchmark case (one row of the results).
+
+   Explanation of members:
+   - CaseGroup: Benchmark group, e.g. "list".
+   - CaseName: Measured operation, e.g. "List_Insert_Node_At_End".
+   - CaseVariant: Backend or access pattern, e.g. "raw", "handle" or "pooled".
+   - CaseSize: List size the operation runs on.
+   - CaseThreads: Number of threads (1 for single-threaded cases).
+*/
+typedef struct{
+    const char *CaseGroup;    /* benchmark group */
+    const char *CaseName;     /* measured operation */
+    const char *CaseVariant;  /* backend or access pattern */
+    size_t CaseSize;          /* list size */
+    size_t CaseThreads;       /* number of threads */
+}BenchCase_t;
+
+/* 
+   This typedef struct holds the statistics of one benchmark case. All times are per operation.
+
+   Explanation of members:
+   - Reps: Number of timed samples taken.
+   - OpsPerSample: Number of operations timed together in one sample.
+   - MeanNs / MinNs / P50Ns / P90Ns / P99Ns / MaxNs: Distribution of the per-operation time over the samples.
+   - OpsPerSec: Throughput derived from MeanNs. For multi-threaded cases the times are wall-clock time divided by the
+                operations of all threads, so OpsPerSec is the aggregate throughput.
+   - AllocsPerOp: Heap allocations (malloc, calloc, realloc, aligned_alloc) per operation, or -1 when not counted.
+*/
+typedef struct{
+    size_t Reps;          /* timed samples */
+    size_t OpsPerSample;  /* operations per sample */
+    double MeanNs;        /* mean ns/op */
+    double MinNs;         /* fastest sample, ns/op */
+    double P50Ns;         /* median sample, ns/op */
+    double P90Ns;         /* 90th percentile sample, ns/op */
+    double P99Ns;         /* 99th percentile sample, ns/op */
+    double MaxNs;         /* slowest sample, ns/op */
+    double OpsPerSec;     /* throughput */
+    double AllocsPerOp;   /* heap allocations per operation */
+}BenchResult_t;
+
+/* Timed part of a case: performs Ops operations on Context */
+typedef void (*BenchRun_t)(void *Context, size_t Ops);
+
+/* Untimed part of a case: undoes the effect of Ops operations so every sample starts from the same list */
+typedef void (*BenchRestore_t)(void *Context, size_t Ops);
+
+/* Timed part of a multi-threaded case: thread ThreadIndex performs Ops operations on Context */
+typedef void (*BenchThreadRun_t)(void *Context, size_t ThreadIndex, size_t Ops);
+
+/* Untimed per-thread cleanup run by each worker after its timed part (e.g. Hazard_Thread_Exit) */
+typedef void (*BenchThreadExit_t)(void *Context, size_t ThreadIndex);
+
+/* Section : Functions Declaration */
+
+uint64_t Bench_Now_Ns(void);
+uint64_t Bench_Alloc_Count(void);
+int Bench_Alloc_Counting(void);
+int Bench_Case_Enabled(BenchConfig_t *Config, const char *CaseGroup, const char *CaseName);
+NodeStatus_t Bench_Measure(BenchConfig_t *Config, BenchRun_t Run, BenchRestore_t Restore, void *Context,
+                           size_t OpsPerSample, BenchResult_t *Result);
+NodeStatus_t Bench_Measure_Threads(BenchConfig_t *Config, size_t Threads, BenchThreadRun_t Run, BenchThreadExit_t Exit,
+                                   BenchRestore_t Restore, void *Context, size_t OpsPerThread, BenchResult_t *Result);
+size_t Bench_Next_Thread_Count(BenchConfig_t *Config, size_t Threads);
+NodeStatus_t Bench_Summarize(double *Samples, size_t SampleCount, BenchResult_t *Result);
+void Bench_Report(BenchConfig_t *Config, BenchCase_t *Case, BenchResult_t *Result);
+void Bench_Silence_Stdout(void);
+void Bench_Restore_Stdout(void);
+
+/* Benchmark groups, one per Bench_*.c file */
+void Bench_Group_List(BenchConfig_t *Config);
+void Bench_Group_Stack(BenchConfig_t *Config);
+void Bench_Group_Queue(BenchConfig_t *Config);
+void Bench_Group_Snapshot(BenchConfig_t *Config);
+void Bench_Group_Export(BenchConfig_t *Config);
+void Bench_Group_Bulk(BenchConfig_t *Config);
+void Bench_Group_Cursor(BenchConfig_t *Config);
+void Bench_Group_Sort(BenchConfig_t *Config);
+void Bench_Group_Lookup(BenchConfig_t *Config);
+void Bench_Group_Scan(BenchConfig_t *Config);
+void Bench_Group_Compact(BenchConfig_t *Config);
+void Bench_Group_CList(BenchConfig_t *Config);
+void Bench_Group_Generic(BenchConfig_t *Config);
+void Bench_Group_Splice(BenchConfig_t *Config);
+void Bench_Group_Parallel(BenchConfig_t *Config);
+void Bench_Group_Persist(BenchConfig_t *Config);
+void Bench_Group_Finger(BenchConfig_t *Config);
+
+#endif  //_BENCHMARK_H
\ No newline at end of file
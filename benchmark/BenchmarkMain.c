@@ -0,0 +1,189 @@
+/* 
+ * File:   BenchmarkMain.c
+ * Author: Mohammed Khairallah
+ * linkedin : linkedin.com/in/mohammed-khairallah
+ * Created on October 18, 2026, 2:00 PM
+ */
+
+/*
+   This program is the benchmark suite of the list library. It is non-interactive and portable (no windows.h).
+
+   Usage: Benchmark [options]
+     --group NAME      run only this benchmark group (default: all groups)
+     --filter TEXT     run only cases whose group or operation name contains TEXT
+     --min-size N      smallest list size (default 10)
+     --max-size N      largest list size (default 10000000)
+     --reps N          timed repetitions per case (default 21, at most 101)
+     --min-reps N      repetitions kept when a case exceeds its time budget (default 5)
+     --warmup N        untimed repetitions per case (default 2)
+     --budget-ms N     time budget per case in milliseconds (default 400)
+     --threads N       highest thread count for multi-threaded groups (default: online processors)
+     --csv FILE        also write the results as CSV
+     --json FILE       also write the results as JSON
+
+   Each result row reports the mean, median, 90th and 99th percentile time per operation over the samples,
+   and the heap allocations per operation when the allocator wrappers are linked in (see the Makefile).
+*/
+#include <string.h>
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+#include "Benchmark.h"
+
+/* 
+   This typedef struct associates a group name with its entry point.
+*/
+typedef struct{
+    const char *GroupName;                 /* name used with --group */
+    void (*GroupRun)(BenchConfig_t *Config);  /* entry point */
+}BenchGroup_t;
+
+static const BenchGroup_t BenchGroups[] = {
+    {"list", Bench_Group_List},
+    {"stack", Bench_Group_Stack},
+    {"queue", Bench_Group_Queue},
+    {"snapshot", Bench_Group_Snapshot},
+    {"export", Bench_Group_Export},
+    {"bulk", Bench_Group_Bulk},
+    {"cursor", Bench_Group_Cursor},
+    {"sort", Bench_Group_Sort},
+    {"lookup", Bench_Group_Lookup},
+    {"scan", Bench_Group_Scan},
+    {"compact", Bench_Group_Compact},
+    {"clist", Bench_Group_CList},
+    {"generic", Bench_Group_Generic},
+    {"splice", Bench_Group_Splice},
+    {"parallel", Bench_Group_Parallel},
+    {"persist", Bench_Group_Persist},
+    {"finger", Bench_Group_Finger},
+};
+
+/* Function to print the usage text */
+static void Bench_Usage(const char *Program){
+    printf("Usage: %s [--group NAME] [--filter TEXT] [--min-size N] [--max-size N] [--reps N] [--min-reps N]\n"
+           "       [--warmup N] [--budget-ms N] [--threads N] [--csv FILE] [--json FILE]\n", Program);
+}
+
+/* Function to read the number of online processors */
+static size_t Bench_Online_Cpus(void){
+    size_t Cpus = 1U;
+#if defined(_WIN32)
+    SYSTEM_INFO Info;
+
+    GetSystemInfo(&Info);
+    Cpus = (size_t)Info.dwNumberOfProcessors;
+#else
+    long Online = sysconf(_SC_NPROCESSORS_ONLN);
+
+    if(Online > 0){
+        Cpus = (size_t)Online;
+    }
+#endif
+    return Cpus;
+}
+
+int main(int argc, char *argv[]){
+    BenchConfig_t Config;
+    const char *Group = NULL;
+    const char *CsvPath = NULL;
+    const char *JsonPath = NULL;
+    int counter = 0;
+    size_t GroupIndex = 0;
+    int status = 0;
+
+    Config.Warmup = BENCH_DEFAULT_WARMUP;
+    Config.MaxReps = BENCH_DEFAULT_REPS;
+    Config.MinReps = BENCH_DEFAULT_MIN_REPS;
+    Config.BudgetNs = (uint64_t)BENCH_DEFAULT_BUDGET_MS * 1000000ULL;
+    Config.MinSize = BENCH_DEFAULT_MIN_SIZE;
+    Config.MaxSize = BENCH_DEFAULT_MAX_SIZE;
+    Config.MaxThreads = 0U;
+    Config.Filter = NULL;
+    Config.CsvFile = NULL;
+    Config.JsonFile = NULL;
+    Config.JsonCount = 0U;
+
+    for(counter = 1; counter < argc; counter++){
+        const char *Value = (counter + 1 < argc) ? argv[counter + 1] : NULL;
+
+        if((0 == strcmp(argv[counter], "--help")) || (NULL == Value)){
+            Bench_Usage(argv[0]);
+            return (0 == strcmp(argv[counter], "--help")) ? 0 : 1;
+        }
+        else if(0 == strcmp(argv[counter], "--group")){ Group = Value; }
+        else if(0 == strcmp(argv[counter], "--filter")){ Config.Filter = Value; }
+        else if(0 == strcmp(argv[counter], "--min-size")){ Config.MinSize = (size_t)strtoull(Value, NULL, 10); }
+        else if(0 == strcmp(argv[counter], "--max-size")){ Config.MaxSize = (size_t)strtoull(Value, NULL, 10); }
+        else if(0 == strcmp(argv[counter], "--reps")){ Config.MaxReps = (size_t)strtoull(Value, NULL, 10); }
+        else if(0 == strcmp(argv[counter], "--min-reps")){ Config.MinReps = (size_t)strtoull(Value, NULL, 10); }
+        else if(0 == strcmp(argv[counter], "--warmup")){ Config.Warmup = (size_t)strtoull(Value, NULL, 10); }
+        else if(0 == strcmp(argv[counter], "--budget-ms")){ Config.BudgetNs = strtoull(Value, NULL, 10) * 1000000ULL; }
+        else if(0 == strcmp(argv[counter], "--threads")){ Config.MaxThreads = (size_t)strtoull(Value, NULL, 10); }
+        else if(0 == strcmp(argv[counter], "--csv")){ CsvPath = Value; }
+        else if(0 == strcmp(argv[counter], "--json")){ JsonPath = Value; }
+        else{
+            Bench_Usage(argv[0]);
+            return 1;
+        }
+        counter++;  // Skip the option value
+    }
+
+    /* Keep the configuration inside the supported ranges */
+    if((Config.MaxReps < 1U) || (Config.MaxReps > BENCH_MAX_SAMPLES)){
+        Config.MaxReps = (Config.MaxReps < 1U) ? 1U : BENCH_MAX_SAMPLES;
+    }
+    if(Config.MinReps > Config.MaxReps){
+        Config.MinReps = Config.MaxReps;
+    }
+    if(Config.MinSize < 2U){
+        Config.MinSize = 2U;  // Positional cases use position Size / 2
+    }
+    if(0U == Config.MaxThreads){
+        Config.MaxThreads = Bench_Online_Cpus();
+    }
+    if(Config.MaxThreads > BENCH_MAX_THREADS){
+        Config.MaxThreads = BENCH_MAX_THREADS;
+    }
+
+    if(NULL != CsvPath){
+        Config.CsvFile = fopen(CsvPath, "w");
+        if(NULL == Config.CsvFile){
+            printf("Cannot open %s\n", CsvPath);
+            return 1;
+        }
+        fprintf(Config.CsvFile, "group,name,variant,size,threads,reps,ops_per_sample,mean_ns,min_ns,p50_ns,p90_ns,p99_ns,max_ns,ops_per_sec,allocs_per_op\n");
+    }
+    if(NULL != JsonPath){
+        Config.JsonFile = fopen(JsonPath, "w");
+        if(NULL == Config.JsonFile){
+            printf("Cannot open %s\n", JsonPath);
+            return 1;
+        }
+        fprintf(Config.JsonFile, "{\n  \"suite\": \"SingleLinkedList\",\n  \"format\": 1,\n  \"results\": [\n");
+    }
+
+    printf("%-8s %-34s %-10s %9s %3s %5s %7s %12s %12s %12s %12s %9s\n", "group", "operation", "variant", "size", "thr",
+           "reps", "ops/smp", "mean ns/op", "p50 ns/op", "p90 ns/op", "p99 ns/op", "allocs/op");
+
+    status = 1;  // Stays 1 if --group names no known group
+    for(GroupIndex = 0; GroupIndex < (sizeof(BenchGroups) / sizeof(BenchGroups[0])); GroupIndex++){
+        if((NULL == Group) || (0 == strcmp(Group, BenchGroups[GroupIndex].GroupName))){
+            BenchGroups[GroupIndex].GroupRun(&Config);
+            status = 0;
+        }
+    }
+    if(0 != status){
+        printf("Unknown group %s\n", Group);
+    }
+
+    if(NULL != Config.CsvFile){
+        fclose(Config.CsvFile);
+    }
+    if(NULL != Config.JsonFile){
+        fprintf(Config.JsonFile, "\n  ]\n}\n");
+        fclose(Config.JsonFile);
+    }
+    return status;
+}
\ No newline at end of file
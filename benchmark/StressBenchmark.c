@@ -0,0 +1,148 @@
+/* 
+ * File:   StressBenchmark.c
+ * Author: Mohammed Khairallah
+ * linkedin : linkedin.com/in/mohammed-khairallah
+ * Created on October 18, 2026, 1:00 PM
+ */
+
+/*
+   This program is a stress benchmark for very long lists (10^7 nodes by default).
+   It checks that lengths and positions beyond 65,535 nodes are handled correctly and reports how long each step takes.
+
+   Explanation of the program:
+   - The node count can be given as the first command line argument, e.g. "StressBenchmark 20000000".
+   - Step 1 builds a Node_t list with Insert_Node_At_Beginning, then checks Get_Length_Wide and that the legacy
+     Get_Length reports NODE_NOK with a saturated length instead of a wrapped one.
+   - Step 2 inserts and deletes at positions far beyond the 16-bit range with Insert_Node_After_Wide and Delete_Node_Wide
+     and checks that the right nodes were touched.
+   - Step 3 repeats the build and the deep positional edits with a List_t handle attached to a node pool.
+   - Every check that fails is printed and makes the program return 1.
+*/
+#include <time.h>
+#include "SingleLinkedList.h"
+#include "NodePool.h"
+
+#define STRESS_DEFAULT_NODES (10000000UL)  /* Default node count, 10^7 */
+
+static int FailedChecks = 0;  /* Number of failed checks */
+
+/* Function to print the elapsed time of a step since Start */
+static void Report_Step(const char *StepName, clock_t Start, size_t Operations){
+    double Seconds = (double)(clock() - Start) / (double)CLOCKS_PER_SEC;
+
+    printf("%-44s %10.3f s  %14.1f ns/op\n", StepName, Seconds,
+           (0U != Operations) ? ((Seconds * 1e9) / (double)Operations) : 0.0);
+}
+
+/* Function to record the result of one check */
+static void Check(int Condition, const char *Description){
+    if(!Condition){
+        printf("CHECK FAILED : %s\n", Description);
+        FailedChecks++;
+    }
+}
+
+/* Function to read the data stored at a 1-based position of a Node_t list */
+static uint32_t Data_At(Node_t *NodeHead, size_t NodePosition){
+    size_t counter = 1;
+
+    while (counter < NodePosition)
+    {
+        NodeHead = NodeHead->NodeLink;
+        counter++;
+    }
+    return NodeHead->NodeData;
+}
+
+int main(int argc, char *argv[]){
+    size_t NodeCount = STRESS_DEFAULT_NODES;
+    size_t Length = 0;
+    size_t counter = 0;
+    uint16_t Length16 = 0;
+    uint32_t Data = 0;
+    Node_t *NodeHead = NULL;
+    List_t List;
+    NodePool_t Pool;
+    clock_t Start;
+
+    if(argc > 1){
+        NodeCount = (size_t)strtoul(argv[1], NULL, 10);
+    }
+    if(NodeCount <= (2U * NODE_LENGTH_MAX_U16)){
+        NodeCount = 2U * NODE_LENGTH_MAX_U16 + 2U;  // The point is to go past the 16-bit range
+    }
+    printf("Stress benchmark with %zu nodes\n\n", NodeCount);
+
+    /* Step 1 : build a Node_t list and count it */
+    Start = clock();
+    for(counter = NodeCount; counter > 0U; counter--){
+        Data = (uint32_t)counter;  // Position p holds the value p
+        if(NODE_OK != Insert_Node_At_Beginning(&NodeHead, &Data)){
+            Check(0, "Insert_Node_At_Beginning");
+            break;
+        }
+    }
+    Report_Step("Insert_Node_At_Beginning", Start, NodeCount);
+
+    Start = clock();
+    Check(NODE_OK == Get_Length_Wide(&NodeHead, &Length), "Get_Length_Wide status");
+    Report_Step("Get_Length_Wide", Start, NodeCount);
+    Check(Length == NodeCount, "Get_Length_Wide value");
+    Check(NODE_NOK == Get_Length(&NodeHead, &Length16), "Get_Length rejects lengths above 65535");
+    Check(NODE_LENGTH_MAX_U16 == Length16, "Get_Length saturates instead of wrapping");
+
+    /* Step 2 : positional edits beyond the 16-bit range */
+    Start = clock();
+    Data = 0xA5A5A5A5U;
+    Check(NODE_OK == Insert_Node_After_Wide(&NodeHead, NodeCount - 1U, &Data), "Insert_Node_After_Wide deep");
+    Report_Step("Insert_Node_After_Wide (position n-1)", Start, 1U);
+    Check(0xA5A5A5A5U == Data_At(NodeHead, NodeCount), "inserted node is at position n");
+    Check((uint32_t)NodeCount == Data_At(NodeHead, NodeCount + 1U), "last node moved to position n+1");
+
+    Start = clock();
+    Check(NODE_OK == Delete_Node_Wide(&NodeHead, NodeCount), "Delete_Node_Wide deep");
+    Report_Step("Delete_Node_Wide (position n)", Start, 1U);
+    Check(NODE_NOK == Delete_Node_Wide(&NodeHead, NodeCount + 1U), "Delete_Node_Wide rejects position n+1");
+    Check(NODE_OK == Delete_Node_Wide(&NodeHead, (size_t)NODE_LENGTH_MAX_U16 + 2U), "Delete_Node_Wide at 65537");
+    Check(((uint32_t)NODE_LENGTH_MAX_U16 + 3U) == Data_At(NodeHead, (size_t)NODE_LENGTH_MAX_U16 + 2U), "node 65537 removed");
+    Get_Length_Wide(&NodeHead, &Length);
+    Check(Length == (NodeCount - 1U), "length after deep edits");
+
+    Start = clock();
+    while (NULL != NodeHead)
+    {
+        Delete_Node_At_Beginning(&NodeHead);
+    }
+    Report_Step("Delete_Node_At_Beginning (all)", Start, NodeCount - 1U);
+
+    /* Step 3 : the same with a pooled List_t handle */
+    NodePool_Init(&Pool, 0U);
+    List_Init(&List);
+    List_Use_Pool(&List, &Pool);
+
+    Start = clock();
+    for(counter = 1U; counter <= NodeCount; counter++){
+        Data = (uint32_t)counter;
+        if(NODE_OK != List_Insert_Node_At_End(&List, &Data)){
+            Check(0, "List_Insert_Node_At_End");
+            break;
+        }
+    }
+    Report_Step("List_Insert_Node_At_End (pooled)", Start, NodeCount);
+    List_Get_Length(&List, &Length);
+    Check(Length == NodeCount, "List_Get_Length value");
+
+    Start = clock();
+    Check(NODE_OK == List_Insert_Node_After(&List, NodeCount - 1U, &Data), "List_Insert_Node_After deep");
+    Check(NODE_OK == List_Delete_Node(&List, NodeCount), "List_Delete_Node deep");
+    Report_Step("List_Insert_Node_After + List_Delete_Node", Start, 2U);
+    Check((uint32_t)NodeCount == List.ListTail->NodeData, "tail after deep edits");
+
+    Start = clock();
+    List_Clear(&List);
+    Report_Step("List_Clear (pooled)", Start, NodeCount);
+    NodePool_Destroy(&Pool);
+
+    printf("\n%s (%i failed checks)\n", (0 == FailedChecks) ? "PASSED" : "FAILED", FailedChecks);
+    return (0 == FailedChecks) ? 0 : 1;
+}
\ No newline at end of file